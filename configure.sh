@@ -60,6 +60,8 @@ The following flags enable optional packages (disable with --no-<option name>).
   --glpk                   use GLPK simplex solver
   --abc                    use the ABC AIG library
   --cadical                use the CaDiCaL SAT solver
+  --cadical-dpll           use CaDiCaL in the DPLL(T) search (experimental,
+                           requires --cadical and CaDiCaL 1.9.5)
   --cryptominisat          use the CryptoMiniSat SAT solver
   --drat2er                use drat2er (required for eager BV proofs)
   --lfsc                   use the LFSC proof checker
@@ -114,6 +116,7 @@ tsan=default
 assertions=default
 best=default
 cadical=default
+cadical_dpll=default
 cln=default
 comp_inc=default
 coverage=default
@@ -204,6 +207,9 @@ do
     --cadical) cadical=ON;;
     --no-cadical) cadical=OFF;;
 
+    --cadical-dpll) cadical_dpll=ON;;
+    --no-cadical-dpll) cadical_dpll=OFF;;
+
     --cln) cln=ON;;
     --no-cln) cln=OFF;;
 
@@ -415,6 +421,8 @@ cmake_opts=""
   && cmake_opts="$cmake_opts -DUSE_ABC=$abc"
 [ $cadical != default ] \
   && cmake_opts="$cmake_opts -DUSE_CADICAL=$cadical"
+[ $cadical_dpll != default ] \
+  && cmake_opts="$cmake_opts -DUSE_CADICAL_DPLL=$cadical_dpll"
 [ $cln != default ] \
   && cmake_opts="$cmake_opts -DUSE_CLN=$cln"
 [ $cryptominisat != default ] \
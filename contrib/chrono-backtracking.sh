@@ -0,0 +1,58 @@
+#!/bin/bash
+# contrib/chrono-backtracking.sh
+#
+# ./contrib/chrono-backtracking.sh <CVC4> <FILE>...
+#
+# Compares the search with and without chronological backtracking
+# (--sat-chrono-backtrack) on the given benchmarks, for instance the QF_LIA
+# and QF_UFLRA problems of SMT-LIB, where the theory checks dominate.  For
+# each run, the result, the wall-clock time, the time spent in the theory
+# checks (prop::theoryproxy::theoryCheckTime), both in seconds, and the
+# number of chronological backtracks are printed.  Set CHRONO_OPTS to pass
+# more options to the solver, and TIMEOUT to change the time limit of a run
+# (in seconds, default 1200).
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <CVC4> <FILE>..." >&2
+  exit 1
+fi
+
+CVC4=$1
+shift
+TIMEOUT=${TIMEOUT:-1200}
+
+# stat <name> <stats>: prints the value of a statistic
+stat() {
+  echo "$2" | awk -F ', ' -v name="$1" \
+    '$1 == name { split($2, v, " "); print v[1]; exit }'
+}
+
+# run <options> <file>: prints the result, the wall-clock time, the theory
+# check time and the number of chronological backtracks of a run
+run() {
+  local start end result stats
+  start=$(date +%s.%N)
+  stats=$(timeout "$TIMEOUT" "$CVC4" --stats $1 $CHRONO_OPTS "$2" \
+          2>&1 >/dev/null)
+  end=$(date +%s.%N)
+  result=$(stat "driver::sat/unsat" "$stats")
+  echo "${result:-timeout}" \
+       "$(awk "BEGIN { print $end - $start }")" \
+       "$(stat "prop::theoryproxy::theoryCheckTime" "$stats")" \
+       "$(stat "sat::chrono_backtracks" "$stats")"
+}
+
+printf "%-40s %-8s %10s %10s %10s %10s %10s\n" "benchmark" "result" \
+       "time" "theory" "chrono" "theory" "backtracks"
+
+for file in "$@"; do
+  read -r result time theory _ <<< "$(run "" "$file")"
+  read -r cresult ctime ctheory backtracks <<< \
+    "$(run "--sat-chrono-backtrack" "$file")"
+  if [ "$cresult" != "$result" ]; then
+    result="$result/$cresult"
+  fi
+  printf "%-40s %-8s %10.2f %10.2f %10.2f %10.2f %10s\n" \
+         "$(basename "$file")" "$result" "$time" "${theory:-0}" \
+         "$ctime" "${ctheory:-0}" "${backtracks:-0}"
+done
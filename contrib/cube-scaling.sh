@@ -0,0 +1,55 @@
+#!/bin/bash
+# contrib/cube-scaling.sh
+#
+# ./contrib/cube-scaling.sh <CVC4> <FILE>...
+#
+# Measures the speedup of the cube-and-conquer check-sat (--cube-workers) on
+# the given benchmarks, for instance the hard QF_BV and QF_LIA problems of
+# SMT-LIB.  Each benchmark is solved sequentially and with 4, 8 and 16
+# workers, and the wall-clock times are printed in seconds, with the speedup
+# over the sequential run in parentheses.  Set CUBE_OPTS to pass more options
+# to the solver, and TIMEOUT to change the time limit of a run (in seconds,
+# default 1200).
+
+if [ $# -lt 2 ]; then
+  echo "usage: $0 <CVC4> <FILE>..." >&2
+  exit 1
+fi
+
+CVC4=$1
+shift
+TIMEOUT=${TIMEOUT:-1200}
+WORKERS="0 4 8 16"
+
+# run <workers> <file>: prints the result and the wall-clock time of a run
+run() {
+  local start end result
+  start=$(date +%s.%N)
+  result=$(timeout "$TIMEOUT" "$CVC4" --cube-workers="$1" $CUBE_OPTS "$2" \
+           2>/dev/null | head -n 1)
+  end=$(date +%s.%N)
+  echo "${result:-timeout} $(awk "BEGIN { print $end - $start }")"
+}
+
+printf "%-40s %-8s" "benchmark" "result"
+for w in $WORKERS; do
+  printf " %16s" "workers=$w"
+done
+echo
+
+for file in "$@"; do
+  printf "%-40s" "$(basename "$file")"
+  first=1
+  for w in $WORKERS; do
+    read -r result time <<< "$(run "$w" "$file")"
+    if [ $first -eq 1 ]; then
+      printf " %-8s" "$result"
+      printf " %16.2f" "$time"
+      base=$time
+      first=0
+    else
+      printf " %8.2f (%5.2fx)" "$time" "$(awk "BEGIN { print $base / $time }")"
+    fi
+  done
+  echo
+done
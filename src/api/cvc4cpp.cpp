@@ -42,6 +42,7 @@
 #include "expr/metakind.h"
 #include "expr/node_manager.h"
 #include "expr/type.h"
+#include "expr/variable_type_map.h"
 #include "options/main_options.h"
 #include "options/options.h"
 #include "options/smt_options.h"
@@ -2278,6 +2279,33 @@ Solver::Solver(Options* opts)
 
 Solver::~Solver() {}
 
+Solver* Solver::clone() const
+{
+  Options opts;
+  opts.copyValues(d_exprMgr->getOptions());
+  std::unique_ptr<Solver> copy(new Solver(&opts));
+  copy->d_cloneMap.reset(new ExprManagerMapCollection());
+  copy->d_smtEngine.reset(
+      d_smtEngine->fork(copy->d_exprMgr.get(), *copy->d_cloneMap));
+  return copy.release();
+}
+
+Term Solver::importTerm(const Term& t) const
+{
+  CVC4_API_CHECK(d_cloneMap != nullptr)
+      << "Cannot import a term into a solver that is not a clone";
+  CVC4_API_ARG_CHECK_NOT_NULL(t);
+  return Term(t.d_expr->exportTo(d_exprMgr.get(), *d_cloneMap));
+}
+
+Sort Solver::importSort(const Sort& s) const
+{
+  CVC4_API_CHECK(d_cloneMap != nullptr)
+      << "Cannot import a sort into a solver that is not a clone";
+  CVC4_API_ARG_CHECK_NOT_NULL(s);
+  return Sort(s.d_type->exportTo(d_exprMgr.get(), *d_cloneMap));
+}
+
 /* Helpers                                                                    */
 /* -------------------------------------------------------------------------- */
 
@@ -37,6 +37,7 @@
 namespace CVC4 {
 
 class Expr;
+struct ExprManagerMapCollection;
 class Datatype;
 class DatatypeConstructor;
 class DatatypeConstructorArg;
@@ -1809,6 +1810,32 @@ class CVC4_PUBLIC Solver
   Solver(const Solver&) = delete;
   Solver& operator=(const Solver&) = delete;
 
+  /**
+   * Create a copy of this solver, with the same options, logic, function
+   * definitions and assertions (see SmtEngine::fork()).  Requires option
+   * produce-assertions.  The copy does not share any state with this
+   * solver, so it may run checkSat() in another thread than this solver;
+   * it must be deleted before this solver.
+   * @return the copy, owned by the caller
+   */
+  Solver* clone() const;
+
+  /**
+   * Translate a term of the solver this solver was cloned from into a term
+   * of this solver.  That solver must not be in use in another thread.
+   * @param t the term of the parent solver
+   * @return the term in this solver
+   */
+  Term importTerm(const Term& t) const;
+
+  /**
+   * Translate a sort of the solver this solver was cloned from into a sort
+   * of this solver.  That solver must not be in use in another thread.
+   * @param s the sort of the parent solver
+   * @return the sort in this solver
+   */
+  Sort importSort(const Sort& s) const;
+
   /* .................................................................... */
   /* Sorts Handling                                                       */
   /* .................................................................... */
@@ -2865,6 +2892,8 @@ class CVC4_PUBLIC Solver
   std::unique_ptr<SmtEngine> d_smtEngine;
   /* The random number generator of this solver. */
   std::unique_ptr<Random> d_rng;
+  /* The map from the solver this solver was cloned from, if any. */
+  std::unique_ptr<ExprManagerMapCollection> d_cloneMap;
 };
 
 // !!! Only temporarily public until the parser is fully migrated to the
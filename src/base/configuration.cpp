@@ -250,6 +250,8 @@ bool Configuration::isBuiltWithAbc() {
 
 bool Configuration::isBuiltWithCadical() { return IS_CADICAL_BUILD; }
 
+bool Configuration::isBuiltWithCadicalDpll() { return IS_CADICAL_DPLL_BUILD; }
+
 bool Configuration::isBuiltWithCryptominisat() {
   return IS_CRYPTOMINISAT_BUILD;
 }
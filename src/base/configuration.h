@@ -99,6 +99,8 @@ public:
 
   static bool isBuiltWithCadical();
 
+  static bool isBuiltWithCadicalDpll();
+
   static bool isBuiltWithCryptominisat();
 
   static bool isBuiltWithDrat2Er();
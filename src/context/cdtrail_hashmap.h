@@ -0,0 +1,352 @@
+/*********************                                                        */
+/*! \file cdtrail_hashmap.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Context-dependent map backed by a flat table and an undo trail
+ **
+ ** Context-dependent map with the interface of CDHashMap.  The entries are
+ ** kept in a vector in insertion order, and looked up through an
+ ** open-addressed index with linear probing.  The map is a single ContextObj:
+ ** it is saved once per context level, and the old values of the entries
+ ** updated at that level are recorded on a trail.  Popping a level undoes
+ ** the trail and truncates the entries, instead of restoring one ContextObj
+ ** per entry as CDHashMap does.
+ **
+ ** See also:
+ **  CDHashMap : A fully featured CD hash map. (The closest to <ext/hash_map>)
+ **  CDInsertHashMap : An "insert-once" CD hash map.
+ **
+ ** Notes:
+ ** - Entries are removed in the reverse order of their insertion, so
+ **   clearing the index slot of the last entry is enough to remove it from
+ **   a linear probing table: no entry still in the table was inserted after
+ **   it, so no probe sequence goes through its slot.
+ ** - Iterators stay valid as long as the entry they point to is in the map,
+ **   but references to the entries are invalidated by insertions.
+ ** - There is no insertAtContextLevelZero() and no erase().
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__CONTEXT__CDTRAIL_HASHMAP_H
+#define CVC4__CONTEXT__CDTRAIL_HASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "context/cdtrail_hashmap_forward.h"
+#include "context/context.h"
+
+namespace CVC4 {
+namespace context {
+
+template <class Key, class Data, class HashFcn>
+class CDTrailHashMap : public ContextObj
+{
+ public:
+  // As for CDHashMap, the key and the data are only visible through const
+  // references; the map breaks the const encapsulation to update the data.
+  using value_type = std::pair<const Key, const Data>;
+
+ private:
+  /** The entries of the map, in insertion order */
+  std::vector<value_type> d_entries;
+
+  /**
+   * The open-addressed index.  Each slot holds one plus the position of an
+   * entry in d_entries, or 0 if it is empty.  The number of slots is a power
+   * of two, and at least twice the number of entries.
+   */
+  std::vector<uint32_t> d_slots;
+
+  /** The base 2 logarithm of the number of slots */
+  unsigned d_slotBits;
+
+  /**
+   * The old values of the entries updated in the current and previous
+   * context levels, with the positions of the entries.
+   */
+  std::vector<std::pair<uint32_t, Data>> d_trail;
+
+  /**
+   * The number of entries when the map was last saved.  The entries from
+   * this position on were inserted at the current level, so their updates
+   * need not be recorded on the trail.
+   */
+  uint32_t d_levelStart;
+
+  /**
+   * The number of entries and the size of the trail when the map was saved.
+   * Only used in the saved copies.
+   */
+  uint32_t d_savedSize;
+  size_t d_savedTrailSize;
+
+  HashFcn d_hashFcn;
+
+  /**
+   * Private copy constructor used only by save().  The entries, the index
+   * and the trail are not copied: only the sizes are needed in restore.
+   */
+  CDTrailHashMap(const CDTrailHashMap& other)
+      : ContextObj(other),
+        d_slotBits(0),
+        d_levelStart(other.d_levelStart),
+        d_savedSize(other.d_entries.size()),
+        d_savedTrailSize(other.d_trail.size())
+  {
+  }
+  CDTrailHashMap& operator=(const CDTrailHashMap&) = delete;
+
+  ContextObj* save(ContextMemoryManager* pCMM) override
+  {
+    ContextObj* data = new (pCMM) CDTrailHashMap(*this);
+    d_levelStart = d_entries.size();
+    Debug("CDTrailHashMap") << "save " << this << " at level "
+                            << getContext()->getLevel() << " size "
+                            << d_entries.size() << " trail " << d_trail.size()
+                            << std::endl;
+    return data;
+  }
+
+ protected:
+  void restore(ContextObj* data) override
+  {
+    CDTrailHashMap* saved = static_cast<CDTrailHashMap*>(data);
+    // Undo the updates, most recent first
+    while (d_trail.size() > saved->d_savedTrailSize)
+    {
+      mutable_data(d_trail.back().first) = d_trail.back().second;
+      d_trail.pop_back();
+    }
+    // Remove the entries inserted since the save
+    while (d_entries.size() > saved->d_savedSize)
+    {
+      d_slots[findSlot(d_entries.back().first)] = 0;
+      d_entries.pop_back();
+    }
+    d_levelStart = saved->d_levelStart;
+    Debug("CDTrailHashMap") << "restore " << this << " level "
+                            << getContext()->getLevel() << " size back to "
+                            << d_entries.size() << std::endl;
+  }
+
+ private:
+  // See documentation of value_type for why this is needed.
+  Data& mutable_data(size_t pos)
+  {
+    return const_cast<Data&>(d_entries[pos].second);
+  }
+
+  /** The first slot of the probe sequence of k */
+  size_t homeSlot(const Key& k) const
+  {
+    // Fibonacci hashing spreads hash functions that are weak in the low bits
+    return static_cast<size_t>(
+        (static_cast<uint64_t>(d_hashFcn(k)) * UINT64_C(0x9e3779b97f4a7c15))
+        >> (64 - d_slotBits));
+  }
+
+  /** The slot that holds k, or the empty slot where k would go */
+  size_t findSlot(const Key& k) const
+  {
+    size_t mask = d_slots.size() - 1;
+    size_t slot = homeSlot(k);
+    while (d_slots[slot] != 0 && !(d_entries[d_slots[slot] - 1].first == k))
+    {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  /** Double the number of slots and reinsert the entries in order */
+  void grow()
+  {
+    ++d_slotBits;
+    d_slots.assign(size_t(1) << d_slotBits, 0);
+    for (size_t i = 0, n = d_entries.size(); i < n; ++i)
+    {
+      d_slots[findSlot(d_entries[i].first)] = i + 1;
+    }
+  }
+
+  /** Insert (k, d) into the map; k must not be in the map */
+  uint32_t insertNew(const Key& k, const Data& d)
+  {
+    makeCurrent();
+    Assert(d_entries.size() < UINT32_MAX);
+    if (2 * (d_entries.size() + 1) > d_slots.size())
+    {
+      grow();
+    }
+    size_t slot = findSlot(k);
+    Assert(d_slots[slot] == 0);
+    d_entries.emplace_back(k, d);
+    d_slots[slot] = d_entries.size();
+    return d_entries.size() - 1;
+  }
+
+  /** Set the data of the entry at pos to d */
+  void set(uint32_t pos, const Data& d)
+  {
+    makeCurrent();
+    if (pos < d_levelStart)
+    {
+      d_trail.emplace_back(pos, d_entries[pos].second);
+    }
+    mutable_data(pos) = d;
+  }
+
+ public:
+  CDTrailHashMap(Context* context)
+      : ContextObj(context),
+        d_slots(16, 0),
+        d_slotBits(4),
+        d_levelStart(0),
+        d_savedSize(0),
+        d_savedTrailSize(0)
+  {
+  }
+
+  ~CDTrailHashMap() { destroy(); }
+
+  /**
+   * A reference to the data of an entry.  Assigning to it updates the
+   * entry in the current context.
+   */
+  class ElementReference
+  {
+    CDTrailHashMap* d_map;
+    uint32_t d_pos;
+
+   public:
+    ElementReference(CDTrailHashMap* map, uint32_t pos)
+        : d_map(map), d_pos(pos)
+    {
+    }
+    ElementReference(const ElementReference&) = default;
+
+    const Data& get() const { return d_map->d_entries[d_pos].second; }
+
+    operator Data() const { return get(); }
+
+    const Data& operator=(const Data& data)
+    {
+      d_map->set(d_pos, data);
+      return data;
+    }
+
+    ElementReference& operator=(const ElementReference& other)
+    {
+      d_map->set(d_pos, other.get());
+      return *this;
+    }
+  }; /* class CDTrailHashMap<>::ElementReference */
+
+  // The usual operators of map
+
+  size_t size() const { return d_entries.size(); }
+
+  bool empty() const { return d_entries.empty(); }
+
+  size_t count(const Key& k) const
+  {
+    return d_slots[findSlot(k)] == 0 ? 0 : 1;
+  }
+
+  // If a key is not present, it is inserted with the data Data()
+  ElementReference operator[](const Key& k)
+  {
+    uint32_t entry = d_slots[findSlot(k)];
+    if (entry == 0)
+    {
+      return ElementReference(this, insertNew(k, Data()));
+    }
+    return ElementReference(this, entry - 1);
+  }
+
+  bool insert(const Key& k, const Data& d)
+  {
+    uint32_t entry = d_slots[findSlot(k)];
+    if (entry == 0)
+    {
+      insertNew(k, d);
+      return true;
+    }
+    set(entry - 1, d);
+    return false;
+  }
+
+  class iterator
+  {
+    const CDTrailHashMap* d_map;
+    size_t d_pos;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename CDTrailHashMap::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    /** The position of end() */
+    static size_t endPos() { return static_cast<size_t>(-1); }
+
+    iterator(const CDTrailHashMap* map, size_t pos) : d_map(map), d_pos(pos) {}
+
+    // Default constructor
+    iterator() : d_map(nullptr), d_pos(endPos()) {}
+
+    // (Dis)equality
+    bool operator==(const iterator& i) const { return d_pos == i.d_pos; }
+    bool operator!=(const iterator& i) const { return d_pos != i.d_pos; }
+
+    // Dereference operators.
+    const value_type& operator*() const { return d_map->d_entries[d_pos]; }
+    const value_type* operator->() const { return &d_map->d_entries[d_pos]; }
+
+    // Prefix increment
+    iterator& operator++()
+    {
+      if (++d_pos == d_map->d_entries.size())
+      {
+        d_pos = endPos();
+      }
+      return *this;
+    }
+
+    // Postfix increment is not yet supported.
+  }; /* class CDTrailHashMap<>::iterator */
+
+  typedef iterator const_iterator;
+
+  iterator begin() const
+  {
+    return iterator(this, d_entries.empty() ? iterator::endPos() : 0);
+  }
+
+  iterator end() const { return iterator(this, iterator::endPos()); }
+
+  iterator find(const Key& k) const
+  {
+    uint32_t entry = d_slots[findSlot(k)];
+    return entry == 0 ? end() : iterator(this, entry - 1);
+  }
+
+}; /* class CDTrailHashMap<> */
+
+}  // namespace context
+}  // namespace CVC4
+
+#endif /* CVC4__CONTEXT__CDTRAIL_HASHMAP_H */
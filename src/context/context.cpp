@@ -15,20 +15,24 @@
  **/
 
 
+#include <chrono>
 #include <iostream>
 #include <vector>
 
 #include "base/check.h"
 #include "context/context.h"
+#include "context/context_profiler.h"
 
 
 namespace CVC4 {
 namespace context {
 
 
-Context::Context() : d_pCNOpre(NULL), d_pCNOpost(NULL) {
+Context::Context(const ContextMemoryConfig& config)
+    : d_pCNOpre(NULL), d_pCNOpost(NULL), d_profiler(NULL)
+{
   // Create new memory manager
-  d_pCMM = new ContextMemoryManager();
+  d_pCMM = new ContextMemoryManager(config);
 
   // Create initial Scope
   d_scopeList.push_back(new(d_pCMM) Scope(this, d_pCMM, 0));
@@ -63,6 +67,11 @@ void Context::push() {
   Trace("pushpop") << std::string(2 * getLevel(), ' ') << "Push [to "
                    << getLevel() + 1 << "] { " << this << std::endl;
 
+  if (d_profiler != NULL)
+  {
+    d_profiler->notifyPush();
+  }
+
   // Create a new memory region
   d_pCMM->push();
 
@@ -242,6 +251,12 @@ void ContextObj::destroy()
   Debug("context") << "before destroy " << this << " (level " << getLevel()
                    << "):" << std::endl << *getContext() << std::endl;
 
+  ContextProfiler* profiler = getContext()->getProfiler();
+  if (profiler != NULL)
+  {
+    profiler->unregisterObject(this);
+  }
+
   for(;;) {
     // If valgrind reports invalid writes on the next few lines,
     // here's a hint: make sure all classes derived from ContextObj in
@@ -275,6 +290,9 @@ ContextObj::ContextObj(Context* pContext) :
   Debug("context") << "create new ContextObj(" << this << " inCMM=false)" << std::endl;
   d_pScope = pContext->getBottomScope();
   d_pScope->addToChain(this);
+  if(pContext->getProfiler() != NULL) {
+    pContext->getProfiler()->registerObject(this);
+  }
 }
 
 
@@ -292,6 +310,9 @@ ContextObj::ContextObj(bool allocatedInCMM, Context* pContext) :
     d_pScope = pContext->getBottomScope();
   }
   d_pScope->addToChain(this);
+  if(pContext->getProfiler() != NULL) {
+    pContext->getProfiler()->registerObject(this);
+  }
 }
 
 void ContextObj::enqueueToGarbageCollect() {
@@ -358,8 +379,29 @@ Scope::~Scope() {
   // Call restore() method on each ContextObj object in the list.
   // Note that it is the responsibility of restore() to return the
   // next item in the list.
-  while (d_pContextObjList != NULL) {
-    d_pContextObjList = d_pContextObjList->restoreAndContinue();
+  ContextProfiler* profiler = d_pContext->getProfiler();
+  if (profiler == NULL)
+  {
+    while (d_pContextObjList != NULL)
+    {
+      d_pContextObjList = d_pContextObjList->restoreAndContinue();
+    }
+  }
+  else
+  {
+    // Same as above, timing each restore
+    size_t restored = 0;
+    while (d_pContextObjList != NULL)
+    {
+      ContextObj* obj = d_pContextObjList;
+      auto start = std::chrono::steady_clock::now();
+      d_pContextObjList = obj->restoreAndContinue();
+      auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start);
+      profiler->recordRestore(obj, nanos.count());
+      ++restored;
+    }
+    profiler->notifyPop(restored);
   }
 
   if (d_garbage) {
@@ -39,6 +39,7 @@ class Context;
 class Scope;
 class ContextObj;
 class ContextNotifyObj;
+class ContextProfiler;
 
 /** Pretty-printing of Contexts (for debugging) */
 std::ostream& operator<<(std::ostream&, const Context&);
@@ -91,6 +92,12 @@ class Context {
    */
   ContextNotifyObj* d_pCNOpost;
 
+  /**
+   * The profiler of the restores of this context, or NULL if the restores
+   * are not profiled.
+   */
+  ContextProfiler* d_profiler;
+
   friend std::ostream& operator<<(std::ostream&, const Context&);
 
   // disable copy, assignment
@@ -145,7 +152,7 @@ public:
   /**
    * Constructor: create ContextMemoryManager and initial Scope
    */
-  Context();
+  explicit Context(const ContextMemoryConfig& config = ContextMemoryConfig());
 
   /**
    * Destructor: pop all scopes, delete ContextMemoryManager
@@ -172,6 +179,18 @@ public:
    */
   ContextMemoryManager* getCMM() { return d_pCMM; }
 
+  /**
+   * Attach a profiler to the context, or detach it if profiler is NULL.
+   * The profiler must outlive the context or be detached first.  Only the
+   * ContextObjs created while the profiler is attached can be tagged.
+   */
+  void setProfiler(ContextProfiler* profiler) { d_profiler = profiler; }
+
+  /**
+   * Return the profiler attached to the context, if any.
+   */
+  ContextProfiler* getProfiler() const { return d_profiler; }
+
   /**
    * Save the current state, create a new Scope
    */
@@ -211,7 +230,11 @@ private:
   UserContext(const UserContext&) = delete;
   UserContext& operator=(const UserContext&) = delete;
 public:
-  UserContext() {}
+  explicit UserContext(
+      const ContextMemoryConfig& config = ContextMemoryConfig())
+      : Context(config)
+  {
+  }
 };/* class UserContext */
 
 
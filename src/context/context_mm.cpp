@@ -15,11 +15,16 @@
  **/
 
 
+#include <cstdint>
 #include <cstdlib>
 #include <vector>
 #include <deque>
 #include <new>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif /* __linux__ */
+
 #ifdef CVC4_VALGRIND
 #include <valgrind/memcheck.h>
 #endif /* CVC4_VALGRIND */
@@ -33,6 +38,99 @@ namespace context {
 
 #ifndef CVC4_DEBUG_CONTEXT_MEMORY_MANAGER
 
+namespace {
+
+/** The size of a transparent huge page */
+const size_t hugePageSize = 2 * 1024 * 1024;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+
+/**
+ * Map size bytes (a multiple of hugePageSize) at an address aligned to
+ * hugePageSize and ask the kernel to back them with huge pages.  Returns
+ * NULL if the mapping fails.
+ */
+char* mapHugePages(size_t size)
+{
+  size_t mapSize = size + hugePageSize;
+  void* map = mmap(NULL,
+                   mapSize,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1,
+                   0);
+  if (map == MAP_FAILED)
+  {
+    return NULL;
+  }
+  char* start = static_cast<char*>(map);
+  char* aligned = reinterpret_cast<char*>(
+      (reinterpret_cast<uintptr_t>(start) + hugePageSize - 1)
+      & ~(hugePageSize - 1));
+  // Give back the unaligned head and tail of the mapping
+  if (aligned > start)
+  {
+    munmap(start, aligned - start);
+  }
+  char* end = start + mapSize;
+  if (end > aligned + size)
+  {
+    munmap(aligned + size, end - (aligned + size));
+  }
+  // This is only advice, the memory is usable either way
+  madvise(aligned, size, MADV_HUGEPAGE);
+  return aligned;
+}
+
+void unmapHugePages(char* p, size_t size) { munmap(p, size); }
+
+#else /* __linux__ && MADV_HUGEPAGE */
+
+char* mapHugePages(size_t size) { return static_cast<char*>(malloc(size)); }
+
+void unmapHugePages(char* p, size_t size) { free(p); }
+
+#endif /* __linux__ && MADV_HUGEPAGE */
+
+/** The chunk size for config */
+size_t chunkSizeFor(const ContextMemoryConfig& config)
+{
+  Assert(config.d_chunkSizeBytes > 0);
+  if (!config.d_useHugePages)
+  {
+    return config.d_chunkSizeBytes;
+  }
+  return (config.d_chunkSizeBytes + hugePageSize - 1) & ~(hugePageSize - 1);
+}
+
+}  // namespace
+
+char* ContextMemoryManager::allocChunk()
+{
+  char* chunk = d_useHugePages ? mapHugePages(d_chunkSizeBytes)
+                               : static_cast<char*>(malloc(d_chunkSizeBytes));
+  if (chunk == NULL)
+  {
+    throw std::bad_alloc();
+  }
+#ifdef CVC4_VALGRIND
+  VALGRIND_MAKE_MEM_NOACCESS(chunk, d_chunkSizeBytes);
+#endif /* CVC4_VALGRIND */
+  return chunk;
+}
+
+void ContextMemoryManager::freeChunk(char* chunk)
+{
+  if (d_useHugePages)
+  {
+    unmapHugePages(chunk, d_chunkSizeBytes);
+  }
+  else
+  {
+    free(chunk);
+  }
+}
+
 void ContextMemoryManager::newChunk() {
 
   // Increment index to chunk list
@@ -42,14 +140,7 @@ void ContextMemoryManager::newChunk() {
 
   // Create new chunk if no free chunk available
   if(d_freeChunks.empty()) {
-    d_chunkList.push_back((char*)malloc(chunkSizeBytes));
-    if(d_chunkList.back() == NULL) {
-      throw std::bad_alloc();
-    }
-
-#ifdef CVC4_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
-#endif /* CVC4_VALGRIND */
+    d_chunkList.push_back(allocChunk());
   }
   // If there is a free chunk, use that
   else {
@@ -58,22 +149,27 @@ void ContextMemoryManager::newChunk() {
   }
   // Set up the current chunk pointers
   d_nextFree = d_chunkList.back();
-  d_endChunk = d_nextFree + chunkSizeBytes;
+  d_endChunk = d_nextFree + d_chunkSizeBytes;
 }
 
 
-ContextMemoryManager::ContextMemoryManager() : d_indexChunkList(0) {
+ContextMemoryManager::ContextMemoryManager(const ContextMemoryConfig& config)
+    : d_chunkSizeBytes(chunkSizeFor(config)),
+      d_maxFreeChunks(config.d_maxFreeChunks),
+      d_useHugePages(config.d_useHugePages),
+      d_indexChunkList(0),
+      d_levelBytes(1, 0),
+      d_levelPeakBytes(1, 0),
+      d_bytesInUse(0),
+      d_peakBytes(0)
+{
   // Create initial chunk
-  d_chunkList.push_back((char*)malloc(chunkSizeBytes));
+  d_chunkList.push_back(allocChunk());
   d_nextFree = d_chunkList.back();
-  if(d_nextFree == NULL) {
-    throw std::bad_alloc();
-  }
-  d_endChunk = d_nextFree + chunkSizeBytes;
+  d_endChunk = d_nextFree + d_chunkSizeBytes;
 
 #ifdef CVC4_VALGRIND
   VALGRIND_CREATE_MEMPOOL(this, 0, false);
-  VALGRIND_MAKE_MEM_NOACCESS(d_nextFree, chunkSizeBytes);
   d_allocations.push_back(std::vector<char*>());
 #endif /* CVC4_VALGRIND */
 }
@@ -86,17 +182,55 @@ ContextMemoryManager::~ContextMemoryManager() {
 
   // Delete all chunks
   while(!d_chunkList.empty()) {
-    free(d_chunkList.back());
+    freeChunk(d_chunkList.back());
     d_chunkList.pop_back();
   }
   while(!d_freeChunks.empty()) {
-    free(d_freeChunks.back());
+    freeChunk(d_freeChunks.back());
     d_freeChunks.pop_back();
   }
+  for (char* block : d_largeAllocs)
+  {
+    free(block);
+  }
+}
+
+
+void* ContextMemoryManager::newLargeData(size_t size)
+{
+  char* res = static_cast<char*>(malloc(size));
+  if (res == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  d_largeAllocs.push_back(res);
+  Debug("context") << "ContextMemoryManager::newData(" << size
+                   << ") returning large block " << static_cast<void*>(res)
+                   << " at level " << d_levelBytes.size() - 1 << std::endl;
+  return res;
 }
 
 
 void* ContextMemoryManager::newData(size_t size) {
+  // Account for the request in the current region
+  d_bytesInUse += size;
+  if (d_bytesInUse > d_peakBytes)
+  {
+    d_peakBytes = d_bytesInUse;
+  }
+  uint64_t& levelBytes = d_levelBytes.back();
+  levelBytes += size;
+  uint64_t& levelPeak = d_levelPeakBytes[d_levelBytes.size() - 1];
+  if (levelBytes > levelPeak)
+  {
+    levelPeak = levelBytes;
+  }
+
+  if (size > d_chunkSizeBytes)
+  {
+    return newLargeData(size);
+  }
+
   // Use next available free location in current chunk
   void* res = (void*)d_nextFree;
   d_nextFree += size;
@@ -130,6 +264,14 @@ void ContextMemoryManager::push() {
   d_nextFreeStack.push_back(d_nextFree);
   d_endChunkStack.push_back(d_endChunk);
   d_indexChunkListStack.push_back(d_indexChunkList);
+  d_largeAllocsStack.push_back(d_largeAllocs.size());
+
+  // Start the accounting of the new region
+  d_levelBytes.push_back(0);
+  if (d_levelPeakBytes.size() < d_levelBytes.size())
+  {
+    d_levelPeakBytes.push_back(0);
+  }
 }
 
 
@@ -154,16 +296,27 @@ void ContextMemoryManager::pop() {
   while(d_indexChunkList > d_indexChunkListStack.back()) {
     d_freeChunks.push_back(d_chunkList.back());
 #ifdef CVC4_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), chunkSizeBytes);
+    VALGRIND_MAKE_MEM_NOACCESS(d_chunkList.back(), d_chunkSizeBytes);
 #endif /* CVC4_VALGRIND */
     d_chunkList.pop_back();
     --d_indexChunkList;
   }
   d_indexChunkListStack.pop_back();
 
+  // Free the large blocks of the region in bulk
+  while (d_largeAllocs.size() > d_largeAllocsStack.back())
+  {
+    free(d_largeAllocs.back());
+    d_largeAllocs.pop_back();
+  }
+  d_largeAllocsStack.pop_back();
+
+  d_bytesInUse -= d_levelBytes.back();
+  d_levelBytes.pop_back();
+
   // Delete excess free chunks
-  while(d_freeChunks.size() > maxFreeChunks) {
-    free(d_freeChunks.front());
+  while(d_freeChunks.size() > d_maxFreeChunks) {
+    freeChunk(d_freeChunks.front());
     d_freeChunks.pop_front();
   }
 }
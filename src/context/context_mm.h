@@ -20,6 +20,8 @@
 #ifndef CVC4__CONTEXT__CONTEXT_MM_H
 #define CVC4__CONTEXT__CONTEXT_MM_H
 
+#include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <limits>
 #include <vector>
@@ -27,6 +29,28 @@
 namespace CVC4 {
 namespace context {
 
+/**
+ * Configuration of a ContextMemoryManager.
+ */
+struct ContextMemoryConfig
+{
+  ContextMemoryConfig()
+      : d_chunkSizeBytes(16384), d_maxFreeChunks(100), d_useHugePages(false)
+  {
+  }
+
+  /** The size of the chunks that regions are carved from */
+  size_t d_chunkSizeBytes;
+  /** The maximum number of free chunks kept for reuse */
+  size_t d_maxFreeChunks;
+  /**
+   * Back the chunks with transparent huge pages.  The chunk size is then
+   * rounded up to a multiple of the huge page size.  Ignored on systems
+   * without madvise(MADV_HUGEPAGE).
+   */
+  bool d_useHugePages;
+}; /* struct ContextMemoryConfig */
+
 #ifndef CVC4_DEBUG_CONTEXT_MEMORY_MANAGER
 
 /**
@@ -38,19 +62,27 @@ namespace context {
  * stack, and a new current region is created.  A subsequent call to pop
  * releases the new region and restores the top region from the stack.
  *
+ * Requests larger than a chunk get a block of their own.  These blocks are
+ * recorded with the region and are all freed when the region is popped.
+ *
  */
 class ContextMemoryManager {
 
   /**
    * Memory in regions is allocated in chunks.  This is the chunk size
    */
-  static const unsigned chunkSizeBytes = 16384;
+  const size_t d_chunkSizeBytes;
 
   /**
    * A list of free chunks is maintained.  This is the maximum number of
    * free chunks.
    */
-  static const unsigned maxFreeChunks = 100;
+  const size_t d_maxFreeChunks;
+
+  /**
+   * Whether the chunks are mapped with huge pages
+   */
+  const bool d_useHugePages;
 
   /**
    * List of all chunks that are currently active
@@ -97,6 +129,37 @@ class ContextMemoryManager {
    */
   std::vector<unsigned> d_indexChunkListStack;
 
+  /**
+   * Blocks of the requests larger than a chunk, in allocation order
+   */
+  std::vector<char*> d_largeAllocs;
+
+  /**
+   * Part of the stack of saved regions.  This vector stores the saved size
+   * of d_largeAllocs
+   */
+  std::vector<size_t> d_largeAllocsStack;
+
+  /**
+   * The number of bytes requested in each region, the current region last
+   */
+  std::vector<uint64_t> d_levelBytes;
+
+  /**
+   * The largest number of bytes ever requested in a region at each level
+   */
+  std::vector<uint64_t> d_levelPeakBytes;
+
+  /**
+   * The number of bytes requested in all regions
+   */
+  uint64_t d_bytesInUse;
+
+  /**
+   * The largest value of d_bytesInUse so far
+   */
+  uint64_t d_peakBytes;
+
   /**
    * Private method to grab a new chunk for the current region.  Uses chunk
    * from d_freeChunks if available.  Creates a new one otherwise.  Sets the
@@ -104,6 +167,17 @@ class ContextMemoryManager {
    */
   void newChunk();
 
+  /**
+   * Allocate and release the memory of a chunk.
+   */
+  char* allocChunk();
+  void freeChunk(char* chunk);
+
+  /**
+   * Allocate a block of its own for a request larger than a chunk.
+   */
+  void* newLargeData(size_t size);
+
 #ifdef CVC4_VALGRIND
   /**
    * Vector of allocations for each level. Used for accurately marking
@@ -114,16 +188,19 @@ class ContextMemoryManager {
 
  public:
   /**
-   * Get the maximum allocation size for this memory manager.
+   * Get the maximum allocation size for this memory manager.  Requests of
+   * any size are served, large ones outside of the chunks.
    */
-  static unsigned getMaxAllocationSize() {
-    return chunkSizeBytes;
+  static unsigned getMaxAllocationSize()
+  {
+    return std::numeric_limits<unsigned>::max();
   }
 
   /**
    * Constructor - creates an initial region and an empty stack
    */
-  ContextMemoryManager();
+  explicit ContextMemoryManager(
+      const ContextMemoryConfig& config = ContextMemoryConfig());
 
   /**
    * Destructor - deletes all memory in all regions
@@ -146,6 +223,35 @@ class ContextMemoryManager {
    */
   void pop();
 
+  /**
+   * Get the chunk size, after rounding for huge pages.
+   */
+  size_t getChunkSize() const { return d_chunkSizeBytes; }
+
+  /**
+   * Get the number of bytes requested in all live regions.
+   */
+  const uint64_t& getBytesInUse() const { return d_bytesInUse; }
+
+  /**
+   * Get the largest number of bytes ever requested in all live regions.
+   */
+  const uint64_t& getPeakBytes() const { return d_peakBytes; }
+
+  /**
+   * Get the largest number of bytes ever requested in a region, indexed by
+   * the level of the region.
+   */
+  const std::vector<uint64_t>& getPeakLevelBytes() const
+  {
+    return d_levelPeakBytes;
+  }
+
+  /**
+   * Get the number of live blocks of requests larger than a chunk.
+   */
+  size_t getNumLargeAllocations() const { return d_largeAllocs.size(); }
+
 };/* class ContextMemoryManager */
 
 #else /* CVC4_DEBUG_CONTEXT_MEMORY_MANAGER */
@@ -166,7 +272,14 @@ class ContextMemoryManager
     return std::numeric_limits<unsigned>::max();
   }
 
-  ContextMemoryManager() { d_allocations.push_back(std::vector<char*>()); }
+  explicit ContextMemoryManager(
+      const ContextMemoryConfig& config = ContextMemoryConfig())
+      : d_bytesInUse(0), d_peakBytes(0)
+  {
+    d_allocations.push_back(std::vector<char*>());
+    d_levelBytes.push_back(0);
+    d_levelPeakBytes.push_back(0);
+  }
   ~ContextMemoryManager()
   {
     for (const auto& levelAllocs : d_allocations)
@@ -182,10 +295,23 @@ class ContextMemoryManager
   {
     void* alloc = malloc(size);
     d_allocations.back().push_back(static_cast<char*>(alloc));
+    d_bytesInUse += size;
+    d_peakBytes = std::max(d_peakBytes, d_bytesInUse);
+    d_levelBytes.back() += size;
+    uint64_t& levelPeak = d_levelPeakBytes[d_levelBytes.size() - 1];
+    levelPeak = std::max(levelPeak, d_levelBytes.back());
     return alloc;
   }
 
-  void push() { d_allocations.push_back(std::vector<char*>()); }
+  void push()
+  {
+    d_allocations.push_back(std::vector<char*>());
+    d_levelBytes.push_back(0);
+    if (d_levelPeakBytes.size() < d_levelBytes.size())
+    {
+      d_levelPeakBytes.push_back(0);
+    }
+  }
 
   void pop()
   {
@@ -194,10 +320,25 @@ class ContextMemoryManager
       free(alloc);
     }
     d_allocations.pop_back();
+    d_bytesInUse -= d_levelBytes.back();
+    d_levelBytes.pop_back();
+  }
+
+  size_t getChunkSize() const { return 0; }
+  const uint64_t& getBytesInUse() const { return d_bytesInUse; }
+  const uint64_t& getPeakBytes() const { return d_peakBytes; }
+  const std::vector<uint64_t>& getPeakLevelBytes() const
+  {
+    return d_levelPeakBytes;
   }
+  size_t getNumLargeAllocations() const { return 0; }
 
  private:
   std::vector<std::vector<char*>> d_allocations;
+  std::vector<uint64_t> d_levelBytes;
+  std::vector<uint64_t> d_levelPeakBytes;
+  uint64_t d_bytesInUse;
+  uint64_t d_peakBytes;
 }; /* ContextMemoryManager */
 
 #endif /* CVC4_DEBUG_CONTEXT_MEMORY_MANAGER */
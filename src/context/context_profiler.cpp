@@ -0,0 +1,188 @@
+/*********************                                                        */
+/*! \file context_profiler.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Attribution of the cost of backtracking to context objects
+ **
+ ** Attribution of the cost of backtracking to context objects.
+ **/
+
+#include "context/context_profiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+#include "context/context.h"
+#include "util/safe_print.h"
+
+namespace CVC4 {
+namespace context {
+
+namespace {
+
+/** The demangled name of a class, when the compiler lets us demangle it */
+std::string className(const std::type_info& info)
+{
+#ifdef __GNUG__
+  int status = 0;
+  char* name = abi::__cxa_demangle(info.name(), nullptr, nullptr, &status);
+  if (status == 0 && name != nullptr)
+  {
+    std::string result(name);
+    std::free(name);
+    return result;
+  }
+#endif
+  return info.name();
+}
+
+}  // namespace
+
+ContextProfiler::ContextProfiler() : d_trace(nullptr) {}
+
+ContextProfiler::Tag::Tag(Context* context, const std::string& name)
+    : d_profiler(context->getProfiler())
+{
+  if (d_profiler != nullptr)
+  {
+    d_profiler->d_tagStack.push_back(d_profiler->getTagId(name));
+  }
+}
+
+ContextProfiler::Tag::~Tag()
+{
+  if (d_profiler != nullptr)
+  {
+    d_profiler->d_tagStack.pop_back();
+  }
+}
+
+uint32_t ContextProfiler::getTagId(const std::string& name)
+{
+  auto it = d_tagIds.find(name);
+  if (it != d_tagIds.end())
+  {
+    return it->second;
+  }
+  uint32_t id = d_tagNames.size();
+  d_tagNames.push_back(name);
+  d_tagIds[name] = id;
+  d_restores.push_back(0);
+  d_nanos.push_back(0);
+  return id;
+}
+
+void ContextProfiler::registerObject(const ContextObj* obj)
+{
+  if (!d_tagStack.empty())
+  {
+    d_objectTags[obj] = d_tagStack.back();
+  }
+}
+
+void ContextProfiler::unregisterObject(const ContextObj* obj)
+{
+  d_objectTags.erase(obj);
+}
+
+void ContextProfiler::notifyPush()
+{
+  if (d_trace != nullptr)
+  {
+    *d_trace << "push\n";
+  }
+}
+
+void ContextProfiler::recordRestore(const ContextObj* obj, uint64_t nanos)
+{
+  uint32_t tag;
+  auto it = d_objectTags.find(obj);
+  if (it != d_objectTags.end())
+  {
+    tag = it->second;
+  }
+  else
+  {
+    // The dynamic type of an object is only known once it is constructed,
+    // so untagged objects are classified on their first restore.
+    std::type_index type(typeid(*obj));
+    auto cit = d_classTags.find(type);
+    if (cit == d_classTags.end())
+    {
+      cit = d_classTags.emplace(type, getTagId(className(typeid(*obj)))).first;
+    }
+    tag = cit->second;
+  }
+  ++d_restores[tag];
+  d_nanos[tag] += nanos;
+}
+
+void ContextProfiler::notifyPop(size_t restored)
+{
+  if (d_trace != nullptr)
+  {
+    *d_trace << "pop " << restored << "\n";
+  }
+}
+
+void ContextProfiler::print(std::ostream& out) const
+{
+  std::vector<uint32_t> tags;
+  for (uint32_t i = 0, n = d_tagNames.size(); i < n; ++i)
+  {
+    if (d_restores[i] > 0)
+    {
+      tags.push_back(i);
+    }
+  }
+  std::sort(tags.begin(), tags.end(), [this](uint32_t a, uint32_t b) {
+    return d_nanos[a] > d_nanos[b];
+  });
+  out << "[";
+  for (size_t i = 0; i < tags.size(); ++i)
+  {
+    out << (i == 0 ? "(" : ", (") << d_tagNames[tags[i]] << " : "
+        << d_restores[tags[i]] << ", " << d_nanos[tags[i]] << ")";
+  }
+  out << "]";
+}
+
+void ContextProfiler::safePrint(int fd) const
+{
+  bool first = true;
+  safe_print(fd, "[");
+  for (uint32_t i = 0, n = d_tagNames.size(); i < n; ++i)
+  {
+    if (d_restores[i] == 0)
+    {
+      continue;
+    }
+    if (!first)
+    {
+      safe_print(fd, ", ");
+    }
+    safe_print(fd, "(");
+    safe_print<std::string>(fd, d_tagNames[i]);
+    safe_print(fd, " : ");
+    safe_print<uint64_t>(fd, d_restores[i]);
+    safe_print(fd, ", ");
+    safe_print<uint64_t>(fd, d_nanos[i]);
+    safe_print(fd, ")");
+    first = false;
+  }
+  safe_print(fd, "]");
+}
+
+}  // namespace context
+}  // namespace CVC4
@@ -0,0 +1,108 @@
+/*********************                                                        */
+/*! \file context_profiler.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Attribution of the cost of backtracking to context objects
+ **
+ ** A ContextProfiler attached to a Context times the restore of every
+ ** ContextObj on pop() and charges it to the tag of the object.  Objects are
+ ** tagged when they are created inside a ContextProfiler::Tag scope; the
+ ** others are charged to their class.  The profiler can also write the
+ ** push/pop trace of the context, for replay by the context benchmarks.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__CONTEXT__CONTEXT_PROFILER_H
+#define CVC4__CONTEXT__CONTEXT_PROFILER_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace CVC4 {
+namespace context {
+
+class Context;
+class ContextObj;
+
+class ContextProfiler
+{
+ public:
+  ContextProfiler();
+
+  /**
+   * Tags the ContextObjs created in context during the lifetime of this
+   * object with name.  Tags nest, the innermost one wins.  Does nothing if
+   * no profiler is attached to context.
+   */
+  class Tag
+  {
+   public:
+    Tag(Context* context, const std::string& name);
+    ~Tag();
+
+   private:
+    ContextProfiler* d_profiler;
+  }; /* class ContextProfiler::Tag */
+
+  /**
+   * Write the push/pop trace to out, or stop writing it if out is null.
+   * The trace has one line per push ("push") and one per pop ("pop N", with
+   * N the number of objects restored by the pop).
+   */
+  void setTraceStream(std::ostream* out) { d_trace = out; }
+
+  /**
+   * Print the number of restores and the restore time of each tag as a list
+   * of (tag : restores, nanoseconds) pairs, the most expensive tag first.
+   */
+  void print(std::ostream& out) const;
+
+  /** Like print(), unsorted and safe to use in a signal handler. */
+  void safePrint(int fd) const;
+
+  /** Called by ContextObj on creation and destruction */
+  void registerObject(const ContextObj* obj);
+  void unregisterObject(const ContextObj* obj);
+
+  /** Called by Context and Scope on push, restore and pop */
+  void notifyPush();
+  void recordRestore(const ContextObj* obj, uint64_t nanos);
+  void notifyPop(size_t restored);
+
+ private:
+  /** The id of the tag name, creating it if necessary */
+  uint32_t getTagId(const std::string& name);
+
+  /** The names of the tags, indexed by tag id */
+  std::vector<std::string> d_tagNames;
+  /** The ids of the tags, by name */
+  std::unordered_map<std::string, uint32_t> d_tagIds;
+  /** The restore counts and times, indexed by tag id */
+  std::vector<uint64_t> d_restores;
+  std::vector<uint64_t> d_nanos;
+
+  /** The open Tag scopes, innermost last */
+  std::vector<uint32_t> d_tagStack;
+  /** The tags of the objects created inside a Tag scope */
+  std::unordered_map<const ContextObj*, uint32_t> d_objectTags;
+  /** The tags of the classes of the untagged objects */
+  std::unordered_map<std::type_index, uint32_t> d_classTags;
+
+  /** Where to write the push/pop trace, if anywhere */
+  std::ostream* d_trace;
+}; /* class ContextProfiler */
+
+}  // namespace context
+}  // namespace CVC4
+
+#endif /* CVC4__CONTEXT__CONTEXT_PROFILER_H */
@@ -50,6 +50,12 @@ void AttributeManager::deleteAllAttributes(NodeValue* nv) {
   deleteFromTable(d_nodes, nv);
   deleteFromTable(d_types, nv);
   deleteFromTable(d_strings, nv);
+  d_denseBools.erase(nv);
+  d_denseInts.erase(nv);
+  d_denseTNodes.erase(nv);
+  d_denseNodes.erase(nv);
+  d_denseTypes.erase(nv);
+  d_denseStrings.erase(nv);
 }
 
 void AttributeManager::deleteAllAttributes() {
@@ -59,6 +65,19 @@ void AttributeManager::deleteAllAttributes() {
   deleteAllFromTable(d_nodes);
   deleteAllFromTable(d_types);
   deleteAllFromTable(d_strings);
+  deleteAllFromTable(d_denseBools);
+  deleteAllFromTable(d_denseInts);
+  deleteAllFromTable(d_denseTNodes);
+  deleteAllFromTable(d_denseNodes);
+  deleteAllFromTable(d_denseTypes);
+  deleteAllFromTable(d_denseStrings);
+}
+
+size_t AttributeManager::denseBytesReserved() const
+{
+  return d_denseBools.bytesReserved() + d_denseInts.bytesReserved()
+         + d_denseTNodes.bytesReserved() + d_denseNodes.bytesReserved()
+         + d_denseTypes.bytesReserved() + d_denseStrings.bytesReserved();
 }
 
 void AttributeManager::deleteAttributes(const AttrIdVec& atids) {
@@ -96,6 +115,24 @@ void AttributeManager::deleteAttributes(const AttrIdVec& atids) {
     case AttrTableString:
       deleteAttributesFromTable(d_strings, ids);
       break;
+    case AttrTableDenseBool:
+      deleteAttributesFromTable(d_denseBools, ids);
+      break;
+    case AttrTableDenseUInt64:
+      deleteAttributesFromTable(d_denseInts, ids);
+      break;
+    case AttrTableDenseTNode:
+      deleteAttributesFromTable(d_denseTNodes, ids);
+      break;
+    case AttrTableDenseNode:
+      deleteAttributesFromTable(d_denseNodes, ids);
+      break;
+    case AttrTableDenseTypeNode:
+      deleteAttributesFromTable(d_denseTypes, ids);
+      break;
+    case AttrTableDenseString:
+      deleteAttributesFromTable(d_denseStrings, ids);
+      break;
 
     case AttrTableCDBool:
     case AttrTableCDUInt64:
@@ -57,6 +57,13 @@ class AttributeManager {
   template <class T>
   void reconstructTable(AttrHash<T>& table);
 
+  template <class T>
+  void deleteAllFromTable(DenseAttrTable<T>& table);
+
+  template <class T>
+  void deleteAttributesFromTable(DenseAttrTable<T>& table,
+                                 const std::vector<uint64_t>& ids);
+
   /**
    * getTable<> is a helper template that gets the right table from an
    * AttributeManager given its type.
@@ -64,6 +71,10 @@ class AttributeManager {
   template <class T, bool context_dep, class Enable>
   friend struct getTable;
 
+  /** Likewise for the dense tables. */
+  template <class T, class Enable>
+  friend struct getDenseTable;
+
   bool d_inGarbageCollection;
 
   void clearDeleteAllAttributesBuffer();
@@ -89,6 +100,22 @@ public:
   /** Underlying hash table for string-valued attributes */
   AttrHash<std::string> d_strings;
 
+  /** Underlying dense table for boolean-valued attributes */
+  DenseAttrTable<bool> d_denseBools;
+  /** Underlying dense table for integral-valued attributes */
+  DenseAttrTable<uint64_t> d_denseInts;
+  /** Underlying dense table for node-valued attributes */
+  DenseAttrTable<TNode> d_denseTNodes;
+  /** Underlying dense table for node-valued attributes */
+  DenseAttrTable<Node> d_denseNodes;
+  /** Underlying dense table for types attributes */
+  DenseAttrTable<TypeNode> d_denseTypes;
+  /** Underlying dense table for string-valued attributes */
+  DenseAttrTable<std::string> d_denseStrings;
+
+  /** The number of bytes allocated for pages of the dense tables. */
+  size_t denseBytesReserved() const;
+
   /**
    * Get a particular attribute on a particular node.
    *
@@ -281,6 +308,171 @@ struct getTable<std::string, false> {
   }
 };
 
+/**
+ * The getDenseTable<> template provides (static) access to the
+ * AttributeManager field holding the dense table for a value type.
+ */
+template <class T, class Enable = void>
+struct getDenseTable;
+
+/** Access the "d_denseBools" member of AttributeManager. */
+template <>
+struct getDenseTable<bool> {
+  static const AttrTableId id = AttrTableDenseBool;
+  typedef DenseAttrTable<bool> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseBools;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseBools;
+  }
+};
+
+/** Access the "d_denseInts" member of AttributeManager. */
+template <class T>
+struct getDenseTable<
+    T,
+    // Use this specialization only for unsigned integers
+    typename std::enable_if<std::is_unsigned<T>::value>::type>
+{
+  static const AttrTableId id = AttrTableDenseUInt64;
+  typedef DenseAttrTable<uint64_t> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseInts;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseInts;
+  }
+};
+
+/** Access the "d_denseTNodes" member of AttributeManager. */
+template <>
+struct getDenseTable<TNode> {
+  static const AttrTableId id = AttrTableDenseTNode;
+  typedef DenseAttrTable<TNode> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseTNodes;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseTNodes;
+  }
+};
+
+/** Access the "d_denseNodes" member of AttributeManager. */
+template <>
+struct getDenseTable<Node> {
+  static const AttrTableId id = AttrTableDenseNode;
+  typedef DenseAttrTable<Node> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseNodes;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseNodes;
+  }
+};
+
+/** Access the "d_denseTypes" member of AttributeManager. */
+template <>
+struct getDenseTable<TypeNode> {
+  static const AttrTableId id = AttrTableDenseTypeNode;
+  typedef DenseAttrTable<TypeNode> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseTypes;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseTypes;
+  }
+};
+
+/** Access the "d_denseStrings" member of AttributeManager. */
+template <>
+struct getDenseTable<std::string> {
+  static const AttrTableId id = AttrTableDenseString;
+  typedef DenseAttrTable<std::string> table_type;
+  static inline table_type& get(AttributeManager& am) {
+    return am.d_denseStrings;
+  }
+  static inline const table_type& get(const AttributeManager& am) {
+    return am.d_denseStrings;
+  }
+};
+
+/**
+ * The AttrTableAccess<> template looks up and stores attribute values in
+ * the table selected by the storage policy of AttrKind.  Values are in
+ * the table's representation, see KindValueToTableValueMapping.
+ */
+template <class AttrKind, bool dense = AttrKind::storage_policy::dense>
+struct AttrTableAccess;
+
+/** Access to attributes stored in an AttrHash. */
+template <class AttrKind>
+struct AttrTableAccess<AttrKind, false>
+{
+  typedef getTable<typename AttrKind::value_type, AttrKind::context_dependent>
+      table_getter;
+  typedef typename table_getter::table_type table_type;
+  typedef typename KindValueToTableValueMapping<
+      typename AttrKind::value_type>::table_value_type table_value_type;
+
+  static const AttrTableId id = table_getter::id;
+
+  /** Get the value of AttrKind for nv; false if it is not set. */
+  static inline bool get(const AttributeManager& am,
+                         NodeValue* nv,
+                         table_value_type& ret)
+  {
+    const table_type& ah = table_getter::get(am);
+    typename table_type::const_iterator i =
+        ah.find(std::make_pair(AttrKind::getId(), nv));
+    if (i == ah.end())
+    {
+      return false;
+    }
+    ret = (*i).second;
+    return true;
+  }
+
+  /** Set the value of AttrKind for nv. */
+  static inline void set(AttributeManager& am,
+                         NodeValue* nv,
+                         const table_value_type& value)
+  {
+    table_getter::get(am)[std::make_pair(AttrKind::getId(), nv)] = value;
+  }
+};
+
+/** Access to attributes stored in a DenseAttrTable. */
+template <class AttrKind>
+struct AttrTableAccess<AttrKind, true>
+{
+  typedef getDenseTable<typename AttrKind::value_type> table_getter;
+  typedef typename KindValueToTableValueMapping<
+      typename AttrKind::value_type>::table_value_type table_value_type;
+
+  static const AttrTableId id = table_getter::id;
+
+  static inline bool get(const AttributeManager& am,
+                         NodeValue* nv,
+                         table_value_type& ret)
+  {
+    typename table_getter::table_type::value_type v{};
+    if (!table_getter::get(am).get(AttrKind::getId(), nv, v))
+    {
+      return false;
+    }
+    ret = v;
+    return true;
+  }
+
+  static inline void set(AttributeManager& am,
+                         NodeValue* nv,
+                         const table_value_type& value)
+  {
+    table_getter::get(am).set(AttrKind::getId(), nv, value);
+  }
+};
+
 }/* CVC4::expr::attr namespace */
 
 // ATTRIBUTE MANAGER IMPLEMENTATIONS ===========================================
@@ -293,19 +485,15 @@ typename AttrKind::value_type
 AttributeManager::getAttribute(NodeValue* nv, const AttrKind&) const {
   typedef typename AttrKind::value_type value_type;
   typedef KindValueToTableValueMapping<value_type> mapping;
-  typedef typename getTable<value_type, AttrKind::context_dependent>::
-            table_type table_type;
-
-  const table_type& ah =
-    getTable<value_type, AttrKind::context_dependent>::get(*this);
-  typename table_type::const_iterator i =
-    ah.find(std::make_pair(AttrKind::getId(), nv));
+  typedef AttrTableAccess<AttrKind> access;
 
-  if(i == ah.end()) {
+  typename access::table_value_type v{};
+  if (!access::get(*this, nv, v))
+  {
     return typename AttrKind::value_type();
   }
 
-  return mapping::convertBack((*i).second);
+  return mapping::convertBack(v);
 }
 
 /* Helper template class for hasAttribute(), specialized based on
@@ -335,19 +523,14 @@ struct HasAttribute<true, AttrKind> {
                                   typename AttrKind::value_type& ret) {
     typedef typename AttrKind::value_type value_type;
     typedef KindValueToTableValueMapping<value_type> mapping;
-    typedef typename getTable<value_type,
-                              AttrKind::context_dependent>::table_type
-      table_type;
+    typedef AttrTableAccess<AttrKind> access;
 
-    const table_type& ah =
-      getTable<value_type, AttrKind::context_dependent>::get(*am);
-    typename table_type::const_iterator i =
-      ah.find(std::make_pair(AttrKind::getId(), nv));
-
-    if(i == ah.end()) {
+    typename access::table_value_type v{};
+    if (!access::get(*am, nv, v))
+    {
       ret = AttrKind::default_value;
     } else {
-      ret = mapping::convertBack((*i).second);
+      ret = mapping::convertBack(v);
     }
 
     return true;
@@ -362,21 +545,10 @@ template <class AttrKind>
 struct HasAttribute<false, AttrKind> {
   static inline bool hasAttribute(const AttributeManager* am,
                                   NodeValue* nv) {
-    typedef typename AttrKind::value_type value_type;
-    //typedef KindValueToTableValueMapping<value_type> mapping;
-    typedef typename getTable<value_type, AttrKind::context_dependent>::
-              table_type table_type;
-
-    const table_type& ah =
-      getTable<value_type, AttrKind::context_dependent>::get(*am);
-    typename table_type::const_iterator i =
-      ah.find(std::make_pair(AttrKind::getId(), nv));
-
-    if(i == ah.end()) {
-      return false;
-    }
+    typedef AttrTableAccess<AttrKind> access;
 
-    return true;
+    typename access::table_value_type v{};
+    return access::get(*am, nv, v);
   }
 
   static inline bool getAttribute(const AttributeManager* am,
@@ -384,19 +556,15 @@ struct HasAttribute<false, AttrKind> {
                                   typename AttrKind::value_type& ret) {
     typedef typename AttrKind::value_type value_type;
     typedef KindValueToTableValueMapping<value_type> mapping;
-    typedef typename getTable<value_type, AttrKind::context_dependent>::
-              table_type table_type;
-
-    const table_type& ah =
-      getTable<value_type, AttrKind::context_dependent>::get(*am);
-    typename table_type::const_iterator i =
-      ah.find(std::make_pair(AttrKind::getId(), nv));
+    typedef AttrTableAccess<AttrKind> access;
 
-    if(i == ah.end()) {
+    typename access::table_value_type v{};
+    if (!access::get(*am, nv, v))
+    {
       return false;
     }
 
-    ret = mapping::convertBack((*i).second);
+    ret = mapping::convertBack(v);
 
     return true;
   }
@@ -424,12 +592,8 @@ AttributeManager::setAttribute(NodeValue* nv,
                                const typename AttrKind::value_type& value) {
   typedef typename AttrKind::value_type value_type;
   typedef KindValueToTableValueMapping<value_type> mapping;
-  typedef typename getTable<value_type, AttrKind::context_dependent>::
-            table_type table_type;
 
-  table_type& ah =
-      getTable<value_type, AttrKind::context_dependent>::get(*this);
-  ah[std::make_pair(AttrKind::getId(), nv)] = mapping::convert(value);
+  AttrTableAccess<AttrKind>::set(*this, nv, mapping::convert(value));
 }
 
 /** Search for the NodeValue in all attribute tables and remove it. */
@@ -454,11 +618,19 @@ inline void AttributeManager::deleteAllFromTable(AttrHash<T>& table) {
   Assert(!d_inGarbageCollection);
 }
 
+/** Remove all attributes from the dense table. */
+template <class T>
+inline void AttributeManager::deleteAllFromTable(DenseAttrTable<T>& table)
+{
+  Assert(!d_inGarbageCollection);
+  d_inGarbageCollection = true;
+  table.clear();
+  d_inGarbageCollection = false;
+}
+
 template <class AttrKind>
 AttributeUniqueId AttributeManager::getAttributeId(const AttrKind& attr){
-  typedef typename AttrKind::value_type value_type;
-  AttrTableId tableId = getTable<value_type,
-                                 AttrKind::context_dependent>::id;
+  AttrTableId tableId = AttrTableAccess<AttrKind>::id;
   return AttributeUniqueId(tableId, attr.getId());
 }
 
@@ -493,6 +665,18 @@ void AttributeManager::deleteAttributesFromTable(AttrHash<T>& table, const std::
   }
 }
 
+template <class T>
+void AttributeManager::deleteAttributesFromTable(
+    DenseAttrTable<T>& table, const std::vector<uint64_t>& ids)
+{
+  d_inGarbageCollection = true;
+  for (uint64_t id : ids)
+  {
+    table.clear(id);
+  }
+  d_inGarbageCollection = false;
+}
+
 template <class T>
 void AttributeManager::reconstructTable(AttrHash<T>& table){
   d_inGarbageCollection = true;
@@ -23,8 +23,11 @@
 #ifndef CVC4__EXPR__ATTRIBUTE_INTERNALS_H
 #define CVC4__EXPR__ATTRIBUTE_INTERNALS_H
 
+#include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace CVC4 {
 namespace expr {
@@ -366,15 +369,331 @@ public:
 
 }/* CVC4::expr::attr namespace */
 
+// DENSE ATTRIBUTE TABLES ======================================================
+
+namespace attr {
+
+/**
+ * Storage policy for attributes kept in the AttrHash table of their
+ * value type.  This is the default, and the right choice for attributes
+ * that are set on few nodes.
+ */
+struct AttrStorageHash
+{
+  static const bool dense = false;
+};
+
+/**
+ * Storage policy for attributes kept in a DenseAttrTable column, i.e.,
+ * in an array indexed by node id.  This is meant for attributes that are
+ * set on most nodes and read on hot paths (rewrite caches, types).
+ */
+struct AttrStorageDense
+{
+  static const bool dense = true;
+};
+
+/**
+ * A "DenseAttrTable<value_type>" stores one column per attribute kind.  A
+ * column is an array of pages indexed by NodeValue::getId(); each page
+ * holds the values of kPageSize consecutive node ids and a bitmap
+ * recording which of them are set.  Pages are allocated on the first
+ * setAttribute() falling into them, and freed when the last of their
+ * nodes is erased.
+ *
+ * Node ids are never reused, so a lookup is two array accesses and a bit
+ * test, and neighbouring nodes share cache lines.
+ */
+template <class T>
+class DenseAttrTable
+{
+ public:
+  typedef T value_type;
+
+  /** log2 of the number of node ids covered by one page */
+  static const uint64_t kPageBits = 10;
+  /** The number of node ids covered by one page */
+  static const uint64_t kPageSize = uint64_t(1) << kPageBits;
+
+  /**
+   * Get the value of attribute `id` for `nv`.  Returns false (and leaves
+   * `ret` alone) if it is not set.
+   */
+  bool get(uint64_t id, const NodeValue* nv, value_type& ret) const
+  {
+    const Page* page = getPage(id, nv->getId());
+    if (page == nullptr)
+    {
+      return false;
+    }
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    if (!(page->d_present[i >> 6] & GetBitSet(i & 63)))
+    {
+      return false;
+    }
+    ret = page->d_values[i];
+    return true;
+  }
+
+  /** Set the value of attribute `id` for `nv`. */
+  void set(uint64_t id, const NodeValue* nv, const value_type& value)
+  {
+    Page* page = getOrMakePage(id, nv->getId());
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    if (!(page->d_present[i >> 6] & GetBitSet(i & 63)))
+    {
+      page->d_present[i >> 6] |= GetBitSet(i & 63);
+      ++page->d_count;
+    }
+    page->d_values[i] = value;
+  }
+
+  /** Remove the value of every attribute in this table from `nv`. */
+  void erase(const NodeValue* nv)
+  {
+    const uint64_t p = nv->getId() >> kPageBits;
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    for (uint64_t id : d_used)
+    {
+      Column& column = d_columns[id];
+      if (p < column.size() && column[p] != nullptr
+          && (column[p]->d_present[i >> 6] & GetBitSet(i & 63)))
+      {
+        if (--column[p]->d_count == 0)
+        {
+          column[p].reset();
+          continue;
+        }
+        column[p]->d_present[i >> 6] &= ~GetBitSet(i & 63);
+        column[p]->d_values[i] = value_type();
+      }
+    }
+  }
+
+  /** Remove attribute `id` from all nodes. */
+  void clear(uint64_t id)
+  {
+    if (id < d_columns.size() && !d_columns[id].empty())
+    {
+      d_columns[id].clear();
+      d_used.erase(std::find(d_used.begin(), d_used.end(), id));
+    }
+  }
+
+  /** Remove all attributes from all nodes. */
+  void clear()
+  {
+    d_columns.clear();
+    d_used.clear();
+  }
+
+  /** The number of bytes allocated for pages. */
+  size_t bytesReserved() const
+  {
+    size_t n = 0;
+    for (const Column& column : d_columns)
+    {
+      for (const std::unique_ptr<Page>& page : column)
+      {
+        n += page == nullptr ? 0 : sizeof(Page);
+      }
+    }
+    return n;
+  }
+
+ private:
+  struct Page
+  {
+    uint64_t d_present[kPageSize / 64] = {};
+    /** The number of bits set in d_present */
+    uint64_t d_count = 0;
+    value_type d_values[kPageSize];
+  };
+  typedef std::vector<std::unique_ptr<Page>> Column;
+
+  const Page* getPage(uint64_t id, uint64_t nodeId) const
+  {
+    const uint64_t p = nodeId >> kPageBits;
+    if (id >= d_columns.size() || p >= d_columns[id].size())
+    {
+      return nullptr;
+    }
+    return d_columns[id][p].get();
+  }
+
+  Page* getOrMakePage(uint64_t id, uint64_t nodeId)
+  {
+    const uint64_t p = nodeId >> kPageBits;
+    if (id >= d_columns.size())
+    {
+      d_columns.resize(id + 1);
+    }
+    Column& column = d_columns[id];
+    if (column.empty())
+    {
+      d_used.push_back(id);
+    }
+    if (p >= column.size())
+    {
+      column.resize(p + 1);
+    }
+    if (column[p] == nullptr)
+    {
+      column[p].reset(new Page());
+    }
+    return column[p].get();
+  }
+
+  /** The columns, indexed by attribute id */
+  std::vector<Column> d_columns;
+  /** The ids of the nonempty columns, the only ones erase() looks at */
+  std::vector<uint64_t> d_used;
+};/* class DenseAttrTable<> */
+
+/**
+ * Boolean-valued dense attributes have a default value, so there is no
+ * need for a separate presence bitmap: each node takes one bit per
+ * attribute, and a node without a page has the default value.  Pages are
+ * freed when the last of their bits is erased.
+ */
+template <>
+class DenseAttrTable<bool>
+{
+ public:
+  typedef bool value_type;
+
+  static const uint64_t kPageBits = 12;
+  static const uint64_t kPageSize = uint64_t(1) << kPageBits;
+
+  bool get(uint64_t id, const NodeValue* nv, bool& ret) const
+  {
+    const uint64_t p = nv->getId() >> kPageBits;
+    if (id >= d_columns.size() || p >= d_columns[id].size()
+        || d_columns[id][p] == nullptr)
+    {
+      return false;
+    }
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    ret = (d_columns[id][p]->d_bits[i >> 6] & GetBitSet(i & 63)) != 0;
+    return true;
+  }
+
+  void set(uint64_t id, const NodeValue* nv, bool value)
+  {
+    const uint64_t p = nv->getId() >> kPageBits;
+    if (!value
+        && (id >= d_columns.size() || p >= d_columns[id].size()
+            || d_columns[id][p] == nullptr))
+    {
+      // Nothing to clear
+      return;
+    }
+    if (id >= d_columns.size())
+    {
+      d_columns.resize(id + 1);
+    }
+    Column& column = d_columns[id];
+    if (column.empty())
+    {
+      d_used.push_back(id);
+    }
+    if (p >= column.size())
+    {
+      column.resize(p + 1);
+    }
+    if (column[p] == nullptr)
+    {
+      column[p].reset(new Page());
+    }
+    Page* page = column[p].get();
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    if (value != ((page->d_bits[i >> 6] & GetBitSet(i & 63)) != 0))
+    {
+      page->d_bits[i >> 6] ^= GetBitSet(i & 63);
+      if (value)
+      {
+        ++page->d_count;
+      }
+      else
+      {
+        --page->d_count;
+      }
+    }
+  }
+
+  void erase(const NodeValue* nv)
+  {
+    const uint64_t p = nv->getId() >> kPageBits;
+    const uint64_t i = nv->getId() & (kPageSize - 1);
+    for (uint64_t id : d_used)
+    {
+      Column& column = d_columns[id];
+      if (p < column.size() && column[p] != nullptr
+          && (column[p]->d_bits[i >> 6] & GetBitSet(i & 63)))
+      {
+        if (--column[p]->d_count == 0)
+        {
+          column[p].reset();
+          continue;
+        }
+        column[p]->d_bits[i >> 6] &= ~GetBitSet(i & 63);
+      }
+    }
+  }
+
+  void clear(uint64_t id)
+  {
+    if (id < d_columns.size() && !d_columns[id].empty())
+    {
+      d_columns[id].clear();
+      d_used.erase(std::find(d_used.begin(), d_used.end(), id));
+    }
+  }
+
+  void clear()
+  {
+    d_columns.clear();
+    d_used.clear();
+  }
+
+  size_t bytesReserved() const
+  {
+    size_t n = 0;
+    for (const Column& column : d_columns)
+    {
+      for (const std::unique_ptr<Page>& page : column)
+      {
+        n += page == nullptr ? 0 : sizeof(Page);
+      }
+    }
+    return n;
+  }
+
+ private:
+  struct Page
+  {
+    uint64_t d_bits[kPageSize / 64] = {};
+    /** The number of bits set in d_bits */
+    uint64_t d_count = 0;
+  };
+  typedef std::vector<std::unique_ptr<Page>> Column;
+
+  std::vector<Column> d_columns;
+  std::vector<uint64_t> d_used;
+};/* class DenseAttrTable<bool> */
+
+}/* CVC4::expr::attr namespace */
+
 // ATTRIBUTE IDENTIFIER ASSIGNMENT TEMPLATE ====================================
 
 namespace attr {
 
 /**
  * This is the last-attribute-assigner.  IDs are not globally
- * unique; rather, they are unique for each table_value_type.
+ * unique; rather, they are unique for each table_value_type and storage
+ * policy.
  */
-template <class T, bool context_dep>
+template <class T, bool context_dep, class storage_policy = AttrStorageHash>
 struct LastAttributeId {
  public:
   static uint64_t getNextId() {
@@ -407,10 +726,19 @@ struct LastAttributeId {
  *
  * @param context_dep whether this attribute kind is
  * context-dependent
+ *
+ * @param storage_p where the attribute manager keeps the values of this
+ * attribute kind; attr::AttrStorageHash or attr::AttrStorageDense
  */
-template <class T, class value_t, bool context_dep = false>
+template <class T,
+          class value_t,
+          bool context_dep = false,
+          class storage_p = attr::AttrStorageHash>
 class Attribute
 {
+  static_assert(!(context_dep && storage_p::dense),
+                "Context-dependent attributes cannot use dense storage");
+
   /**
    * The unique ID associated to this attribute.  Assigned statically,
    * at load time.
@@ -438,6 +766,9 @@ public:
    */
   static const bool context_dependent = context_dep;
 
+  /** The storage policy of this attribute kind. */
+  typedef storage_p storage_policy;
+
   /**
    * Register this attribute kind and check that the ID is a valid ID
    * for bool-valued attributes.  Fail an assert if not.  Otherwise
@@ -446,16 +777,20 @@ public:
   static inline uint64_t registerAttribute() {
     typedef typename attr::KindValueToTableValueMapping<value_t>::
                      table_value_type table_value_type;
-    return attr::LastAttributeId<table_value_type, context_dep>::getNextId();
+    return attr::LastAttributeId<table_value_type, context_dep, storage_p>::
+        getNextId();
   }
 };/* class Attribute<> */
 
 /**
  * An "attribute type" structure for boolean flags (special).
  */
-template <class T, bool context_dep>
-class Attribute<T, bool, context_dep>
+template <class T, bool context_dep, class storage_p>
+class Attribute<T, bool, context_dep, storage_p>
 {
+  static_assert(!(context_dep && storage_p::dense),
+                "Context-dependent attributes cannot use dense storage");
+
   /** IDs for bool-valued attributes are actually bit assignments. */
   static const uint64_t s_id;
 
@@ -486,15 +821,21 @@ public:
    */
   static const bool context_dependent = context_dep;
 
+  /** The storage policy of this attribute kind. */
+  typedef storage_p storage_policy;
+
   /**
    * Register this attribute kind and check that the ID is a valid ID
    * for bool-valued attributes.  Fail an assert if not.  Otherwise
-   * return the id.
+   * return the id.  Dense bool-valued attributes each get their own
+   * column, so only hashed ones are limited to 64.
    */
   static inline uint64_t registerAttribute() {
-    const uint64_t id = attr::LastAttributeId<bool, context_dep>::getNextId();
-    AlwaysAssert(id <= 63) << "Too many boolean node attributes registered "
-                              "during initialization !";
+    const uint64_t id =
+        attr::LastAttributeId<bool, context_dep, storage_p>::getNextId();
+    AlwaysAssert(storage_p::dense || id <= 63)
+        << "Too many boolean node attributes registered "
+           "during initialization !";
     return id;
   }
 };/* class Attribute<..., bool, ...> */
@@ -502,15 +843,15 @@ public:
 // ATTRIBUTE IDENTIFIER ASSIGNMENT =============================================
 
 /** Assign unique IDs to attributes at load time. */
-template <class T, class value_t, bool context_dep>
-const uint64_t Attribute<T, value_t, context_dep>::s_id =
-    Attribute<T, value_t,  context_dep>::registerAttribute();
+template <class T, class value_t, bool context_dep, class storage_p>
+const uint64_t Attribute<T, value_t, context_dep, storage_p>::s_id =
+    Attribute<T, value_t, context_dep, storage_p>::registerAttribute();
 
 
 /** Assign unique IDs to attributes at load time. */
-template <class T, bool context_dep>
-const uint64_t Attribute<T, bool, context_dep>::s_id =
-    Attribute<T, bool, context_dep>::registerAttribute();
+template <class T, bool context_dep, class storage_p>
+const uint64_t Attribute<T, bool, context_dep, storage_p>::s_id =
+    Attribute<T, bool, context_dep, storage_p>::registerAttribute();
 
 }/* CVC4::expr namespace */
 }/* CVC4 namespace */
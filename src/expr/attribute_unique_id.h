@@ -35,6 +35,12 @@ enum AttrTableId {
   AttrTableNode,
   AttrTableTypeNode,
   AttrTableString,
+  AttrTableDenseBool,
+  AttrTableDenseUInt64,
+  AttrTableDenseTNode,
+  AttrTableDenseNode,
+  AttrTableDenseTypeNode,
+  AttrTableDenseString,
   AttrTableCDBool,
   AttrTableCDUInt64,
   AttrTableCDTNode,
@@ -0,0 +1,755 @@
+/*********************                                                        */
+/*! \file dag_serializer.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A binary format for command streams over shared node DAGs
+ **
+ ** A binary format for command streams over shared node DAGs.
+ **/
+
+#include "expr/dag_serializer.h"
+
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <sstream>
+
+#include "base/exception.h"
+#include "expr/kind.h"
+#include "expr/node_builder.h"
+#include "expr/node_manager.h"
+#include "expr/node_manager_attributes.h"
+#include "expr/uninterpreted_constant.h"
+#include "util/bitvector.h"
+#include "util/divisible.h"
+#include "util/rational.h"
+#include "util/regexp.h"
+
+namespace CVC4 {
+namespace expr {
+
+namespace {
+
+/** The first bytes of every DAG file */
+const char s_magic[8] = {'C', 'V', 'C', '4', 'D', 'A', 'G', '\0'};
+/** The version of the format */
+const uint64_t s_version = 1;
+
+/** The record tags */
+enum Tag : uint8_t
+{
+  TAG_END = 0,
+  /** A constant term: kind, payload */
+  TAG_NODE_CONST = 1,
+  /** A variable: kind, name, type */
+  TAG_NODE_VAR = 2,
+  /** A nullary operator: kind, type */
+  TAG_NODE_NULLARY = 3,
+  /** An application: kind, number of children, children (operator first) */
+  TAG_NODE_APP = 4,
+  /** A type constant: kind, payload */
+  TAG_TYPE_CONST = 5,
+  /** An uninterpreted sort: name */
+  TAG_TYPE_SORT = 6,
+  /** A type application: kind, number of children, children */
+  TAG_TYPE_APP = 7,
+  TAG_CMD_SET_LOGIC = 16,
+  TAG_CMD_ASSERT = 17,
+  TAG_CMD_PUSH = 18,
+  TAG_CMD_POP = 19,
+  TAG_CMD_CHECK_SAT = 20
+};
+
+/** Is k the kind of a type application that DAG files may contain? */
+bool isTypeApplication(Kind k)
+{
+  return k == kind::ARRAY_TYPE || k == kind::FUNCTION_TYPE
+         || k == kind::SET_TYPE || k == kind::SEXPR_TYPE;
+}
+
+/** Throws if a node of kind k cannot have n children */
+void checkArity(Kind k, uint64_t n)
+{
+  if (n < kind::metakind::getLowerBoundForKind(k)
+      || n > kind::metakind::getUpperBoundForKind(k))
+  {
+    std::stringstream ss;
+    ss << "malformed DAG file: " << k << " with " << n << " children";
+    throw Exception(ss.str());
+  }
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+
+DagWriter::DagWriter(std::ostream& out) : d_out(out), d_nextId(0)
+{
+  d_buf.append(s_magic, sizeof(s_magic));
+  writeUnsigned(s_version);
+  writeUnsigned(kind::LAST_KIND);
+}
+
+DagWriter::~DagWriter()
+{
+  d_buf.push_back(char(TAG_END));
+  flush();
+}
+
+void DagWriter::setLogic(const std::string& logic)
+{
+  d_buf.push_back(char(TAG_CMD_SET_LOGIC));
+  writeString(logic);
+}
+
+void DagWriter::assertFormula(TNode n)
+{
+  uint64_t id = writeNode(n);
+  d_buf.push_back(char(TAG_CMD_ASSERT));
+  writeRef(id);
+}
+
+void DagWriter::push() { d_buf.push_back(char(TAG_CMD_PUSH)); }
+
+void DagWriter::pop() { d_buf.push_back(char(TAG_CMD_POP)); }
+
+void DagWriter::checkSat() { d_buf.push_back(char(TAG_CMD_CHECK_SAT)); }
+
+void DagWriter::flush()
+{
+  d_out.write(d_buf.data(), d_buf.size());
+  d_out.flush();
+  d_buf.clear();
+}
+
+uint64_t DagWriter::writeNode(TNode root)
+{
+  std::unordered_map<Node, uint64_t, NodeHashFunction>::const_iterator it =
+      d_nodeIds.find(root);
+  if (it != d_nodeIds.end())
+  {
+    return it->second;
+  }
+  std::vector<TNode> visit;
+  visit.push_back(root);
+  do
+  {
+    TNode cur = visit.back();
+    if (d_nodeIds.find(cur) != d_nodeIds.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    bool ready = true;
+    if (cur.getMetaKind() == kind::metakind::PARAMETERIZED)
+    {
+      TNode op = cur.getOperator();
+      if (d_nodeIds.find(op) == d_nodeIds.end())
+      {
+        visit.push_back(op);
+        ready = false;
+      }
+    }
+    for (TNode cn : cur)
+    {
+      if (d_nodeIds.find(cn) == d_nodeIds.end())
+      {
+        visit.push_back(cn);
+        ready = false;
+      }
+    }
+    if (ready)
+    {
+      visit.pop_back();
+      writeNodeRecord(cur);
+    }
+  } while (!visit.empty());
+  return d_nodeIds[root];
+}
+
+uint64_t DagWriter::writeType(TypeNode root)
+{
+  std::unordered_map<TypeNode, uint64_t, TypeNodeHashFunction>::const_iterator
+      it = d_typeIds.find(root);
+  if (it != d_typeIds.end())
+  {
+    return it->second;
+  }
+  std::vector<TypeNode> visit;
+  visit.push_back(root);
+  do
+  {
+    TypeNode cur = visit.back();
+    if (d_typeIds.find(cur) != d_typeIds.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    bool ready = true;
+    if (cur.getKind() != kind::SORT_TYPE)
+    {
+      for (const TypeNode& cn : cur)
+      {
+        if (d_typeIds.find(cn) == d_typeIds.end())
+        {
+          visit.push_back(cn);
+          ready = false;
+        }
+      }
+    }
+    if (ready)
+    {
+      visit.pop_back();
+      writeTypeRecord(cur);
+    }
+  } while (!visit.empty());
+  return d_typeIds[root];
+}
+
+void DagWriter::writeNodeRecord(TNode n)
+{
+  Kind k = n.getKind();
+  switch (n.getMetaKind())
+  {
+    case kind::metakind::CONSTANT:
+    {
+      // Types referenced by the payload must be written before the record
+      // starts.
+      uint64_t typeId = 0;
+      if (k == kind::UNINTERPRETED_CONSTANT)
+      {
+        typeId = writeType(
+            TypeNode::fromType(n.getConst<UninterpretedConstant>().getType()));
+      }
+      d_buf.push_back(char(TAG_NODE_CONST));
+      writeUnsigned(k);
+      switch (k)
+      {
+        case kind::CONST_BOOLEAN: writeUnsigned(n.getConst<bool>()); break;
+        case kind::CONST_RATIONAL:
+          writeString(n.getConst<Rational>().toString(16));
+          break;
+        case kind::CONST_BITVECTOR:
+        {
+          const BitVector& bv = n.getConst<BitVector>();
+          writeUnsigned(bv.getSize());
+          writeString(bv.getValue().toString(16));
+          break;
+        }
+        case kind::CONST_STRING:
+        {
+          const std::vector<unsigned>& vec = n.getConst<String>().getVec();
+          writeUnsigned(vec.size());
+          for (unsigned c : vec)
+          {
+            writeUnsigned(c);
+          }
+          break;
+        }
+        case kind::BUILTIN: writeUnsigned(n.getConst<Kind>()); break;
+        case kind::UNINTERPRETED_CONSTANT:
+          writeRef(typeId);
+          writeString(
+              n.getConst<UninterpretedConstant>().getIndex().toString(16));
+          break;
+        case kind::DIVISIBLE_OP:
+          writeString(n.getConst<Divisible>().k.toString(16));
+          break;
+        case kind::BITVECTOR_EXTRACT_OP:
+          writeUnsigned(n.getConst<BitVectorExtract>().d_high);
+          writeUnsigned(n.getConst<BitVectorExtract>().d_low);
+          break;
+        case kind::BITVECTOR_BITOF_OP:
+          writeUnsigned(n.getConst<BitVectorBitOf>().d_bitIndex);
+          break;
+        case kind::BITVECTOR_REPEAT_OP:
+          writeUnsigned(unsigned(n.getConst<BitVectorRepeat>()));
+          break;
+        case kind::BITVECTOR_ZERO_EXTEND_OP:
+          writeUnsigned(unsigned(n.getConst<BitVectorZeroExtend>()));
+          break;
+        case kind::BITVECTOR_SIGN_EXTEND_OP:
+          writeUnsigned(unsigned(n.getConst<BitVectorSignExtend>()));
+          break;
+        case kind::BITVECTOR_ROTATE_LEFT_OP:
+          writeUnsigned(unsigned(n.getConst<BitVectorRotateLeft>()));
+          break;
+        case kind::BITVECTOR_ROTATE_RIGHT_OP:
+          writeUnsigned(unsigned(n.getConst<BitVectorRotateRight>()));
+          break;
+        case kind::INT_TO_BITVECTOR_OP:
+          writeUnsigned(unsigned(n.getConst<IntToBitVector>()));
+          break;
+        default:
+        {
+          std::stringstream ss;
+          ss << "cannot write constants of kind " << k << " to a DAG file";
+          throw Exception(ss.str());
+        }
+      }
+      break;
+    }
+    case kind::metakind::VARIABLE:
+    {
+      if (k != kind::VARIABLE && k != kind::BOUND_VARIABLE
+          && k != kind::SKOLEM)
+      {
+        std::stringstream ss;
+        ss << "cannot write variables of kind " << k << " to a DAG file";
+        throw Exception(ss.str());
+      }
+      uint64_t typeId = writeType(n.getType());
+      std::string name;
+      n.getAttribute(VarNameAttr(), name);
+      d_buf.push_back(char(TAG_NODE_VAR));
+      writeUnsigned(k);
+      writeString(name);
+      writeRef(typeId);
+      break;
+    }
+    case kind::metakind::NULLARY_OPERATOR:
+    {
+      uint64_t typeId = writeType(n.getType());
+      d_buf.push_back(char(TAG_NODE_NULLARY));
+      writeUnsigned(k);
+      writeRef(typeId);
+      break;
+    }
+    default:
+    {
+      bool parameterized = n.getMetaKind() == kind::metakind::PARAMETERIZED;
+      d_buf.push_back(char(TAG_NODE_APP));
+      writeUnsigned(k);
+      writeUnsigned(n.getNumChildren() + (parameterized ? 1 : 0));
+      if (parameterized)
+      {
+        writeRef(d_nodeIds[n.getOperator()]);
+      }
+      for (TNode cn : n)
+      {
+        writeRef(d_nodeIds[cn]);
+      }
+      break;
+    }
+  }
+  d_nodeIds[n] = d_nextId++;
+}
+
+void DagWriter::writeTypeRecord(TypeNode tn)
+{
+  Kind k = tn.getKind();
+  if (k == kind::SORT_TYPE)
+  {
+    if (tn.getNumChildren() > 0)
+    {
+      throw Exception("cannot write sort constructor applications to a DAG file");
+    }
+    std::string name;
+    tn.getAttribute(VarNameAttr(), name);
+    d_buf.push_back(char(TAG_TYPE_SORT));
+    writeString(name);
+  }
+  else if (tn.getMetaKind() == kind::metakind::CONSTANT)
+  {
+    d_buf.push_back(char(TAG_TYPE_CONST));
+    writeUnsigned(k);
+    switch (k)
+    {
+      case kind::TYPE_CONSTANT:
+        writeUnsigned(tn.getConst<TypeConstant>());
+        break;
+      case kind::BITVECTOR_TYPE:
+        writeUnsigned(unsigned(tn.getConst<BitVectorSize>()));
+        break;
+      default:
+      {
+        std::stringstream ss;
+        ss << "cannot write types of kind " << k << " to a DAG file";
+        throw Exception(ss.str());
+      }
+    }
+  }
+  else if (isTypeApplication(k))
+  {
+    d_buf.push_back(char(TAG_TYPE_APP));
+    writeUnsigned(k);
+    writeUnsigned(tn.getNumChildren());
+    for (const TypeNode& cn : tn)
+    {
+      writeRef(d_typeIds[cn]);
+    }
+  }
+  else
+  {
+    std::stringstream ss;
+    ss << "cannot write types of kind " << k << " to a DAG file";
+    throw Exception(ss.str());
+  }
+  d_typeIds[tn] = d_nextId++;
+}
+
+void DagWriter::writeUnsigned(uint64_t v)
+{
+  while (v >= 0x80)
+  {
+    d_buf.push_back(char((v & 0x7f) | 0x80));
+    v >>= 7;
+  }
+  d_buf.push_back(char(v));
+}
+
+void DagWriter::writeString(const std::string& s)
+{
+  writeUnsigned(s.size());
+  d_buf.append(s);
+}
+
+void DagWriter::writeRef(uint64_t id)
+{
+  Assert(id < d_nextId);
+  writeUnsigned(d_nextId - id);
+}
+
+/* -------------------------------------------------------------------------- */
+
+DagReader::DagReader(NodeManager* nm, const char* data, size_t size)
+    : d_nm(nm),
+      d_pos(reinterpret_cast<const unsigned char*>(data)),
+      d_end(reinterpret_cast<const unsigned char*>(data) + size)
+{
+  if (size < sizeof(s_magic) || std::memcmp(data, s_magic, sizeof(s_magic)))
+  {
+    throw Exception("not a DAG file");
+  }
+  d_pos += sizeof(s_magic);
+  if (readUnsigned() != s_version)
+  {
+    throw Exception("unsupported DAG file version");
+  }
+  if (readUnsigned() != kind::LAST_KIND)
+  {
+    throw Exception("DAG file was written by a build with different kinds");
+  }
+}
+
+bool DagReader::next(DagCommand& cmd)
+{
+  while (true)
+  {
+    uint8_t tag = d_pos == d_end ? uint8_t(TAG_END) : readByte();
+    switch (tag)
+    {
+      case TAG_END: return false;
+      case TAG_NODE_CONST:
+      case TAG_NODE_NULLARY:
+      case TAG_NODE_APP: readNodeRecord(tag); break;
+      case TAG_NODE_VAR:
+        readNodeRecord(tag);
+        if (d_nodes.back().getKind() != kind::BOUND_VARIABLE)
+        {
+          cmd.d_kind = DagCommand::DECLARE_FUN;
+          d_nodes.back().getAttribute(VarNameAttr(), cmd.d_symbol);
+          cmd.d_node = d_nodes.back();
+          cmd.d_type = d_nodes.back().getType();
+          return true;
+        }
+        break;
+      case TAG_TYPE_CONST:
+      case TAG_TYPE_APP: readTypeRecord(tag); break;
+      case TAG_TYPE_SORT:
+        readTypeRecord(tag);
+        cmd.d_kind = DagCommand::DECLARE_SORT;
+        d_types.back().getAttribute(VarNameAttr(), cmd.d_symbol);
+        cmd.d_node = Node::null();
+        cmd.d_type = d_types.back();
+        return true;
+      case TAG_CMD_SET_LOGIC:
+        cmd.d_kind = DagCommand::SET_LOGIC;
+        cmd.d_symbol = readString();
+        return true;
+      case TAG_CMD_ASSERT:
+        cmd.d_kind = DagCommand::ASSERT;
+        cmd.d_node = readNodeRef();
+        return true;
+      case TAG_CMD_PUSH: cmd.d_kind = DagCommand::PUSH; return true;
+      case TAG_CMD_POP: cmd.d_kind = DagCommand::POP; return true;
+      case TAG_CMD_CHECK_SAT: cmd.d_kind = DagCommand::CHECK_SAT; return true;
+      default: throw Exception("malformed DAG file: unknown record tag");
+    }
+  }
+}
+
+void DagReader::readNodeRecord(uint8_t tag)
+{
+  uint64_t kindId = readUnsigned();
+  if (kindId >= kind::LAST_KIND)
+  {
+    throw Exception("malformed DAG file: unknown kind");
+  }
+  Kind k = Kind(kindId);
+  Node n;
+  switch (tag)
+  {
+    case TAG_NODE_CONST:
+      switch (k)
+      {
+        case kind::CONST_BOOLEAN: n = d_nm->mkConst(readUnsigned() != 0); break;
+        case kind::CONST_RATIONAL:
+          n = d_nm->mkConst(Rational(readString(), 16));
+          break;
+        case kind::CONST_BITVECTOR:
+        {
+          unsigned size = readBitVectorSize();
+          n = d_nm->mkConst(BitVector(size, Integer(readString(), 16)));
+          break;
+        }
+        case kind::CONST_STRING:
+        {
+          std::vector<unsigned> vec(readCount());
+          for (unsigned& c : vec)
+          {
+            c = readUnsigned();
+          }
+          n = d_nm->mkConst(String(vec));
+          break;
+        }
+        case kind::BUILTIN:
+        {
+          uint64_t op = readUnsigned();
+          if (op >= kind::LAST_KIND)
+          {
+            throw Exception("malformed DAG file: unknown kind");
+          }
+          n = d_nm->mkConst(Kind(op));
+          break;
+        }
+        case kind::UNINTERPRETED_CONSTANT:
+        {
+          TypeNode tn = readTypeRef();
+          n = d_nm->mkConst(
+              UninterpretedConstant(tn.toType(), Integer(readString(), 16)));
+          break;
+        }
+        case kind::DIVISIBLE_OP:
+          n = d_nm->mkConst(Divisible(Integer(readString(), 16)));
+          break;
+        case kind::BITVECTOR_EXTRACT_OP:
+        {
+          unsigned high = readUnsigned();
+          unsigned low = readUnsigned();
+          n = d_nm->mkConst(BitVectorExtract(high, low));
+          break;
+        }
+        case kind::BITVECTOR_BITOF_OP:
+          n = d_nm->mkConst(BitVectorBitOf(readUnsigned()));
+          break;
+        case kind::BITVECTOR_REPEAT_OP:
+          n = d_nm->mkConst(BitVectorRepeat(readUnsigned()));
+          break;
+        case kind::BITVECTOR_ZERO_EXTEND_OP:
+          n = d_nm->mkConst(BitVectorZeroExtend(readUnsigned()));
+          break;
+        case kind::BITVECTOR_SIGN_EXTEND_OP:
+          n = d_nm->mkConst(BitVectorSignExtend(readUnsigned()));
+          break;
+        case kind::BITVECTOR_ROTATE_LEFT_OP:
+          n = d_nm->mkConst(BitVectorRotateLeft(readUnsigned()));
+          break;
+        case kind::BITVECTOR_ROTATE_RIGHT_OP:
+          n = d_nm->mkConst(BitVectorRotateRight(readUnsigned()));
+          break;
+        case kind::INT_TO_BITVECTOR_OP:
+          n = d_nm->mkConst(IntToBitVector(readUnsigned()));
+          break;
+        default: throw Exception("malformed DAG file: unexpected constant");
+      }
+      break;
+    case TAG_NODE_VAR:
+    {
+      std::string name = readString();
+      const TypeNode& tn = readTypeRef();
+      if (k == kind::VARIABLE)
+      {
+        n = name.empty() ? d_nm->mkVar(tn) : d_nm->mkVar(name, tn);
+      }
+      else if (k == kind::BOUND_VARIABLE)
+      {
+        n = name.empty() ? d_nm->mkBoundVar(tn) : d_nm->mkBoundVar(name, tn);
+      }
+      else if (k == kind::SKOLEM)
+      {
+        n = d_nm->mkSkolem(name, tn, "", NodeManager::SKOLEM_EXACT_NAME);
+      }
+      else
+      {
+        throw Exception("malformed DAG file: unexpected variable");
+      }
+      break;
+    }
+    case TAG_NODE_NULLARY:
+      if (kind::metaKindOf(k) != kind::metakind::NULLARY_OPERATOR)
+      {
+        throw Exception("malformed DAG file: unexpected nullary operator");
+      }
+      n = d_nm->mkNullaryOperator(readTypeRef(), k);
+      break;
+    default:
+    {
+      Assert(tag == TAG_NODE_APP);
+      kind::MetaKind mk = kind::metaKindOf(k);
+      if (mk != kind::metakind::OPERATOR && mk != kind::metakind::PARAMETERIZED)
+      {
+        throw Exception("malformed DAG file: unexpected application");
+      }
+      uint64_t nchildren = readCount();
+      NodeBuilder<> nb(d_nm, k);
+      if (mk == kind::metakind::PARAMETERIZED)
+      {
+        if (nchildren == 0)
+        {
+          throw Exception("malformed DAG file: application without operator");
+        }
+        const Node& op = readNodeRef();
+        if (op.getMetaKind() == kind::metakind::CONSTANT
+            && NodeManager::operatorToKind(op) != k)
+        {
+          throw Exception("malformed DAG file: operator of the wrong kind");
+        }
+        nb << op;
+        --nchildren;
+      }
+      checkArity(k, nchildren);
+      for (uint64_t i = 0; i < nchildren; ++i)
+      {
+        nb << readNodeRef();
+      }
+      n = nb;
+      break;
+    }
+  }
+  d_nodes.push_back(n);
+  d_types.push_back(TypeNode::null());
+}
+
+void DagReader::readTypeRecord(uint8_t tag)
+{
+  TypeNode tn;
+  if (tag == TAG_TYPE_SORT)
+  {
+    tn = d_nm->mkSort(readString());
+  }
+  else
+  {
+    uint64_t k = readUnsigned();
+    if (tag == TAG_TYPE_CONST && k == kind::TYPE_CONSTANT)
+    {
+      uint64_t tc = readUnsigned();
+      if (tc >= LAST_TYPE)
+      {
+        throw Exception("malformed DAG file: unknown type constant");
+      }
+      tn = d_nm->mkTypeConst(TypeConstant(tc));
+    }
+    else if (tag == TAG_TYPE_CONST && k == kind::BITVECTOR_TYPE)
+    {
+      tn = d_nm->mkBitVectorType(readBitVectorSize());
+    }
+    else if (tag == TAG_TYPE_APP && k < kind::LAST_KIND
+             && isTypeApplication(Kind(k)))
+    {
+      std::vector<TypeNode> children(readCount());
+      checkArity(Kind(k), children.size());
+      for (TypeNode& cn : children)
+      {
+        cn = readTypeRef();
+      }
+      tn = d_nm->mkTypeNode(Kind(k), children);
+    }
+    else
+    {
+      throw Exception("malformed DAG file: unexpected type");
+    }
+  }
+  d_nodes.push_back(Node::null());
+  d_types.push_back(tn);
+}
+
+uint8_t DagReader::readByte()
+{
+  if (d_pos == d_end)
+  {
+    throw Exception("malformed DAG file: unexpected end of file");
+  }
+  return *d_pos++;
+}
+
+uint64_t DagReader::readUnsigned()
+{
+  uint64_t v = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7)
+  {
+    uint8_t b = readByte();
+    v |= uint64_t(b & 0x7f) << shift;
+    if (!(b & 0x80))
+    {
+      return v;
+    }
+  }
+  throw Exception("malformed DAG file: integer out of range");
+}
+
+unsigned DagReader::readBitVectorSize()
+{
+  uint64_t size = readUnsigned();
+  if (size == 0 || size > std::numeric_limits<unsigned>::max())
+  {
+    throw Exception("malformed DAG file: bad bit-vector size");
+  }
+  return unsigned(size);
+}
+
+uint64_t DagReader::readCount()
+{
+  uint64_t count = readUnsigned();
+  if (count > uint64_t(d_end - d_pos))
+  {
+    throw Exception("malformed DAG file: unexpected end of file");
+  }
+  return count;
+}
+
+std::string DagReader::readString()
+{
+  uint64_t size = readCount();
+  std::string s(reinterpret_cast<const char*>(d_pos), size);
+  d_pos += size;
+  return s;
+}
+
+const Node& DagReader::readNodeRef()
+{
+  uint64_t dist = readUnsigned();
+  if (dist == 0 || dist > d_nodes.size() || d_nodes[d_nodes.size() - dist].isNull())
+  {
+    throw Exception("malformed DAG file: bad node reference");
+  }
+  return d_nodes[d_nodes.size() - dist];
+}
+
+const TypeNode& DagReader::readTypeRef()
+{
+  uint64_t dist = readUnsigned();
+  if (dist == 0 || dist > d_types.size() || d_types[d_types.size() - dist].isNull())
+  {
+    throw Exception("malformed DAG file: bad type reference");
+  }
+  return d_types[d_types.size() - dist];
+}
+
+}  // namespace expr
+}  // namespace CVC4
@@ -0,0 +1,171 @@
+/*********************                                                        */
+/*! \file dag_serializer.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A binary format for command streams over shared node DAGs
+ **
+ ** A DAG file is a sequence of records.  Node and type records define one
+ ** node each, referring to previously defined nodes by their distance from
+ ** the record being defined, so every subterm is written once.  Command
+ ** records (set-logic, assert, push, pop, check-sat) refer to nodes the same
+ ** way.  Reading a file is a single forward pass that rebuilds each node
+ ** through the NodeManager, so the cost is linear in the size of the DAG.
+ **
+ ** All integers are stored as LEB128 varints.  Kinds are stored by value,
+ ** so a file can only be read by a build with the same set of kinds; the
+ ** header records kind::LAST_KIND to detect mismatches.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__EXPR__DAG_SERIALIZER_H
+#define CVC4__EXPR__DAG_SERIALIZER_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/type_node.h"
+
+namespace CVC4 {
+namespace expr {
+
+/**
+ * Writes a command stream in the DAG format.  Nodes are written on demand
+ * the first time a command refers to them; the writer keeps a reference to
+ * every node it has written, so later commands can share them.
+ *
+ * Only nodes whose constants, variables and types have a DAG encoding can
+ * be written (Booleans, arithmetic, bit-vectors, strings, arrays,
+ * uninterpreted functions and sorts, quantifiers).  Writing any other node
+ * throws an Exception; the output is unusable after that.
+ */
+class DagWriter
+{
+ public:
+  DagWriter(std::ostream& out);
+  ~DagWriter();
+
+  void setLogic(const std::string& logic);
+  void assertFormula(TNode n);
+  void push();
+  void pop();
+  void checkSat();
+
+  /** Write the buffered records to the output stream. */
+  void flush();
+
+  /** The number of node and type records written so far. */
+  uint64_t getNumRecords() const { return d_nextId; }
+
+ private:
+  /** Return the id of n, writing it (and its subterms) if necessary. */
+  uint64_t writeNode(TNode n);
+  /** Return the id of tn, writing it (and its subtypes) if necessary. */
+  uint64_t writeType(TypeNode tn);
+  /** Write the record for n; all of its children must have been written. */
+  void writeNodeRecord(TNode n);
+  /** Write the record for tn; all of its children must have been written. */
+  void writeTypeRecord(TypeNode tn);
+
+  void writeUnsigned(uint64_t v);
+  void writeString(const std::string& s);
+  /** Write the distance from the next record id to id. */
+  void writeRef(uint64_t id);
+
+  /** The output stream */
+  std::ostream& d_out;
+  /** The records not yet written to d_out */
+  std::string d_buf;
+  /** The id of the next node or type record */
+  uint64_t d_nextId;
+  /** The ids of written nodes */
+  std::unordered_map<Node, uint64_t, NodeHashFunction> d_nodeIds;
+  /** The ids of written types */
+  std::unordered_map<TypeNode, uint64_t, TypeNodeHashFunction> d_typeIds;
+}; /* class DagWriter */
+
+/** A command read from a DAG file. */
+struct DagCommand
+{
+  enum Kind
+  {
+    SET_LOGIC,
+    DECLARE_SORT,
+    DECLARE_FUN,
+    ASSERT,
+    PUSH,
+    POP,
+    CHECK_SAT
+  };
+  Kind d_kind;
+  /** The logic, or the name of the declared sort or function */
+  std::string d_symbol;
+  /** The asserted formula, or the declared function */
+  Node d_node;
+  /** The declared sort, or the type of the declared function */
+  TypeNode d_type;
+}; /* struct DagCommand */
+
+/**
+ * Reads a command stream in the DAG format from a memory buffer (usually a
+ * mapped file).  Each named variable and uninterpreted sort defined by the
+ * file is reported as a declaration command right after its definition.
+ *
+ * Malformed input raises an Exception.  The buffer must outlive the reader,
+ * and the current NodeManager must be the one given to the constructor
+ * while next() runs.
+ */
+class DagReader
+{
+ public:
+  DagReader(NodeManager* nm, const char* data, size_t size);
+
+  /** Read the next command into cmd.  Returns false at the end. */
+  bool next(DagCommand& cmd);
+
+  /** The number of node and type records read so far. */
+  uint64_t getNumRecords() const { return d_nodes.size(); }
+
+ private:
+  void readNodeRecord(uint8_t tag);
+  void readTypeRecord(uint8_t tag);
+
+  uint8_t readByte();
+  uint64_t readUnsigned();
+  /** Read a bit-vector size, which must be positive and fit an unsigned. */
+  unsigned readBitVectorSize();
+  /**
+   * Read the number of the items that follow, each of which takes at least a
+   * byte, so that a malformed file cannot make us allocate more than its size.
+   */
+  uint64_t readCount();
+  std::string readString();
+  /** Read a reference to a previous node record. */
+  const Node& readNodeRef();
+  /** Read a reference to a previous type record. */
+  const TypeNode& readTypeRef();
+
+  NodeManager* d_nm;
+  const unsigned char* d_pos;
+  const unsigned char* d_end;
+  /**
+   * The nodes defined so far, indexed by record id.  Type records leave a
+   * null node here and use the same index in d_types, and vice versa.
+   */
+  std::vector<Node> d_nodes;
+  std::vector<TypeNode> d_types;
+}; /* class DagReader */
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__DAG_SERIALIZER_H */
@@ -0,0 +1,73 @@
+/*********************                                                        */
+/*! \file export_cache.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The translation cache and statistics of Expr::exportTo()
+ **/
+
+#include "expr/export_cache.h"
+
+#include <atomic>
+
+#include "expr/node_manager.h"
+
+namespace CVC4 {
+namespace expr {
+
+namespace {
+
+/** The serial number of the next NodeManager */
+std::atomic<uint64_t> s_nextSerial(0);
+
+}  // namespace
+
+ExportCache::~ExportCache()
+{
+  for (std::pair<const std::tuple<uint64_t, uint64_t, uint32_t>, Entry>& t :
+       d_tables)
+  {
+    // the translations belong to the target
+    NodeManagerScope nms(t.second.d_target);
+    t.second.d_table.clear();
+  }
+}
+
+ExportCache::Table& ExportCache::getTable(ExprManager* from,
+                                          ExprManager* to,
+                                          uint32_t flags)
+{
+  NodeManager* fromNm = NodeManager::fromExprManager(from);
+  NodeManager* toNm = NodeManager::fromExprManager(to);
+  Entry& e = d_tables[std::make_tuple(fromNm->getExportStatistics()->d_serial,
+                                      toNm->getExportStatistics()->d_serial,
+                                      flags)];
+  e.d_target = toNm;
+  return e.d_table;
+}
+
+ExportStatistics::ExportStatistics(StatisticsRegistry* registry)
+    : d_serial(s_nextSerial++),
+      d_registry(registry),
+      d_exportTime("expr::ExprManager::exportTime"),
+      d_exportedNodes("expr::ExprManager::exportedNodes", 0),
+      d_cacheHits("expr::ExprManager::exportCacheHits", 0)
+{
+  d_registry->registerStat(&d_exportTime);
+  d_registry->registerStat(&d_exportedNodes);
+  d_registry->registerStat(&d_cacheHits);
+}
+
+ExportStatistics::~ExportStatistics()
+{
+  d_registry->unregisterStat(&d_exportTime);
+  d_registry->unregisterStat(&d_exportedNodes);
+  d_registry->unregisterStat(&d_cacheHits);
+}
+
+}  // namespace expr
+}  // namespace CVC4
@@ -0,0 +1,92 @@
+/*********************                                                        */
+/*! \file export_cache.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The translation cache and statistics of Expr::exportTo()
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__EXPR__EXPORT_CACHE_H
+#define CVC4__EXPR__EXPORT_CACHE_H
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+#include "expr/node.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+
+class ExprManager;
+
+namespace expr {
+
+/**
+ * The translations of the nodes exported with one ExprManagerMapCollection,
+ * kept across calls to Expr::exportTo() so that each node is translated
+ * once.  There is one table per direction of export and set of variable
+ * flags; a table maps the id of a node of the source ExprManager to its
+ * translation in the target.
+ *
+ * Node ids are never reused by a NodeManager, so the tables stay valid when
+ * nodes of the source are collected.  The tables are keyed by the serial
+ * numbers of the NodeManagers rather than their addresses, so that a manager
+ * allocated where a destroyed one was does not find its translations.  The
+ * translations are kept alive by the cache: it must be destroyed before the
+ * target ExprManagers.
+ */
+class ExportCache
+{
+ public:
+  typedef std::unordered_map<uint64_t, Node> Table;
+
+  ~ExportCache();
+
+  /** The table for exports from `from` to `to` with the given flags. */
+  Table& getTable(ExprManager* from, ExprManager* to, uint32_t flags);
+
+ private:
+  /** A table and the NodeManager its translations belong to */
+  struct Entry
+  {
+    NodeManager* d_target = nullptr;
+    Table d_table;
+  };
+  /** The tables, by (source serial, target serial, flags) */
+  std::map<std::tuple<uint64_t, uint64_t, uint32_t>, Entry> d_tables;
+}; /* class ExportCache */
+
+/** Statistics on the exports from the ExprManager of a NodeManager. */
+class ExportStatistics
+{
+ public:
+  ExportStatistics(StatisticsRegistry* registry);
+  ~ExportStatistics();
+
+  /**
+   * The serial number of the NodeManager, unique among all the NodeManagers
+   * of the process, which identifies it in an ExportCache.
+   */
+  const uint64_t d_serial;
+  /** The registry the statistics are registered with. */
+  StatisticsRegistry* d_registry;
+  /** Total time spent exporting nodes. */
+  TimerStat d_exportTime;
+  /** Number of nodes translated. */
+  IntStat d_exportedNodes;
+  /** Number of nodes whose translation was found in the cache. */
+  IntStat d_cacheHits;
+}; /* class ExportStatistics */
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__EXPORT_CACHE_H */
@@ -1089,7 +1089,7 @@ TypeNode exportTypeInternal(TypeNode n, NodeManager* from, NodeManager* to, Expr
   {
     return to->mkFloatingPointType(n.getConst<FloatingPointSize>());
   }
-  else if (n.getNumChildren() == 0)
+  else if (n.getNumChildren() == 0 && n.getKind() != kind::SORT_TYPE)
   {
     std::stringstream msg;
     msg << "export of type " << n << " not supported";
@@ -1101,6 +1101,17 @@ TypeNode exportTypeInternal(TypeNode n, NodeManager* from, NodeManager* to, Expr
     Debug("export") << "+ mapped `" << from_t << "' to `" << to_t << "'" << std::endl;
     return *Type::getTypeNode(to_t);
   }
+  if (n.getNumChildren() == 0)
+  {
+    // a declared sort of arity 0: make a fresh sort of the same name, the
+    // type map keeps every later export of n on this one
+    std::string name;
+    from->getAttribute(n, expr::VarNameAttr(), name);
+    TypeNode out = to->mkSort(name);  // FIXME thread safety
+    to_t = to->toType(out);
+    Debug("export") << "+ exported sort `" << from_t << "' to `" << to_t << "'" << std::endl;
+    return out;
+  }
   NodeBuilder<> children(to, n.getKind());
   if(n.getKind() == kind::SORT_TYPE) {
     Debug("export") << "type: operator: " << n.getOperator() << std::endl;
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "base/check.h"
+#include "expr/export_cache.h"
 #include "expr/expr_manager_scope.h"
 #include "expr/node.h"
 #include "expr/node_algorithm.h"
@@ -33,7 +34,7 @@ ${includes}
 // compiler directs the user to the template file instead of the
 // generated one.  We don't want the user to modify the generated one,
 // since it'll get overwritten on a later build.
-#line 37 "${template}"
+#line 38 "${template}"
 
 using namespace CVC4::kind;
 using namespace std;
@@ -155,29 +156,30 @@ static Node exportConstant(TNode n, NodeManager* to, ExprManagerMapCollection& v
 
 class ExportPrivate {
 private:
-  typedef std::unordered_map <NodeTemplate<false>, NodeTemplate<true>, TNodeHashFunction> ExportCache;
   ExprManager* d_from;
   ExprManager* d_to;
   ExprManagerMapCollection& d_vmap;
   uint32_t d_flags;
-  ExportCache d_exportCache;
-
- public:
-  ExportPrivate(ExprManager* from,
-                ExprManager* to,
-                ExprManagerMapCollection& vmap,
-                uint32_t flags)
-      : d_from(from), d_to(to), d_vmap(vmap), d_flags(flags)
+  /** The translations of the nodes exported with d_vmap so far */
+  ExportCache::Table& d_exportCache;
+  /** The statistics of the source NodeManager */
+  ExportStatistics& d_stats;
+
+  static ExportCache::Table& getTable(ExprManager* from,
+                                      ExprManager* to,
+                                      ExprManagerMapCollection& vmap,
+                                      uint32_t flags)
   {
-  }
-  Node exportInternal(TNode n) {
-
-    if(n.isNull()) return Node::null();
-    if(theory::kindToTheoryId(n.getKind()) == theory::THEORY_DATATYPES) {
-      throw ExportUnsupportedException
-        ("export of node belonging to theory of DATATYPES kinds unsupported");
+    if (vmap.d_exportCache == nullptr)
+    {
+      vmap.d_exportCache = std::make_shared<ExportCache>();
     }
+    return vmap.d_exportCache->getTable(from, to, flags);
+  }
 
+  /** Export n, which is a constant, a nullary operator or a variable. */
+  Node exportLeaf(TNode n)
+  {
     if(n.getMetaKind() == metakind::CONSTANT) {
       if(n.getKind() == kind::EMPTYSET) {
         Type type = d_from->exportType(
@@ -278,43 +280,123 @@ private:
         Assert(to_e.getExprManager() == d_to);
         return Node::fromExpr(to_e);
       }
-    } else {
-      if (d_exportCache.find(n) != d_exportCache.end())
-      {
-        return d_exportCache[n];
-      }
+    }
+    Unreachable();
+  }
 
-      std::vector<Node> children;
-      Debug("export") << "n: " << n << std::endl;
-      if(n.getMetaKind() == kind::metakind::PARAMETERIZED) {
-        Debug("export") << "+ parameterized, op is " << n.getOperator() << std::endl;
-        children.reserve(n.getNumChildren() + 1);
-        children.push_back(exportInternal(n.getOperator()));
-      } else {
-        children.reserve(n.getNumChildren());
-      }
-      for(TNode::iterator i = n.begin(), i_end = n.end(); i != i_end; ++i) {
-        Debug("export") << "+ child: " << *i << std::endl;
-        children.push_back(exportInternal(*i));
+ public:
+  ExportPrivate(ExprManager* from,
+                ExprManager* to,
+                ExprManagerMapCollection& vmap,
+                uint32_t flags)
+      : d_from(from),
+        d_to(to),
+        d_vmap(vmap),
+        d_flags(flags),
+        d_exportCache(getTable(from, to, vmap, flags)),
+        d_stats(*NodeManager::fromExprManager(from)->getExportStatistics())
+  {
+  }
+
+  /**
+   * Export the nodes of ns, in one pass over their subterms, and append the
+   * translations to out.  The subterms are translated children first, so
+   * the translation does not recurse on the depth of the nodes.
+   */
+  void exportAll(const std::vector<TNode>& ns, std::vector<Node>& out)
+  {
+    // the exporting of constants may export other nodes with the same
+    // statistics, hence the timer must be reentrant
+    TimerStat::CodeTimer exportTimer(d_stats.d_exportTime, true);
+    NodeManager* from_nm = NodeManager::fromExprManager(d_from);
+    NodeManager* to_nm = NodeManager::fromExprManager(d_to);
+    // the nodes to export, and whether their children have been exported
+    std::vector<std::pair<TNode, bool>> visit;
+    for (TNode root : ns)
+    {
+      if (root.isNull())
+      {
+        out.push_back(Node::null());
+        continue;
       }
-      if(Debug.isOn("export")) {
-        Debug("export") << "children for export from " << n << std::endl;
-
-        // `n` belongs to the `from` ExprManager, so begin ExprManagerScope
-        // after printing `n`
-        ExprManagerScope ems(*d_to);
-        for(std::vector<Node>::iterator i = children.begin(), i_end = children.end(); i != i_end; ++i) {
-          Debug("export") << "  child: " << *i << std::endl;
+      visit.push_back(std::make_pair(root, false));
+      do
+      {
+        TNode cur = visit.back().first;
+        if (d_exportCache.find(cur.getId()) != d_exportCache.end())
+        {
+          ++d_stats.d_cacheHits;
+          visit.pop_back();
+          continue;
         }
-      }
-
-      // FIXME thread safety
-      Node ret =
-          NodeManager::fromExprManager(d_to)->mkNode(n.getKind(), children);
-
-      d_exportCache[n] = ret;
-      return ret;
+        if (theory::kindToTheoryId(cur.getKind()) == theory::THEORY_DATATYPES)
+        {
+          throw ExportUnsupportedException(
+              "export of node belonging to theory of DATATYPES kinds "
+              "unsupported");
+        }
+        kind::MetaKind mk = cur.getMetaKind();
+        if (mk == metakind::CONSTANT || mk == metakind::NULLARY_OPERATOR
+            || mk == metakind::VARIABLE)
+        {
+          Node ret = exportLeaf(cur);
+          d_exportCache[cur.getId()] = ret;
+          ++d_stats.d_exportedNodes;
+          visit.pop_back();
+        }
+        else if (!visit.back().second)
+        {
+          visit.back().second = true;
+          if (mk == kind::metakind::PARAMETERIZED)
+          {
+            visit.push_back(std::make_pair(cur.getOperator(), false));
+          }
+          for (TNode cn : cur)
+          {
+            visit.push_back(std::make_pair(cn, false));
+          }
+        }
+        else
+        {
+          std::vector<Node> children;
+          Debug("export") << "n: " << cur << std::endl;
+          if (mk == kind::metakind::PARAMETERIZED)
+          {
+            children.reserve(cur.getNumChildren() + 1);
+            children.push_back(d_exportCache[cur.getOperator().getId()]);
+          }
+          else
+          {
+            children.reserve(cur.getNumChildren());
+          }
+          for (TNode cn : cur)
+          {
+            children.push_back(d_exportCache[cn.getId()]);
+          }
+          // FIXME thread safety
+          Node ret = to_nm->mkNode(cur.getKind(), children);
+          if (from_nm->getAttribute(cur, TypeCheckedAttr()))
+          {
+            // the copy of a well-typed node is well-typed, don't check it
+            // again in the target
+            TrustedTypeScope tts(to_nm);
+            to_nm->getType(ret, true);
+          }
+          d_exportCache[cur.getId()] = ret;
+          ++d_stats.d_exportedNodes;
+          visit.pop_back();
+        }
+      } while (!visit.empty());
+      out.push_back(d_exportCache[root.getId()]);
     }
+  }
+
+  Node exportInternal(TNode n)
+  {
+    std::vector<TNode> ns(1, n);
+    std::vector<Node> out;
+    exportAll(ns, out);
+    return out[0];
   }/* exportInternal() */
 
 };
@@ -323,12 +405,63 @@ private:
 
 Expr Expr::exportTo(ExprManager* exprManager, ExprManagerMapCollection& variableMap,
                     uint32_t flags /* = 0 */) const {
+  if (isNull())
+  {
+    // e.g. the assumption of a check-sat without one, which has no manager
+    return Expr(exprManager, new Node());
+  }
   Assert(d_exprManager != exprManager)
       << "No sense in cloning an Expr in the same ExprManager";
   ExprManagerScope ems(*this);
   return Expr(exprManager, new Node(expr::ExportPrivate(d_exprManager, exprManager, variableMap, flags).exportInternal(*d_node)));
 }
 
+std::vector<Expr> Expr::exportTo(const std::vector<Expr>& es,
+                                 ExprManager* exprManager,
+                                 ExprManagerMapCollection& variableMap,
+                                 uint32_t flags)
+{
+  std::vector<Expr> ret;
+  // null expressions have no manager, the others give the one to export from
+  ExprManager* from = nullptr;
+  for (const Expr& e : es)
+  {
+    if (!e.isNull())
+    {
+      from = e.d_exprManager;
+      break;
+    }
+  }
+  if (from == nullptr)
+  {
+    for (size_t i = 0, size = es.size(); i < size; ++i)
+    {
+      ret.push_back(Expr(exprManager, new Node()));
+    }
+    return ret;
+  }
+  Assert(from != exprManager)
+      << "No sense in cloning an Expr in the same ExprManager";
+  ExprManagerScope ems(*from);
+  std::vector<TNode> ns;
+  ns.reserve(es.size());
+  for (const Expr& e : es)
+  {
+    Assert(e.isNull() || e.d_exprManager == from)
+        << "Exprs exported together must belong to the same ExprManager";
+    ns.push_back(*e.d_node);
+  }
+  std::vector<Node> out;
+  out.reserve(es.size());
+  expr::ExportPrivate(from, exprManager, variableMap, flags).exportAll(ns, out);
+  ret.reserve(out.size());
+  for (const Node& n : out)
+  {
+    ret.push_back(Expr(exprManager, new Node(n)));
+  }
+  return ret;
+}
+
 Expr& Expr::operator=(const Expr& e) {
   Assert(d_node != NULL) << "Unexpected NULL expression pointer!";
   Assert(e.d_node != NULL) << "Unexpected NULL expression pointer!";
@@ -34,6 +34,7 @@ ${includes}
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "base/exception.h"
 #include "options/language.h"
@@ -43,7 +44,7 @@ ${includes}
 // compiler directs the user to the template file instead of the
 // generated one.  We don't want the user to modify the generated one,
 // since it'll get overwritten on a later build.
-#line 47 "${template}"
+#line 48 "${template}"
 
 namespace CVC4 {
 
@@ -586,6 +587,17 @@ public:
    */
   Expr exportTo(ExprManager* exprManager, ExprManagerMapCollection& variableMap, uint32_t flags = 0) const;
 
+  /**
+   * Maps the Exprs of es, which must belong to the same ExprManager, into
+   * exprManager in one pass over their subexpressions.  The translations are
+   * recorded in variableMap, so subexpressions that were exported with it
+   * before, by either version of exportTo(), are not translated again.
+   */
+  static std::vector<Expr> exportTo(const std::vector<Expr>& es,
+                                    ExprManager* exprManager,
+                                    ExprManagerMapCollection& variableMap,
+                                    uint32_t flags = 0);
+
   /**
    * Very basic pretty printer for Expr.
    * This is equivalent to calling e.getNode().printAst(...)
@@ -621,7 +633,7 @@ private:
 
 ${getConst_instantiations}
 
-#line 625 "${template}"
+#line 637 "${template}"
 
 inline size_t ExprHashFunction::operator()(CVC4::Expr e) const {
   return (size_t) e.getId();
@@ -163,6 +163,18 @@ struct TNodeHashFunction {
   inline size_t operator()(TNode node) const;
 };/* struct TNodeHashFunction */
 
+/**
+ * Hash nodes by their structural hash rather than by id.  For caches whose
+ * keys come from different NodeManagers, or whose layout must not depend on
+ * the order in which nodes were created.
+ */
+struct NodeStructuralHashFunction {
+  inline size_t operator()(Node node) const;
+};/* struct NodeStructuralHashFunction */
+struct TNodeStructuralHashFunction {
+  inline size_t operator()(TNode node) const;
+};/* struct TNodeStructuralHashFunction */
+
 /**
  * Encapsulation of an NodeValue pointer.  The reference count is
  * maintained in the NodeValue if ref_count is true.
@@ -483,6 +495,16 @@ public:
     return d_nv->getId();
   }
 
+  /**
+   * Returns the structural hash of this node, which is the same for equal
+   * terms of different NodeManagers.  @see expr::NodeValue::getStructuralHash
+   */
+  uint64_t getStructuralHash() const
+  {
+    assertTNodeNotExpired();
+    return d_nv->getStructuralHash();
+  }
+
   /**
    * Returns a node representing the operator of this expression.
    * If this is an APPLY_UF, then the operator will be a functional term.
@@ -1007,6 +1029,12 @@ inline size_t NodeHashFunction::operator()(Node node) const {
 inline size_t TNodeHashFunction::operator()(TNode node) const {
   return node.getId();
 }
+inline size_t NodeStructuralHashFunction::operator()(Node node) const {
+  return node.getStructuralHash();
+}
+inline size_t TNodeStructuralHashFunction::operator()(TNode node) const {
+  return node.getStructuralHash();
+}
 
 using TNodePairHashFunction =
     PairHashFunction<TNode, TNode, TNodeHashFunction, TNodeHashFunction>;
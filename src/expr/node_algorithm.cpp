@@ -19,6 +19,7 @@
 
 #include "expr/attribute.h"
 #include "expr/dtype.h"
+#include "expr/node_traversal.h"
 
 namespace CVC4 {
 namespace expr {
@@ -30,8 +31,8 @@ bool hasSubterm(TNode n, TNode t, bool strict)
     return true;
   }
 
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  std::vector<TNode> toProcess;
+  NodeTraversal tr;
+  std::vector<TNode>& toProcess = tr.stack();
 
   toProcess.push_back(n);
 
@@ -59,13 +60,8 @@ bool hasSubterm(TNode n, TNode t, bool strict)
       {
         return true;
       }
-      if (visited.find(child) != visited.end())
+      if (tr.visit(child))
       {
-        continue;
-      }
-      else
-      {
-        visited.insert(child);
         toProcess.push_back(child);
       }
     }
@@ -131,17 +127,16 @@ bool hasSubtermMulti(TNode n, TNode t)
 
 bool hasSubtermKind(Kind k, Node n)
 {
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  std::vector<TNode> visit;
+  NodeTraversal tr;
+  std::vector<TNode>& visit = tr.stack();
   TNode cur;
   visit.push_back(n);
   do
   {
     cur = visit.back();
     visit.pop_back();
-    if (visited.find(cur) == visited.end())
+    if (tr.visit(cur))
     {
-      visited.insert(cur);
       if (cur.getKind() == k)
       {
         return true;
@@ -166,8 +161,8 @@ bool hasSubterm(TNode n, const std::vector<Node>& t, bool strict)
     return true;
   }
 
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  std::vector<TNode> toProcess;
+  NodeTraversal tr;
+  std::vector<TNode>& toProcess = tr.stack();
 
   toProcess.push_back(n);
 
@@ -195,13 +190,8 @@ bool hasSubterm(TNode n, const std::vector<Node>& t, bool strict)
       {
         return true;
       }
-      if (visited.find(child) != visited.end())
-      {
-        continue;
-      }
-      else
+      if (tr.visit(child))
       {
-        visited.insert(child);
         toProcess.push_back(child);
       }
     }
@@ -292,13 +282,22 @@ bool hasClosure(Node n)
   return n.getAttribute(HasClosureAttr());
 }
 
-bool getFreeVariables(TNode n,
-                      std::unordered_set<Node, NodeHashFunction>& fvs,
-                      bool computeFv)
+namespace {
+
+/**
+ * Add the free variables of n to fvs, or return true as soon as one is found
+ * if computeFv is false.  The nodes visited by tr are skipped.  The aux marks
+ * of tr hold the variables bound at the current node, and the quantifiers
+ * whose variables have been unbound again; bound variables and quantifiers
+ * are distinct nodes, so the two uses do not interfere.
+ */
+bool getFreeVariablesInternal(NodeTraversal& tr,
+                              TNode n,
+                              std::unordered_set<Node, NodeHashFunction>& fvs,
+                              bool computeFv)
 {
-  std::unordered_set<TNode, TNodeHashFunction> bound_var;
-  std::unordered_map<TNode, bool, TNodeHashFunction> visited;
-  std::vector<TNode> visit;
+  NodeIdMarks& bound = tr.aux();
+  std::vector<TNode>& visit = tr.stack();
   TNode cur;
   visit.push_back(n);
   do
@@ -312,13 +311,11 @@ bool getFreeVariables(TNode n,
     }
     Kind k = cur.getKind();
     bool isQuant = cur.isClosure();
-    std::unordered_map<TNode, bool, TNodeHashFunction>::iterator itv =
-        visited.find(cur);
-    if (itv == visited.end())
+    if (tr.visit(cur))
     {
       if (k == kind::BOUND_VARIABLE)
       {
-        if (bound_var.find(cur) == bound_var.end())
+        if (!bound.isMarked(cur))
         {
           if (computeFv)
           {
@@ -335,13 +332,12 @@ bool getFreeVariables(TNode n,
         for (const TNode& cn : cur[0])
         {
           // should not shadow
-          Assert(bound_var.find(cn) == bound_var.end());
-          bound_var.insert(cn);
+          Assert(!bound.isMarked(cn));
+          bound.mark(cn);
         }
+        // must visit quantifiers again to clean up below
         visit.push_back(cur);
       }
-      // must visit quantifiers again to clean up below
-      visited[cur] = !isQuant;
       if (cur.hasOperator())
       {
         visit.push_back(cur.getOperator());
@@ -351,33 +347,30 @@ bool getFreeVariables(TNode n,
         visit.push_back(cn);
       }
     }
-    else if (!itv->second)
+    else if (isQuant && bound.mark(cur))
     {
-      Assert(isQuant);
       for (const TNode& cn : cur[0])
       {
-        bound_var.erase(cn);
+        bound.unmark(cn);
       }
-      visited[cur] = true;
     }
   } while (!visit.empty());
 
   return !fvs.empty();
 }
 
-bool getVariables(TNode n, std::unordered_set<TNode, TNodeHashFunction>& vs)
+bool getVariablesInternal(NodeTraversal& tr,
+                          TNode n,
+                          std::unordered_set<TNode, TNodeHashFunction>& vs)
 {
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  std::vector<TNode> visit;
+  std::vector<TNode>& visit = tr.stack();
   TNode cur;
   visit.push_back(n);
   do
   {
     cur = visit.back();
     visit.pop_back();
-    std::unordered_set<TNode, TNodeHashFunction>::iterator itv =
-        visited.find(cur);
-    if (itv == visited.end())
+    if (tr.visit(cur))
     {
       if (cur.isVar())
       {
@@ -390,17 +383,109 @@ bool getVariables(TNode n, std::unordered_set<TNode, TNodeHashFunction>& vs)
           visit.push_back(cn);
         }
       }
-      visited.insert(cur);
     }
   } while (!visit.empty());
 
   return !vs.empty();
 }
 
+void getSymbolsInternal(NodeTraversal& tr,
+                        TNode n,
+                        std::unordered_set<Node, NodeHashFunction>& syms)
+{
+  std::vector<TNode>& visit = tr.stack();
+  TNode cur;
+  visit.push_back(n);
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (tr.visit(cur))
+    {
+      if (cur.isVar() && cur.getKind() != kind::BOUND_VARIABLE)
+      {
+        syms.insert(cur);
+      }
+      if (cur.hasOperator())
+      {
+        visit.push_back(cur.getOperator());
+      }
+      for (TNode cn : cur)
+      {
+        visit.push_back(cn);
+      }
+    }
+  } while (!visit.empty());
+}
+
+void getOperatorsMapInternal(
+    NodeTraversal& tr,
+    TNode n,
+    std::map<TypeNode, std::unordered_set<Node, NodeHashFunction>>& ops)
+{
+  NodeManager* nm = NodeManager::currentNM();
+  std::vector<TNode>& visit = tr.stack();
+  TNode cur;
+  visit.push_back(n);
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (tr.visit(cur))
+    {
+      if (cur.hasOperator())
+      {
+        ops[cur.getType()].insert(nm->operatorOf(cur.getKind()));
+      }
+      for (TNode cn : cur)
+      {
+        visit.push_back(cn);
+      }
+    }
+  } while (!visit.empty());
+}
+
+}  // namespace
+
+bool getFreeVariables(TNode n,
+                      std::unordered_set<Node, NodeHashFunction>& fvs,
+                      bool computeFv)
+{
+  NodeTraversal tr;
+  return getFreeVariablesInternal(tr, n, fvs, computeFv);
+}
+
+bool getVariables(TNode n, std::unordered_set<TNode, TNodeHashFunction>& vs)
+{
+  NodeTraversal tr;
+  return getVariablesInternal(tr, n, vs);
+}
+
+bool getVariables(const std::vector<Node>& ns,
+                  std::unordered_set<TNode, TNodeHashFunction>& vs)
+{
+  NodeTraversal tr;
+  for (const Node& n : ns)
+  {
+    getVariablesInternal(tr, n, vs);
+  }
+  return !vs.empty();
+}
+
 void getSymbols(TNode n, std::unordered_set<Node, NodeHashFunction>& syms)
 {
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  getSymbols(n, syms, visited);
+  NodeTraversal tr;
+  getSymbolsInternal(tr, n, syms);
+}
+
+void getSymbols(const std::vector<Node>& ns,
+                std::unordered_set<Node, NodeHashFunction>& syms)
+{
+  NodeTraversal tr;
+  for (const Node& n : ns)
+  {
+    getSymbolsInternal(tr, n, syms);
+  }
 }
 
 void getSymbols(TNode n,
@@ -437,8 +522,19 @@ void getOperatorsMap(
     TNode n,
     std::map<TypeNode, std::unordered_set<Node, NodeHashFunction>>& ops)
 {
-  std::unordered_set<TNode, TNodeHashFunction> visited;
-  getOperatorsMap(n, ops, visited);
+  NodeTraversal tr;
+  getOperatorsMapInternal(tr, n, ops);
+}
+
+void getOperatorsMap(
+    const std::vector<Node>& ns,
+    std::map<TypeNode, std::unordered_set<Node, NodeHashFunction>>& ops)
+{
+  NodeTraversal tr;
+  for (const Node& n : ns)
+  {
+    getOperatorsMapInternal(tr, n, ops);
+  }
 }
 
 void getOperatorsMap(
@@ -458,6 +554,7 @@ void getOperatorsMap(
     // if cur is in the cache, do nothing
     if (visited.find(cur) == visited.end())
     {
+      visited.insert(cur);
       // fetch the correct type
       TypeNode tn = cur.getType();
       // add the current operator to the result
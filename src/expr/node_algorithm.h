@@ -106,6 +106,16 @@ bool getFreeVariables(TNode n,
  */
 bool getVariables(TNode n, std::unordered_set<TNode, TNodeHashFunction>& vs);
 
+/**
+ * Get all variables in the nodes of ns, in one traversal of their shared
+ * subterms.
+ * @param ns The nodes under investigation
+ * @param vs The set which variables are added to
+ * @return true iff vs is non-empty.
+ */
+bool getVariables(const std::vector<Node>& ns,
+                  std::unordered_set<TNode, TNodeHashFunction>& vs);
+
 /**
  * For term n, this function collects the symbols that occur as a subterms
  * of n. A symbol is a variable that does not have kind BOUND_VARIABLE.
@@ -114,6 +124,15 @@ bool getVariables(TNode n, std::unordered_set<TNode, TNodeHashFunction>& vs);
  */
 void getSymbols(TNode n, std::unordered_set<Node, NodeHashFunction>& syms);
 
+/**
+ * Same as above, for all nodes of ns.  Subterms shared between the nodes of
+ * ns are visited once.
+ * @param ns The nodes under investigation
+ * @param syms The set which the symbols of ns are added to
+ */
+void getSymbols(const std::vector<Node>& ns,
+                std::unordered_set<Node, NodeHashFunction>& syms);
+
 /**
  * For term n, this function collects the symbols that occur as a subterms
  * of n. A symbol is a variable that does not have kind BOUND_VARIABLE.
@@ -135,6 +154,17 @@ void getOperatorsMap(
     TNode n,
     std::map<TypeNode, std::unordered_set<Node, NodeHashFunction>>& ops);
 
+/**
+ * Same as above, for all nodes of ns.  Subterms shared between the nodes of
+ * ns are visited once.
+ * @param ns The nodes under investigation
+ * @param ops The map (from each type to operators of that type) which the
+ * operators of ns are added to
+ */
+void getOperatorsMap(
+    const std::vector<Node>& ns,
+    std::map<TypeNode, std::unordered_set<Node, NodeHashFunction>>& ops);
+
 /**
  * For term n, this function collects the operators that occur in n.
  * @param n The node under investigation
@@ -94,12 +94,12 @@
  **         cause any problems.  The existing NodeManager pool entry
  **         is returned.
  **
- **   2(b). The heap-allocated d_nv is "cropped" to the correct size
- **         (based on the number of children it _actually_ has).  d_nv
- **         is repointed to d_inlineNv so that destruction of the
- **         NodeBuilder doesn't cause any problems, and the (old)
- **         value it had is placed into the NodeManager's pool and
- **         returned in a Node wrapper.
+ **   2(b). The heap-allocated d_nv is copied into storage obtained
+ **         from the NodeManager's NodeValue allocator and deallocated.
+ **         d_nv is repointed to d_inlineNv so that destruction of the
+ **         NodeBuilder doesn't cause any problems, and the new value
+ **         is placed into the NodeManager's pool and returned in a
+ **         Node wrapper.
  **
  ** NOTE IN 1(b) AND 2(b) THAT we can NOT create Node wrapper
  ** temporary for the NodeValue in the NodeBuilder<>::operator Node()
@@ -316,34 +316,6 @@ class NodeBuilder {
    */
   void decrRefCounts();
 
-  /**
-   * Trim d_nv down to the size it needs to be for the number of
-   * children it has.  Used when a Node is extracted from a
-   * NodeBuilder and we want the returned memory not to suffer from
-   * internal fragmentation.  If d_nv was not heap-allocated by this
-   * class, or is already the right size, this function does nothing.
-   *
-   * @throws bad_alloc if the reallocation fails
-   */
-  void crop() {
-    if(__builtin_expect( ( nvIsAllocated() ), false ) &&
-       __builtin_expect( ( d_nvMaxChildren > d_nv->d_nchildren ), true )) {
-      // Ensure d_nv is not modified on allocation failure
-      expr::NodeValue* newBlock = (expr::NodeValue*)
-        std::realloc(d_nv,
-                     sizeof(expr::NodeValue) +
-                     ( sizeof(expr::NodeValue*) * d_nv->d_nchildren ));
-      if(newBlock == NULL) {
-        // In this case, d_nv was NOT freed.  If we throw, the
-        // deallocation should occur on destruction of the
-        // NodeBuilder.
-        throw std::bad_alloc();
-      }
-      d_nv = newBlock;
-      d_nvMaxChildren = d_nv->d_nchildren;
-    }
-  }
-
   // used by convenience node builders
   NodeBuilder<nchild_thresh>& collapseTo(Kind k) {
     AssertArgument(k != kind::UNDEFINED_KIND &&
@@ -740,6 +712,7 @@ public:
 
 #include "expr/node.h"
 #include "expr/node_manager.h"
+#include "expr/node_value_allocator.h"
 #include "options/expr_options.h"
 
 namespace CVC4 {
@@ -934,17 +907,15 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv = (expr::NodeValue*)
-      std::malloc(sizeof(expr::NodeValue));
-    if(nv == NULL) {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nvAllocator->allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
     nv->d_kind = d_nv->d_kind;
     nv->d_id = d_nm->next_id++;// FIXME multithreading
     nv->d_rc = 0;
+    nv->d_hash = expr::NodeValue::hashMix(
+        expr::NodeValue::hashCombine(nv->d_kind, nv->d_id));
     setUsed();
     if(Debug.isOn("gc")) {
       Debug("gc") << "creating node value " << nv
@@ -981,6 +952,7 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
      ** allocated "inline" in this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have
+    d_inlineNv.computeStructuralHash();
     expr::NodeValue* poolNv = d_nm->poolLookup(&d_inlineNv);
     // If something else is there, we reuse it
     if(poolNv != NULL) {
@@ -1012,14 +984,11 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
        * reference count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nvAllocator->allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
+      nv->d_hash = d_inlineNv.d_hash;
       nv->d_id = d_nm->next_id++;// FIXME multithreading
       nv->d_rc = 0;
 
@@ -1045,6 +1014,7 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
      ** buffer that was heap-allocated by this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have (with insert)
+    d_nv->computeStructuralHash();
     expr::NodeValue* poolNv = d_nm->poolLookup(d_nv);
     // If something else is there, we reuse it
     if(poolNv != NULL) {
@@ -1065,16 +1035,27 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() {
       /* Subcase (b) The Node under construction is NOT already in the
        * NodeManager's pool. */
 
-      /* 2(b). The heap-allocated d_nv is "cropped" to the correct
-       * size (based on the number of children it _actually_ has).
+      /* 2(b). The NodeManager owns the storage of all pooled
+       * NodeValues, so the heap-allocated d_nv is copied into storage
+       * obtained from the NodeManager's allocator and then freed.  The
+       * child reference counts are "taken over" by the new NodeValue.
        * d_nv is repointed to d_inlineNv so that destruction of the
-       * NodeBuilder doesn't cause any problems, and the (old) value
-       * it had is placed into the NodeManager's pool and returned in
-       * a Node wrapper. */
+       * NodeBuilder doesn't cause any problems, and the new value is
+       * placed into the NodeManager's pool and returned in a Node
+       * wrapper. */
 
-      crop();
-      expr::NodeValue* nv = d_nv;
+      expr::NodeValue* nv = d_nm->d_nvAllocator->allocate(d_nv->d_nchildren);
+      nv->d_nchildren = d_nv->d_nchildren;
+      nv->d_kind = d_nv->d_kind;
+      nv->d_hash = d_nv->d_hash;
       nv->d_id = d_nm->next_id++;// FIXME multithreading
+      nv->d_rc = 0;
+
+      std::copy(d_nv->d_children,
+                d_nv->d_children + d_nv->d_nchildren,
+                nv->d_children);
+
+      free(d_nv);
       d_nv = &d_inlineNv;
       d_nvMaxChildren = nchild_thresh;
       setUsed();
@@ -1114,17 +1095,15 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
            "no children permitted";
 
     // we have to copy the inline NodeValue out
-    expr::NodeValue* nv = (expr::NodeValue*)
-      std::malloc(sizeof(expr::NodeValue));
-    if(nv == NULL) {
-      throw std::bad_alloc();
-    }
+    expr::NodeValue* nv = d_nm->d_nvAllocator->allocate(0);
     // there are no children, so we don't have to worry about
     // reference counts in this case.
     nv->d_nchildren = 0;
     nv->d_kind = d_nv->d_kind;
     nv->d_id = d_nm->next_id++;// FIXME multithreading
     nv->d_rc = 0;
+    nv->d_hash = expr::NodeValue::hashMix(
+        expr::NodeValue::hashCombine(nv->d_kind, nv->d_id));
     Debug("gc") << "creating node value " << nv
                 << " [" << nv->d_id << "]: " << *nv << "\n";
     return nv;
@@ -1164,6 +1143,7 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
      ** allocated "inline" in this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have
+    const_cast<expr::NodeValue&>(d_inlineNv).computeStructuralHash();
     expr::NodeValue* poolNv = d_nm->poolLookup(const_cast<expr::NodeValue*>(&d_inlineNv));
     // If something else is there, we reuse it
     if(poolNv != NULL) {
@@ -1189,14 +1169,11 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
        * count. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_inlineNv.d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv =
+          d_nm->d_nvAllocator->allocate(d_inlineNv.d_nchildren);
       nv->d_nchildren = d_inlineNv.d_nchildren;
       nv->d_kind = d_inlineNv.d_kind;
+      nv->d_hash = d_inlineNv.d_hash;
       nv->d_id = d_nm->next_id++;// FIXME multithreading
       nv->d_rc = 0;
 
@@ -1221,6 +1198,7 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
      ** buffer that was heap-allocated by this NodeBuilder. **/
 
     // Lookup the expression value in the pool we already have (with insert)
+    d_nv->computeStructuralHash();
     expr::NodeValue* poolNv = d_nm->poolLookup(d_nv);
     // If something else is there, we reuse it
     if(poolNv != NULL) {
@@ -1243,14 +1221,10 @@ expr::NodeValue* NodeBuilder<nchild_thresh>::constructNV() const {
        * decremented to match at NodeBuilder destruction time. */
 
       // create the canonical expression value for this node
-      expr::NodeValue* nv = (expr::NodeValue*)
-        std::malloc(sizeof(expr::NodeValue) +
-                    ( sizeof(expr::NodeValue*) * d_nv->d_nchildren ));
-      if(nv == NULL) {
-        throw std::bad_alloc();
-      }
+      expr::NodeValue* nv = d_nm->d_nvAllocator->allocate(d_nv->d_nchildren);
       nv->d_nchildren = d_nv->d_nchildren;
       nv->d_kind = d_nv->d_kind;
+      nv->d_hash = d_nv->d_hash;
       nv->d_id = d_nm->next_id++;// FIXME multithreading
       nv->d_rc = 0;
 
@@ -18,6 +18,7 @@
 #include "expr/node_manager.h"
 
 #include <algorithm>
+#include <chrono>
 #include <stack>
 #include <utility>
 
@@ -25,9 +26,12 @@
 #include "base/listener.h"
 #include "expr/attribute.h"
 #include "expr/dtype.h"
+#include "expr/export_cache.h"
 #include "expr/node_manager_attributes.h"
 #include "expr/node_manager_listeners.h"
+#include "expr/node_value_allocator.h"
 #include "expr/type_checker.h"
+#include "options/expr_options.h"
 #include "options/options.h"
 #include "options/smt_options.h"
 #include "util/resource_manager.h"
@@ -91,16 +95,99 @@ namespace attr {
 // attribute that stores the canonical bound variable list for function types
 typedef expr::Attribute<attr::LambdaBoundVarListTag, Node> LambdaBoundVarListAttr;
 
+class NodeManager::ZombieStatistics
+{
+ public:
+  ZombieStatistics(StatisticsRegistry* registry)
+      : d_registry(registry),
+        d_passes("expr::NodeManager::zombieReclaimPasses", 0),
+        d_reclaimed("expr::NodeManager::zombiesReclaimed", 0),
+        d_reclaimTime("expr::NodeManager::zombieReclaimTime"),
+        d_avgPause("expr::NodeManager::zombieReclaimAvgPause"),
+        d_maxPause("expr::NodeManager::zombieReclaimMaxPause", 0.0)
+  {
+    d_registry->registerStat(&d_passes);
+    d_registry->registerStat(&d_reclaimed);
+    d_registry->registerStat(&d_reclaimTime);
+    d_registry->registerStat(&d_avgPause);
+    d_registry->registerStat(&d_maxPause);
+  }
+
+  ~ZombieStatistics()
+  {
+    d_registry->unregisterStat(&d_passes);
+    d_registry->unregisterStat(&d_reclaimed);
+    d_registry->unregisterStat(&d_reclaimTime);
+    d_registry->unregisterStat(&d_avgPause);
+    d_registry->unregisterStat(&d_maxPause);
+  }
+
+  /** The registry the statistics are registered with. */
+  StatisticsRegistry* d_registry;
+  /** Number of reclamation passes. */
+  IntStat d_passes;
+  /** Number of zombies deleted. */
+  IntStat d_reclaimed;
+  /** Total time spent reclaiming zombies. */
+  TimerStat d_reclaimTime;
+  /** Average duration of a pass, in seconds. */
+  AverageStat d_avgPause;
+  /** Longest duration of a pass, in seconds. */
+  BackedStat<double> d_maxPause;
+};
+
+namespace {
+
+/**
+ * Measures the duration of a zombie reclamation pass and records it in
+ * the given statistics on destruction.
+ */
+class ZombiePauseTimer
+{
+ public:
+  ZombiePauseTimer(TimerStat& timer, AverageStat& avg, BackedStat<double>& max)
+      : d_timer(timer),
+        d_avg(avg),
+        d_max(max),
+        d_start(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~ZombiePauseTimer()
+  {
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - d_start)
+                         .count();
+    d_avg.addEntry(seconds);
+    if (seconds > d_max.getData())
+    {
+      d_max.setData(seconds);
+    }
+  }
+
+ private:
+  CodeTimer d_timer;
+  AverageStat& d_avg;
+  BackedStat<double>& d_max;
+  std::chrono::steady_clock::time_point d_start;
+};
+
+}  // namespace
+
 NodeManager::NodeManager(ExprManager* exprManager)
     : d_options(new Options()),
       d_statisticsRegistry(new StatisticsRegistry()),
       d_resourceManager(new ResourceManager(*d_statisticsRegistry, *d_options)),
       d_registrations(new ListenerRegistrationList()),
+      d_nvAllocator(new expr::NodeValueAllocator(d_statisticsRegistry)),
       next_id(0),
       d_attrManager(new expr::attr::AttributeManager()),
       d_exprManager(exprManager),
       d_nodeUnderDeletion(NULL),
       d_inReclaimZombies(false),
+      d_trustedTypeDepth(0),
+      d_zombieStats(new ZombieStatistics(d_statisticsRegistry)),
+      d_exportStats(new expr::ExportStatistics(d_statisticsRegistry)),
       d_abstractValueCount(0),
       d_skolemCounter(0)
 {
@@ -112,11 +199,15 @@ NodeManager::NodeManager(ExprManager* exprManager, const Options& options)
       d_statisticsRegistry(new StatisticsRegistry()),
       d_resourceManager(new ResourceManager(*d_statisticsRegistry, *d_options)),
       d_registrations(new ListenerRegistrationList()),
+      d_nvAllocator(new expr::NodeValueAllocator(d_statisticsRegistry)),
       next_id(0),
       d_attrManager(new expr::attr::AttributeManager()),
       d_exprManager(exprManager),
       d_nodeUnderDeletion(NULL),
       d_inReclaimZombies(false),
+      d_trustedTypeDepth(0),
+      d_zombieStats(new ZombieStatistics(d_statisticsRegistry)),
+      d_exportStats(new expr::ExportStatistics(d_statisticsRegistry)),
       d_abstractValueCount(0),
       d_skolemCounter(0)
 {
@@ -125,6 +216,13 @@ NodeManager::NodeManager(ExprManager* exprManager, const Options& options)
 }
 
 void NodeManager::init() {
+  d_zombieReclaimMode = (*d_options)[options::zombieReclaimMode];
+  d_zombieThreshold = (*d_options)[options::zombieThreshold];
+  d_zombieReclaimBudget = std::max(1u, (*d_options)[options::zombieReclaimBudget]);
+  d_zombieMemoryLimit =
+      static_cast<uint64_t>((*d_options)[options::zombieMemoryLimit]) << 20;
+  d_zombieReclaimFloor = 0;
+
   poolInsert( &expr::NodeValue::null() );
 
   for(unsigned i = 0; i < unsigned(kind::LAST_KIND); ++i) {
@@ -228,6 +326,12 @@ NodeManager::~NodeManager() {
   }
 
   // defensive coding, in case destruction-order issues pop up (they often do)
+  delete d_zombieStats;
+  d_zombieStats = NULL;
+  delete d_exportStats;
+  d_exportStats = NULL;
+  delete d_nvAllocator;
+  d_nvAllocator = NULL;
   delete d_resourceManager;
   d_resourceManager = NULL;
   delete d_statisticsRegistry;
@@ -254,7 +358,6 @@ const DType& NodeManager::getDTypeForIndex(unsigned index) const
 }
 
 void NodeManager::reclaimZombies() {
-  // FIXME multithreading
   Assert(!d_attrManager->inGarbageCollection());
 
   Debug("gc") << "reclaiming " << d_zombies.size() << " zombie(s)!\n";
@@ -266,6 +369,10 @@ void NodeManager::reclaimZombies() {
   // whether exit is normal or exceptional, the Reclaim dtor is called
   // and ensures that d_inReclaimZombies is set back to false.
   ScopedBool r(d_inReclaimZombies);
+  ZombiePauseTimer timer(d_zombieStats->d_reclaimTime,
+                         d_zombieStats->d_avgPause,
+                         d_zombieStats->d_maxPause);
+  ++d_zombieStats->d_passes;
 
   // We copy the set away and clear the NodeManager's set of zombies.
   // This is because reclaimZombie() decrements the RC of the
@@ -287,6 +394,7 @@ void NodeManager::reclaimZombies() {
                  back_inserter(zombies),
                  NodeValueReferenceCountNonZero());
   d_zombies.clear();
+  d_zombieQueue.clear();
 
 #ifdef _LIBCPP_VERSION
   NodeValue* last = NULL;
@@ -304,59 +412,129 @@ void NodeManager::reclaimZombies() {
     last = nv;
 #endif
 
-    // collect ONLY IF still zero
-    if(nv->d_rc == 0) {
-      if(Debug.isOn("gc")) {
-        Debug("gc") << "deleting node value " << nv
-                    << " [" << nv->d_id << "]: ";
-        nv->printAst(Debug("gc"));
-        Debug("gc") << endl;
-      }
+    reclaimZombie(nv);
+  }
+  d_zombieReclaimFloor = d_zombies.size() + d_zombieThreshold / 8;
+}/* NodeManager::reclaimZombies() */
 
-      // remove from the pool
-      kind::MetaKind mk = nv->getMetaKind();
-      if(mk != kind::metakind::VARIABLE && mk != kind::metakind::NULLARY_OPERATOR) {
-        poolRemove(nv);
-      }
+void NodeManager::reclaimZombiesIncrementally()
+{
+  Assert(!d_attrManager->inGarbageCollection());
+  Assert(!d_inReclaimZombies)
+      << "NodeManager::reclaimZombiesIncrementally() not re-entrant!";
 
-      // whether exit is normal or exceptional, the NVReclaim dtor is
-      // called and ensures that d_nodeUnderDeletion is set back to
-      // NULL.
-      NVReclaim rc(d_nodeUnderDeletion);
-      d_nodeUnderDeletion = nv;
-
-      // remove attributes
-      { // notify listeners of deleted node
-        TNode n;
-        n.d_nv = nv;
-        nv->d_rc = 1; // so that TNode doesn't assert-fail
-        for (NodeManagerListener* listener : d_listeners)
-        {
-          listener->nmNotifyDeleteNode(n);
-        }
-        // this would mean that one of the listeners stowed away
-        // a reference to this node!
-        Assert(nv->d_rc == 1);
+  ScopedBool r(d_inReclaimZombies);
+  ZombiePauseTimer timer(d_zombieStats->d_reclaimTime,
+                         d_zombieStats->d_avgPause,
+                         d_zombieStats->d_maxPause);
+  ++d_zombieStats->d_passes;
+
+  // As in reclaimZombies(), the zombies of this pass are moved out of
+  // d_zombies first, since reclaiming them may zombify their children.
+  // Zombies that have been resurrected are dropped without counting
+  // against the budget; they are added again once their reference count
+  // drops to zero.
+  vector<NodeValue*> zombies;
+  if (d_zombieReclaimMode == options::ZombieReclaimMode::LRU)
+  {
+    while (zombies.size() < d_zombieReclaimBudget && !d_zombieQueue.empty())
+    {
+      NodeValue* nv = d_zombieQueue.front();
+      d_zombieQueue.pop_front();
+      d_zombies.erase(nv);
+      if (nv->d_rc == 0)
+      {
+        zombies.push_back(nv);
       }
-      nv->d_rc = 0;
-      d_attrManager->deleteAllAttributes(nv);
-
-      // decr ref counts of children
-      nv->decrRefCounts();
-      if(mk == kind::metakind::CONSTANT) {
-        // Destroy (call the destructor for) the C++ type representing
-        // the constant in this NodeValue.  This is needed for
-        // e.g. CVC4::Rational, since it has a gmp internal
-        // representation that mallocs memory and should be cleaned
-        // up.  (This won't delete a pointer value if used as a
-        // constant, but then, you should probably use a smart-pointer
-        // type for a constant payload.)
-        kind::metakind::deleteNodeValueConstant(nv);
+    }
+  }
+  else
+  {
+    NodeValueIDSet::iterator it = d_zombies.begin();
+    while (zombies.size() < d_zombieReclaimBudget && it != d_zombies.end())
+    {
+      if ((*it)->d_rc == 0)
+      {
+        zombies.push_back(*it);
+      }
+      it = d_zombies.erase(it);
+    }
+  }
+  Debug("gc") << "reclaiming " << zombies.size() << " of "
+              << (zombies.size() + d_zombies.size()) << " zombie(s)\n";
+
+  for (NodeValue* nv : zombies)
+  {
+    reclaimZombie(nv);
+  }
+  d_zombieReclaimFloor = d_zombies.size() + d_zombieThreshold / 8;
+}
+
+void NodeManager::reclaimZombie(NodeValue* nv)
+{
+  Assert(d_inReclaimZombies);
+  // collect ONLY IF still zero
+  if(nv->d_rc == 0) {
+    if(Debug.isOn("gc")) {
+      Debug("gc") << "deleting node value " << nv
+                  << " [" << nv->d_id << "]: ";
+      nv->printAst(Debug("gc"));
+      Debug("gc") << endl;
+    }
+
+    // remove from the pool
+    kind::MetaKind mk = nv->getMetaKind();
+    if(mk != kind::metakind::VARIABLE && mk != kind::metakind::NULLARY_OPERATOR) {
+      poolRemove(nv);
+    }
+
+    // whether exit is normal or exceptional, the NVReclaim dtor is
+    // called and ensures that d_nodeUnderDeletion is set back to
+    // NULL.
+    NVReclaim rc(d_nodeUnderDeletion);
+    d_nodeUnderDeletion = nv;
+
+    // remove attributes
+    { // notify listeners of deleted node
+      TNode n;
+      n.d_nv = nv;
+      nv->d_rc = 1; // so that TNode doesn't assert-fail
+      for (NodeManagerListener* listener : d_listeners)
+      {
+        listener->nmNotifyDeleteNode(n);
       }
+      // this would mean that one of the listeners stowed away
+      // a reference to this node!
+      Assert(nv->d_rc == 1);
+    }
+    nv->d_rc = 0;
+    d_attrManager->deleteAllAttributes(nv);
+
+    // decr ref counts of children
+    nv->decrRefCounts();
+    if(mk == kind::metakind::CONSTANT) {
+      // Destroy (call the destructor for) the C++ type representing
+      // the constant in this NodeValue.  This is needed for
+      // e.g. CVC4::Rational, since it has a gmp internal
+      // representation that mallocs memory and should be cleaned
+      // up.  (This won't delete a pointer value if used as a
+      // constant, but then, you should probably use a smart-pointer
+      // type for a constant payload.)
+      kind::metakind::deleteNodeValueConstant(nv);
       free(nv);
     }
+    else
+    {
+      d_nvAllocator->deallocate(nv, nv->d_nchildren);
+    }
+    ++d_zombieStats->d_reclaimed;
   }
-}/* NodeManager::reclaimZombies() */
+}
+
+uint64_t NodeManager::getNodeValueMemory() const
+{
+  return d_nvAllocator->getBytesLive();
+}
 
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots) {
@@ -414,6 +592,12 @@ TypeNode NodeManager::getType(TNode n, bool check)
   //
   NodeManagerScope nms(this);
 
+#ifndef CVC4_ASSERTIONS
+  // in a TrustedTypeScope, n is only typed but recorded as checked below
+  bool trusted = check && d_trustedTypeDepth > 0;
+  check = check && !trusted;
+#endif /* CVC4_ASSERTIONS */
+
   TypeNode typeNode;
   bool hasType = getAttribute(n, TypeAttr(), typeNode);
   bool needsCheck = check && !getAttribute(n, TypeCheckedAttr());
@@ -465,6 +649,13 @@ TypeNode NodeManager::getType(TNode n, bool check)
   /* The check should have happened, if we asked for it. */
   Assert(!check || getAttribute(n, TypeCheckedAttr()));
 
+#ifndef CVC4_ASSERTIONS
+  if (trusted)
+  {
+    setAttribute(n, TypeCheckedAttr(), true);
+  }
+#endif /* CVC4_ASSERTIONS */
+
   Debug("getType") << "type of " << &n << " " <<  n << " is " << typeNode << endl;
   return typeNode;
 }
@@ -477,8 +668,10 @@ Node NodeManager::mkSkolem(const std::string& prefix, const TypeNode& type, cons
     stringstream name;
     name << prefix << '_' << ++d_skolemCounter;
     setAttribute(n, expr::VarNameAttr(), name.str());
+    setNamedHash(n, name.str(), type, true);
   } else {
     setAttribute(n, expr::VarNameAttr(), prefix);
+    setNamedHash(n, prefix, type);
   }
   if((flags & SKOLEM_NO_NOTIFY) == 0) {
     for(vector<NodeManagerListener*>::iterator i = d_listeners.begin(); i != d_listeners.end(); ++i) {
@@ -604,6 +797,28 @@ void NodeManager::reclaimZombiesUntil(uint32_t k){
   }
 }
 
+void NodeManager::setNamedHash(TNode n,
+                               const std::string& name,
+                               TypeNode type,
+                               bool uniqueName)
+{
+  expr::NodeValue* nv = n.d_nv;
+  Assert(nv->getMetaKind() == kind::metakind::VARIABLE);
+  uint64_t hash = expr::NodeValue::hashCombine(
+      nv->d_kind, std::hash<std::string>()(name));
+  if (!type.isNull())
+  {
+    hash = expr::NodeValue::hashCombine(hash, type.getStructuralHash());
+  }
+  if (!uniqueName)
+  {
+    // Variables of the same name (e.g., bound variables) must not all have
+    // the same hash, or the nodes over them collide in the pool
+    hash = expr::NodeValue::hashCombine(hash, d_namedHashCounts[hash]++);
+  }
+  nv->d_hash = expr::NodeValue::hashMix(hash);
+}
+
 size_t NodeManager::poolSize() const{
   return d_nodeValuePool.size();
 }
@@ -622,6 +837,7 @@ TypeNode NodeManager::mkSort(uint32_t flags) {
 TypeNode NodeManager::mkSort(const std::string& name, uint32_t flags) {
   NodeBuilder<1> nb(this, kind::SORT_TYPE);
   Node sortTag = NodeBuilder<0>(this, kind::SORT_TAG);
+  setNamedHash(sortTag, name, TypeNode::null());
   nb << sortTag;
   TypeNode tn = nb.constructTypeNode();
   setAttribute(tn, expr::VarNameAttr(), name);
@@ -664,6 +880,7 @@ TypeNode NodeManager::mkSortConstructor(const std::string& name,
   Assert(arity > 0);
   NodeBuilder<> nb(this, kind::SORT_TYPE);
   Node sortTag = NodeBuilder<0>(this, kind::SORT_TAG);
+  setNamedHash(sortTag, name, TypeNode::null());
   nb << sortTag;
   TypeNode type = nb.constructTypeNode();
   setAttribute(type, expr::VarNameAttr(), name);
@@ -679,6 +896,7 @@ Node NodeManager::mkVar(const std::string& name, const TypeNode& type, uint32_t
   setAttribute(n, TypeAttr(), type);
   setAttribute(n, TypeCheckedAttr(), true);
   setAttribute(n, expr::VarNameAttr(), name);
+  setNamedHash(n, name, type);
   setAttribute(n, expr::GlobalVarAttr(), flags & ExprManager::VAR_FLAG_GLOBAL);
   for(std::vector<NodeManagerListener*>::iterator i = d_listeners.begin(); i != d_listeners.end(); ++i) {
     (*i)->nmNotifyNewVar(n, flags);
@@ -692,6 +910,7 @@ Node* NodeManager::mkVarPtr(const std::string& name,
   setAttribute(*n, TypeAttr(), type);
   setAttribute(*n, TypeCheckedAttr(), true);
   setAttribute(*n, expr::VarNameAttr(), name);
+  setNamedHash(*n, name, type);
   setAttribute(*n, expr::GlobalVarAttr(), flags & ExprManager::VAR_FLAG_GLOBAL);
   for(std::vector<NodeManagerListener*>::iterator i = d_listeners.begin(); i != d_listeners.end(); ++i) {
     (*i)->nmNotifyNewVar(*n, flags);
@@ -702,6 +921,7 @@ Node* NodeManager::mkVarPtr(const std::string& name,
 Node NodeManager::mkBoundVar(const std::string& name, const TypeNode& type) {
   Node n = mkBoundVar(type);
   setAttribute(n, expr::VarNameAttr(), name);
+  setNamedHash(n, name, type);
   return n;
 }
 
@@ -709,6 +929,7 @@ Node* NodeManager::mkBoundVarPtr(const std::string& name,
                                  const TypeNode& type) {
   Node* n = mkBoundVarPtr(type);
   setAttribute(*n, expr::VarNameAttr(), name);
+  setNamedHash(*n, name, type);
   return n;
 }
 
@@ -781,6 +1002,9 @@ Node NodeManager::mkNullaryOperator(const TypeNode& type, Kind k) {
   std::map< TypeNode, Node >::iterator it = d_unique_vars[k].find( type );
   if( it==d_unique_vars[k].end() ){
     Node n = NodeBuilder<0>(this, k).constructNode();
+    // unique for its kind and type, so hash it by them
+    n.d_nv->d_hash = expr::NodeValue::hashMix(expr::NodeValue::hashCombine(
+        n.d_nv->d_kind, type.getStructuralHash()));
     setAttribute(n, TypeAttr(), type);
     //setAttribute(n, TypeCheckedAttr(), true);
     d_unique_vars[k][type] = n;
@@ -799,7 +1023,6 @@ Node NodeManager::mkAbstractValue(const TypeNode& type) {
 }
 
 bool NodeManager::safeToReclaimZombies() const{
-  // FIXME multithreading
   return !d_inReclaimZombies && !d_attrManager->inGarbageCollection();
 }
 
@@ -28,14 +28,18 @@
 #ifndef CVC4__NODE_MANAGER_H
 #define CVC4__NODE_MANAGER_H
 
+#include <deque>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "base/check.h"
 #include "expr/kind.h"
 #include "expr/metakind.h"
 #include "expr/node_value.h"
+#include "expr/node_value_pool.h"
+#include "options/expr_options.h"
 #include "options/options.h"
 
 namespace CVC4 {
@@ -51,6 +55,9 @@ namespace expr {
     class AttributeManager;
   }/* CVC4::expr::attr namespace */
 
+  class DagReader;
+  class ExportStatistics;
+  class NodeValueAllocator;
   class TypeChecker;
 }/* CVC4::expr namespace */
 
@@ -80,15 +87,33 @@ class NodeManagerListener {
   virtual void nmNotifyDeleteNode(TNode n) {}
 }; /* class NodeManagerListener */
 
+/**
+ * The NodeManager owns all the Nodes of an ExprManager and guarantees that
+ * structurally equal Nodes share one NodeValue.
+ *
+ * Several NodeManagers may be used concurrently by different threads, but a
+ * NodeManager and its Nodes must not be used by more than one thread at a
+ * time: neither the reference counts of the NodeValues nor the pool, the
+ * attribute tables and the zombie set are synchronized. To solve a problem
+ * in several threads, it can be exported to one ExprManager per thread
+ * (see Expr::exportTo()).
+ *
+ * A NodeManager shared by several threads is not supported. It would need
+ * atomic reference counts, which do not fit the refcount bitfield of
+ * NodeValue, and synchronized pool, zombie set and attribute tables, which
+ * getType() and the rewriter write to on every node.
+ */
 class NodeManager {
   template <unsigned nchild_thresh> friend class CVC4::NodeBuilder;
   friend class NodeManagerScope;
+  friend class TrustedTypeScope;
   friend class expr::NodeValue;
   friend class expr::TypeChecker;
 
   // friends so they can access mkVar() here, which is private
   friend Expr ExprManager::mkVar(const std::string&, Type, uint32_t flags);
   friend Expr ExprManager::mkVar(Type, uint32_t flags);
+  friend class expr::DagReader;
 
   // friend so it can access NodeManager's d_listeners and notify clients
   friend std::vector<DatatypeType> ExprManager::mkMutualDatatypeTypes(
@@ -99,9 +124,6 @@ class NodeManager {
     bool operator()(expr::NodeValue* nv) { return nv->d_rc > 0; }
   };
 
-  typedef std::unordered_set<expr::NodeValue*,
-                             expr::NodeValuePoolHashFunction,
-                             expr::NodeValuePoolEq> NodeValuePool;
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValueIDHashFunction,
                              expr::NodeValueIDEquality> NodeValueIDSet;
@@ -119,7 +141,15 @@ class NodeManager {
    */
   ListenerRegistrationList* d_registrations;
 
-  NodeValuePool d_nodeValuePool;
+  /**
+   * The allocator for the (non-constant) NodeValues of this NodeManager.
+   * It registers statistics with d_statisticsRegistry, so it must be
+   * deleted before the registry.
+   */
+  expr::NodeValueAllocator* d_nvAllocator;
+
+  /** The hash-consing table of this NodeManager. */
+  expr::NodeValuePool d_nodeValuePool;
 
   size_t next_id;
 
@@ -146,13 +176,61 @@ class NodeManager {
    */
   bool d_inReclaimZombies;
 
+  /** The number of TrustedTypeScopes alive for this NodeManager. */
+  unsigned d_trustedTypeDepth;
+
   /**
-   * The set of zombie nodes.  We may want to revisit this design, as
-   * we might like to delete nodes in least-recently-used order.  But
-   * we also need to avoid processing a zombie twice.
+   * The set of zombie nodes.  It is used to avoid processing a zombie
+   * twice.
    */
   NodeValueIDSet d_zombies;
 
+  /**
+   * The zombies in the order in which they were zombified.  Only used
+   * if zombies are reclaimed in least-recently-used order; the queue
+   * then holds exactly the elements of d_zombies.
+   */
+  std::deque<expr::NodeValue*> d_zombieQueue;
+
+  /** The policy for reclaiming zombies (--zombie-reclaim). */
+  options::ZombieReclaimMode d_zombieReclaimMode;
+
+  /** Zombies are reclaimed once there are more than this many. */
+  size_t d_zombieThreshold;
+
+  /** The number of zombies visited per incremental reclamation pass. */
+  size_t d_zombieReclaimBudget;
+
+  /**
+   * If non-zero, zombies are reclaimed regardless of d_zombieThreshold
+   * while the NodeValues use more than this many bytes.
+   */
+  uint64_t d_zombieMemoryLimit;
+
+  /**
+   * The number of zombies under which d_zombieMemoryLimit does not trigger
+   * a reclamation: after each pass, the zombies must grow by an eighth of
+   * d_zombieThreshold first, so that a memory use above the limit that is
+   * not due to zombies does not start a pass on every zombification.
+   */
+  size_t d_zombieReclaimFloor;
+
+  /** Statistics on the reclamation of zombies. */
+  class ZombieStatistics;
+
+  /**
+   * The statistics on zombie reclamation.  They are registered with
+   * d_statisticsRegistry, so they must be deleted before the registry.
+   */
+  ZombieStatistics* d_zombieStats;
+
+  /**
+   * The statistics on exports from this NodeManager to others.  They are
+   * registered with d_statisticsRegistry, so they must be deleted before the
+   * registry.
+   */
+  expr::ExportStatistics* d_exportStats;
+
   /**
    * NodeValues with maxed out reference counts. These live as long as the
    * NodeManager. They have a custom deallocation procedure at the very end.
@@ -215,6 +293,12 @@ class NodeManager {
    */
   unsigned d_skolemCounter;
 
+  /**
+   * The number of named variables and sort tags made so far for each hash of
+   * kind, name and type, which setNamedHash() mixes into the next one.
+   */
+  std::unordered_map<uint64_t, uint64_t> d_namedHashCounts;
+
   /**
    * Look up a NodeValue in the pool associated to this NodeManager.
    * The NodeValue argument need not be a "completely-constructed"
@@ -257,6 +341,18 @@ class NodeManager {
    */
   inline void poolRemove(expr::NodeValue* nv);
 
+  /**
+   * Set the structural hash of the (unpooled) variable or sort tag n from
+   * its kind, its name, the structural hash of its type and, unless the name
+   * is known to be unique, the number of variables that had these before,
+   * instead of its id.  Must be called before n is used as the child of
+   * another node.
+   */
+  void setNamedHash(TNode n,
+                    const std::string& name,
+                    TypeNode type,
+                    bool uniqueName = false);
+
   /**
    * Determine if nv is currently being deleted by the NodeManager.
    */
@@ -290,11 +386,27 @@ class NodeManager {
     // destructor, then `markForDeletion()` will be called on n2.
     Assert(d_zombies.find(nv) == d_zombies.end() || *d_zombies.find(nv) == nv);
 
-    d_zombies.insert(nv);  // FIXME multithreading
+    // not synchronized, a NodeManager is used by one thread at a time
+    if (d_zombies.insert(nv).second
+        && d_zombieReclaimMode == options::ZombieReclaimMode::LRU)
+    {
+      d_zombieQueue.push_back(nv);
+    }
 
     if(safeToReclaimZombies()) {
-      if(d_zombies.size() > 5000) {
-        reclaimZombies();
+      if (d_zombies.size() > d_zombieThreshold
+          || (d_zombieMemoryLimit > 0
+              && d_zombies.size() > d_zombieReclaimFloor
+              && getNodeValueMemory() > d_zombieMemoryLimit))
+      {
+        if (d_zombieReclaimMode == options::ZombieReclaimMode::ALL)
+        {
+          reclaimZombies();
+        }
+        else
+        {
+          reclaimZombiesIncrementally();
+        }
       }
     }
   }
@@ -317,6 +429,25 @@ class NodeManager {
    */
   void reclaimZombies();
 
+  /**
+   * Reclaim at most d_zombieReclaimBudget zombies, chosen according to
+   * d_zombieReclaimMode.  The remaining zombies are left for later
+   * passes, which bounds the pause caused by a single pass.
+   */
+  void reclaimZombiesIncrementally();
+
+  /**
+   * Delete the zombie nv if its reference count is still zero.  Must be
+   * called from within a reclamation pass.
+   */
+  void reclaimZombie(expr::NodeValue* nv);
+
+  /**
+   * The number of bytes used by the (non-constant) NodeValues of this
+   * NodeManager, including zombies.
+   */
+  uint64_t getNodeValueMemory() const;
+
   /**
    * It is safe to collect zombies.
    */
@@ -412,6 +543,9 @@ public:
     return d_statisticsRegistry;
   }
 
+  /** Get the statistics on exports from this NodeManager. */
+  expr::ExportStatistics* getExportStatistics() const { return d_exportStats; }
+
   /** Subscribe to NodeManager events */
   void subscribeEvents(NodeManagerListener* listener) {
     Assert(std::find(d_listeners.begin(), d_listeners.end(), listener)
@@ -929,6 +1063,9 @@ public:
    * type checking is not requested, getType() will do the minimum
    * amount of checking required to return a valid result.
    *
+   * While a TrustedTypeScope is alive, a requested check of n is skipped
+   * (except in builds with assertions), but n is recorded as checked.
+   *
    * @param n the Node for which we want a type
    * @param check whether we should check the type as we compute it
    * (default: false)
@@ -1036,6 +1173,22 @@ public:
   }
 };/* class NodeManagerScope */
 
+/**
+ * While a TrustedTypeScope is alive, getType(n, true) on its NodeManager
+ * computes the type of n without checking it, and records n as checked.
+ * This is for internal code that builds nodes it knows to be well-typed,
+ * such as copies of checked nodes.  It has no effect in builds with
+ * assertions, where such nodes are still checked.
+ */
+class TrustedTypeScope
+{
+  NodeManager* d_nm;
+
+ public:
+  TrustedTypeScope(NodeManager* nm) : d_nm(nm) { ++d_nm->d_trustedTypeDepth; }
+  ~TrustedTypeScope() { --d_nm->d_trustedTypeDepth; }
+};/* class TrustedTypeScope */
+
 /** Get the (singleton) type for booleans. */
 inline TypeNode NodeManager::booleanType() {
   return TypeNode(mkTypeConst<TypeConstant>(BOOLEAN_TYPE));
@@ -1199,25 +1352,20 @@ inline TypeNode NodeManager::mkTesterType(TypeNode domain) {
 }
 
 inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
-  NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
-  if(find == d_nodeValuePool.end()) {
-    return NULL;
-  } else {
-    return *find;
-  }
+  return d_nodeValuePool.find(nv);
 }
 
 inline void NodeManager::poolInsert(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end())
+  Assert(d_nodeValuePool.find(nv) == NULL)
       << "NodeValue already in the pool!";
-  d_nodeValuePool.insert(nv);// FIXME multithreading
+  d_nodeValuePool.insert(nv);
 }
 
 inline void NodeManager::poolRemove(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end())
+  Assert(d_nodeValuePool.find(nv) != NULL)
       << "NodeValue is not in the pool!";
 
-  d_nodeValuePool.erase(nv);// FIXME multithreading
+  d_nodeValuePool.erase(nv);
 }
 
 inline Expr NodeManager::toExpr(TNode n) {
@@ -1552,6 +1700,7 @@ NodeClass NodeManager::mkConstInternal(const T& val) {
 
   nvStack.d_children[0] =
     const_cast<expr::NodeValue*>(reinterpret_cast<const expr::NodeValue*>(&val));
+  nvStack.computeStructuralHash();
   expr::NodeValue* nv = poolLookup(&nvStack);
 
 #if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
@@ -1570,8 +1719,9 @@ NodeClass NodeManager::mkConstInternal(const T& val) {
 
   nv->d_nchildren = 0;
   nv->d_kind = kind::metakind::ConstantMap<T>::kind;
-  nv->d_id = next_id++;// FIXME multithreading
+  nv->d_id = next_id++;
   nv->d_rc = 0;
+  nv->d_hash = nvStack.d_hash;
 
   //OwningTheory::mkConst(val);
   new (&nv->d_children) T(val);
@@ -35,8 +35,17 @@ namespace attr {
 typedef Attribute<attr::VarNameTag, std::string> VarNameAttr;
 typedef Attribute<attr::GlobalVarTag(), bool> GlobalVarAttr;
 typedef Attribute<attr::SortArityTag, uint64_t> SortArityAttr;
-typedef expr::Attribute<expr::attr::TypeTag, TypeNode> TypeAttr;
-typedef expr::Attribute<expr::attr::TypeCheckedTag, bool> TypeCheckedAttr;
+// Nearly every node gets a type, so these are stored densely.
+typedef expr::Attribute<expr::attr::TypeTag,
+                        TypeNode,
+                        false,
+                        expr::attr::AttrStorageDense>
+    TypeAttr;
+typedef expr::Attribute<expr::attr::TypeCheckedTag,
+                        bool,
+                        false,
+                        expr::attr::AttrStorageDense>
+    TypeCheckedAttr;
 
 }/* CVC4::expr namespace */
 }/* CVC4 namespace */
@@ -0,0 +1,61 @@
+/*********************                                                        */
+/*! \file node_traversal.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Reusable scratch state for traversals of node DAGs
+ **/
+
+#include "expr/node_traversal.h"
+
+namespace CVC4 {
+namespace expr {
+
+namespace {
+
+/**
+ * The scratch states of the current thread that are not borrowed.  The pool
+ * is thread-local, so threads never share a scratch state, whichever
+ * NodeManager the nodes they traverse belong to.
+ */
+thread_local std::vector<std::unique_ptr<NodeTraversalScratch>> s_pool;
+
+/** The most scratch states kept in a pool */
+const size_t s_maxPoolSize = 16;
+
+}  // namespace
+
+NodeTraversal::NodeTraversal()
+{
+  if (s_pool.empty())
+  {
+    d_scratch = new NodeTraversalScratch();
+  }
+  else
+  {
+    d_scratch = s_pool.back().release();
+    s_pool.pop_back();
+  }
+}
+
+NodeTraversal::~NodeTraversal()
+{
+  d_scratch->d_visited.clear();
+  d_scratch->d_aux.clear();
+  d_scratch->d_stack.clear();
+  if (s_pool.size() < s_maxPoolSize)
+  {
+    s_pool.emplace_back(d_scratch);
+  }
+  else
+  {
+    delete d_scratch;
+  }
+}
+
+}  // namespace expr
+}  // namespace CVC4
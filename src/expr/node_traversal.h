@@ -0,0 +1,176 @@
+/*********************                                                        */
+/*! \file node_traversal.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Reusable scratch state for traversals of node DAGs
+ **
+ ** Traversals that only need a visited set and a stack can borrow both from
+ ** a per-thread pool instead of allocating a hash set per call.  The visited
+ ** set is indexed by node id and stamped with an epoch, so starting a new
+ ** traversal does not touch the marks of the previous one.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__EXPR__NODE_TRAVERSAL_H
+#define CVC4__EXPR__NODE_TRAVERSAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "expr/node.h"
+
+namespace CVC4 {
+namespace expr {
+
+/**
+ * A set of nodes, indexed by node id.  A node is in the set iff its stamp
+ * equals the current epoch, so clear() is O(1).  The stamps are stored in
+ * pages of 1024 ids that are allocated on first use.
+ *
+ * Node ids are only unique within one NodeManager: a set must not hold
+ * nodes of different NodeManagers at the same time.  The set does not keep
+ * its nodes alive.
+ */
+class NodeIdMarks
+{
+ public:
+  NodeIdMarks() : d_numPages(0), d_epoch(1) {}
+
+  /**
+   * Remove all nodes from the set.  The pages are kept for the next use,
+   * unless there are more than kMaxKeptPages of them.
+   */
+  void clear()
+  {
+    if (d_numPages > kMaxKeptPages)
+    {
+      d_pages.clear();
+      d_pages.shrink_to_fit();
+      d_numPages = 0;
+      d_epoch = 1;
+    }
+    else if (++d_epoch == 0)
+    {
+      // the stamps wrapped around, really clear them
+      for (std::unique_ptr<uint32_t[]>& p : d_pages)
+      {
+        if (p != nullptr)
+        {
+          std::fill(p.get(), p.get() + kPageSize, 0);
+        }
+      }
+      d_epoch = 1;
+    }
+  }
+
+  /** Add n to the set.  Returns true iff n was not in the set. */
+  bool mark(TNode n)
+  {
+    uint32_t& s = stamp(n.getId());
+    if (s == d_epoch)
+    {
+      return false;
+    }
+    s = d_epoch;
+    return true;
+  }
+
+  /** Remove n from the set. */
+  void unmark(TNode n)
+  {
+    uint64_t id = n.getId();
+    if ((id >> kPageBits) < d_pages.size()
+        && d_pages[id >> kPageBits] != nullptr)
+    {
+      d_pages[id >> kPageBits][id & (kPageSize - 1)] = 0;
+    }
+  }
+
+  /** Is n in the set? */
+  bool isMarked(TNode n) const
+  {
+    uint64_t id = n.getId();
+    return (id >> kPageBits) < d_pages.size()
+           && d_pages[id >> kPageBits] != nullptr
+           && d_pages[id >> kPageBits][id & (kPageSize - 1)] == d_epoch;
+  }
+
+ private:
+  static constexpr unsigned kPageBits = 10;
+  static constexpr uint64_t kPageSize = uint64_t(1) << kPageBits;
+  /** The most pages (of 4KiB) clear() keeps */
+  static constexpr size_t kMaxKeptPages = 1024;
+
+  uint32_t& stamp(uint64_t id)
+  {
+    uint64_t page = id >> kPageBits;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (d_pages[page] == nullptr)
+    {
+      d_pages[page].reset(new uint32_t[kPageSize]());
+      ++d_numPages;
+    }
+    return d_pages[page][id & (kPageSize - 1)];
+  }
+
+  /** The pages of stamps */
+  std::vector<std::unique_ptr<uint32_t[]>> d_pages;
+  /** The number of pages allocated in d_pages */
+  size_t d_numPages;
+  /** The stamp of the nodes in the set */
+  uint32_t d_epoch;
+}; /* class NodeIdMarks */
+
+/**
+ * Scratch state for one traversal: a visited set, a second set for
+ * traversal-specific bookkeeping, and a stack of nodes to visit.
+ */
+struct NodeTraversalScratch
+{
+  NodeIdMarks d_visited;
+  NodeIdMarks d_aux;
+  std::vector<TNode> d_stack;
+}; /* struct NodeTraversalScratch */
+
+/**
+ * Borrows a NodeTraversalScratch from the pool of the current thread for
+ * the lifetime of this object; the scratch is empty when borrowed.
+ * Traversals may nest, each nested traversal borrows its own scratch.
+ */
+class NodeTraversal
+{
+ public:
+  NodeTraversal();
+  ~NodeTraversal();
+
+  NodeTraversal(const NodeTraversal&) = delete;
+  NodeTraversal& operator=(const NodeTraversal&) = delete;
+
+  /** Mark n as visited.  Returns true iff it was not visited before. */
+  bool visit(TNode n) { return d_scratch->d_visited.mark(n); }
+  /** Has n been visited? */
+  bool isVisited(TNode n) const { return d_scratch->d_visited.isMarked(n); }
+  /** A second set of marks, used as the traversal sees fit */
+  NodeIdMarks& aux() { return d_scratch->d_aux; }
+  /** The stack of nodes to visit */
+  std::vector<TNode>& stack() { return d_scratch->d_stack; }
+
+ private:
+  NodeTraversalScratch* d_scratch;
+}; /* class NodeTraversal */
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__NODE_TRAVERSAL_H */
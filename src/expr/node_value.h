@@ -197,28 +197,66 @@ class NodeValue
   }
 
   /**
-   * Hash this NodeValue.  For hash_maps, hash_sets, etc.. but this is
-   * for expr package internal use only at present!  This is likely to
-   * be POORLY PERFORMING for other uses!  For example, this gives
-   * collisions for all VARIABLEs.
+   * Hash this NodeValue for the NodeManager pool.  This is the structural
+   * hash, which is computed once when the NodeValue is constructed.
    * @return the hash value of this expression.
    */
-  size_t poolHash() const
+  size_t poolHash() const { return d_hash; }
+
+  /**
+   * Get the structural hash of this NodeValue.  The hash of a constant
+   * depends only on its kind and value, the hash of a named variable only
+   * on its kind, name and type and on how many variables of the same name
+   * its NodeManager made before it, and the hash of any other pooled node
+   * only on its kind and the hashes of its children.  It is therefore the
+   * same for equal terms built by different NodeManagers (or in different
+   * runs) that declare their symbols in the same order, while variables
+   * sharing a name do not collide.  Unnamed variables are hashed by id.
+   */
+  uint64_t getStructuralHash() const { return d_hash; }
+
+  /** Scramble the bits of h (the finalizer of MurmurHash3). */
+  static inline uint64_t hashMix(uint64_t h)
+  {
+    h ^= h >> 33;
+    h *= UINT64_C(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    h *= UINT64_C(0xc4ceb9fe1a85ec53);
+    h ^= h >> 33;
+    return h;
+  }
+
+  /**
+   * Combine the hash h with the value v; the result depends on the order.
+   * Apply hashMix() to the final result.
+   */
+  static inline uint64_t hashCombine(uint64_t h, uint64_t v)
   {
+    return h ^ (v + UINT64_C(0x9e3779b97f4a7c15) + (h << 6) + (h >> 2));
+  }
+
+  /**
+   * Set the structural hash of this NodeValue from its kind and its
+   * children (or its value, if it is a constant).  Not meaningful for
+   * variables, whose hash is set by the NodeManager.
+   */
+  void computeStructuralHash()
+  {
+    uint64_t hash = d_kind;
     if (getMetaKind() == kind::metakind::CONSTANT)
     {
-      return kind::metakind::NodeValueCompare::constHash(this);
+      hash = hashCombine(hash,
+                         kind::metakind::NodeValueCompare::constHash(this));
     }
-
-    size_t hash = d_kind;
-    const_nv_iterator i = nv_begin();
-    const_nv_iterator i_end = nv_end();
-    while (i != i_end)
+    else
     {
-      hash ^= (*i)->d_id + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-      ++i;
+      for (const_nv_iterator i = nv_begin(), i_end = nv_end(); i != i_end;
+           ++i)
+      {
+        hash = hashCombine(hash, (*i)->d_hash);
+      }
     }
-    return hash;
+    d_hash = hashMix(hash);
   }
 
   static inline uint32_t kindToDKind(Kind k)
@@ -343,6 +381,9 @@ class NodeValue
   /** Number of children */
   uint32_t d_nchildren : NBITS_NCHILDREN;
 
+  /** The structural hash, @see getStructuralHash() */
+  uint64_t d_hash;
+
   /** Variable number of child nodes */
   NodeValue* d_children[0];
 }; /* class NodeValue */
@@ -364,10 +405,8 @@ NodeValue::iterator<NodeTemplate<false> > operator+(
     NodeValue::iterator<NodeTemplate<false> > i);
 
 /**
- * For hash_maps, hash_sets, etc.. but this is for expr package
- * internal use only at present!  This is likely to be POORLY
- * PERFORMING for other uses!  NodeValue::poolHash() will lead to
- * collisions for all VARIABLEs.
+ * For the NodeManager pool.  Uses the structural hash, which is
+ * precomputed, so looking up a node does not walk its children.
  */
 struct NodeValuePoolHashFunction {
   inline size_t operator()(const NodeValue* nv) const {
@@ -411,7 +450,8 @@ inline NodeValue::NodeValue(int) :
   d_id(0),
   d_rc(MAX_RC),
   d_kind(kind::NULL_EXPR),
-  d_nchildren(0) {
+  d_nchildren(0),
+  d_hash(0) {
 }
 
 inline void NodeValue::decrRefCounts() {
@@ -0,0 +1,97 @@
+/*********************                                                        */
+/*! \file node_value_allocator.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of the slab allocator for NodeValues
+ **/
+
+#include "expr/node_value_allocator.h"
+
+#include <sstream>
+
+namespace CVC4 {
+namespace expr {
+
+NodeValueAllocator::SizeClass::SizeClass()
+    : d_bump(nullptr), d_end(nullptr), d_free(nullptr), d_live(0)
+{
+}
+
+NodeValueAllocator::NodeValueAllocator(StatisticsRegistry* registry)
+    : d_bytesLive(0),
+      d_bytesReserved(0),
+      d_registry(registry),
+      d_statBytesLive("expr::NodeValueAllocator::bytesLive", d_bytesLive),
+      d_statBytesReserved("expr::NodeValueAllocator::bytesReserved",
+                          d_bytesReserved)
+{
+  d_registry->registerStat(&d_statBytesLive);
+  d_registry->registerStat(&d_statBytesReserved);
+  for (uint32_t i = 0; i <= MAX_SLAB_CHILDREN; ++i)
+  {
+    std::stringstream name;
+    name << "expr::NodeValueAllocator::liveCells" << i;
+    d_statClassLive.emplace_back(
+        new ReferenceStat<uint64_t>(name.str(), d_classes[i].d_live));
+    d_registry->registerStat(d_statClassLive.back().get());
+  }
+}
+
+NodeValueAllocator::~NodeValueAllocator()
+{
+  d_registry->unregisterStat(&d_statBytesLive);
+  d_registry->unregisterStat(&d_statBytesReserved);
+  for (const std::unique_ptr<ReferenceStat<uint64_t>>& stat : d_statClassLive)
+  {
+    d_registry->unregisterStat(stat.get());
+  }
+  for (char* chunk : d_chunks)
+  {
+    std::free(chunk);
+  }
+}
+
+void NodeValueAllocator::newChunk(SizeClass& sc, uint32_t nchildren)
+{
+  Assert(nchildren <= MAX_SLAB_CHILDREN);
+  char* chunk = static_cast<char*>(std::malloc(CHUNK_SIZE_BYTES));
+  if (chunk == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  d_chunks.push_back(chunk);
+  d_bytesReserved += CHUNK_SIZE_BYTES;
+  size_t size = getSize(nchildren);
+  sc.d_bump = chunk;
+  // the tail of the chunk that cannot hold a full cell is left unused
+  sc.d_end = chunk + (CHUNK_SIZE_BYTES / size) * size;
+}
+
+NodeValue* NodeValueAllocator::allocateLarge(uint32_t nchildren)
+{
+  size_t size = getSize(nchildren);
+  NodeValue* nv = static_cast<NodeValue*>(std::malloc(size));
+  if (nv == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  d_bytesLive += size;
+  d_bytesReserved += size;
+  return nv;
+}
+
+void NodeValueAllocator::deallocateLarge(NodeValue* nv, uint32_t nchildren)
+{
+  size_t size = getSize(nchildren);
+  std::free(nv);
+  d_bytesLive -= size;
+  d_bytesReserved -= size;
+}
+
+}  // namespace expr
+}  // namespace CVC4
@@ -0,0 +1,197 @@
+/*********************                                                        */
+/*! \file node_value_allocator.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A slab allocator for NodeValues
+ **
+ ** A slab allocator for NodeValues, with one size class per number of
+ ** children.
+ **/
+
+#include "cvc4_private.h"
+
+/* circular dependency; force node.h first */
+#include "expr/node.h"
+
+#ifndef CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+#define CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/node_value.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace expr {
+
+/**
+ * Allocates the storage for the (non-constant) NodeValues of a NodeManager.
+ *
+ * NodeValues with at most MAX_SLAB_CHILDREN children are carved out of large
+ * chunks, with one size class per number of children. Allocation is a pop
+ * from the free list of the size class or, if that is empty, a pointer bump
+ * in the current chunk of the class. Hence, nodes that are created together
+ * are placed next to each other in memory. Cells are returned to the free
+ * list of their class when the NodeManager reclaims a zombie; chunks are
+ * only released when the allocator is destroyed.
+ *
+ * NodeValues with more children are rare and are allocated with malloc().
+ *
+ * Constants are not allocated here, since the size of their payload depends
+ * on the type of the constant and not on the number of children.
+ */
+class NodeValueAllocator
+{
+ public:
+  /** Largest number of children that is served from a slab. */
+  static constexpr uint32_t MAX_SLAB_CHILDREN = 15;
+  /** The size of the chunks that slabs are carved out of. */
+  static constexpr size_t CHUNK_SIZE_BYTES = 64 * 1024;
+
+  /**
+   * Create an allocator that registers its statistics with the given
+   * registry.
+   */
+  NodeValueAllocator(StatisticsRegistry* registry);
+  /**
+   * Release all chunks. All NodeValues allocated by this allocator must have
+   * been deallocated already.
+   */
+  ~NodeValueAllocator();
+
+  /** The number of bytes needed for a NodeValue with nchildren children. */
+  static size_t getSize(uint32_t nchildren)
+  {
+    return sizeof(NodeValue) + sizeof(NodeValue*) * nchildren;
+  }
+
+  /**
+   * Allocate (uninitialized) storage for a NodeValue with nchildren
+   * children. Throws std::bad_alloc if the memory is exhausted.
+   */
+  inline NodeValue* allocate(uint32_t nchildren);
+
+  /**
+   * Return the storage of nv to this allocator. nchildren must be the number
+   * of children that the storage was allocated for.
+   */
+  inline void deallocate(NodeValue* nv, uint32_t nchildren);
+
+  /** The number of bytes currently allocated by this allocator. */
+  uint64_t getBytesLive() const { return d_bytesLive; }
+
+ private:
+  /** An unused cell, linked into the free list of its size class. */
+  struct FreeCell
+  {
+    FreeCell* d_next;
+  };
+
+  /** The state of a single size class. */
+  struct SizeClass
+  {
+    SizeClass();
+    /** Next unused cell in the current chunk. */
+    char* d_bump;
+    /** End of the usable part of the current chunk. */
+    char* d_end;
+    /** Free list of cells that have been deallocated. */
+    FreeCell* d_free;
+    /** Number of cells of this class that are currently in use. */
+    uint64_t d_live;
+  };
+
+  /**
+   * Allocate a new chunk for size class sc, which serves NodeValues with
+   * nchildren children.
+   */
+  void newChunk(SizeClass& sc, uint32_t nchildren);
+
+  /** Allocate storage for a NodeValue with too many children for a slab. */
+  NodeValue* allocateLarge(uint32_t nchildren);
+
+  /** Deallocate storage obtained with allocateLarge(). */
+  void deallocateLarge(NodeValue* nv, uint32_t nchildren);
+
+  /** The size classes, indexed by number of children. */
+  SizeClass d_classes[MAX_SLAB_CHILDREN + 1];
+
+  /** All chunks allocated so far. */
+  std::vector<char*> d_chunks;
+
+  /** Number of bytes handed out that have not been returned yet. */
+  uint64_t d_bytesLive;
+
+  /** Number of bytes obtained from the system (chunks and large cells). */
+  uint64_t d_bytesReserved;
+
+  /** The registry with which the statistics below are registered. */
+  StatisticsRegistry* d_registry;
+
+  /** Statistics on the number of live bytes. */
+  ReferenceStat<uint64_t> d_statBytesLive;
+
+  /** Statistics on the number of reserved bytes. */
+  ReferenceStat<uint64_t> d_statBytesReserved;
+
+  /** Statistics on the number of live cells in each size class. */
+  std::vector<std::unique_ptr<ReferenceStat<uint64_t>>> d_statClassLive;
+}; /* class NodeValueAllocator */
+
+inline NodeValue* NodeValueAllocator::allocate(uint32_t nchildren)
+{
+  if (__builtin_expect((nchildren > MAX_SLAB_CHILDREN), false))
+  {
+    return allocateLarge(nchildren);
+  }
+  SizeClass& sc = d_classes[nchildren];
+  void* cell;
+  if (sc.d_free != nullptr)
+  {
+    cell = sc.d_free;
+    sc.d_free = sc.d_free->d_next;
+  }
+  else
+  {
+    if (__builtin_expect((sc.d_bump == sc.d_end), false))
+    {
+      newChunk(sc, nchildren);
+    }
+    cell = sc.d_bump;
+    sc.d_bump += getSize(nchildren);
+  }
+  ++sc.d_live;
+  d_bytesLive += getSize(nchildren);
+  return static_cast<NodeValue*>(cell);
+}
+
+inline void NodeValueAllocator::deallocate(NodeValue* nv, uint32_t nchildren)
+{
+  if (__builtin_expect((nchildren > MAX_SLAB_CHILDREN), false))
+  {
+    deallocateLarge(nv, nchildren);
+    return;
+  }
+  SizeClass& sc = d_classes[nchildren];
+  Assert(sc.d_live > 0);
+  FreeCell* cell = reinterpret_cast<FreeCell*>(nv);
+  cell->d_next = sc.d_free;
+  sc.d_free = cell;
+  --sc.d_live;
+  d_bytesLive -= getSize(nchildren);
+}
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__NODE_VALUE_ALLOCATOR_H */
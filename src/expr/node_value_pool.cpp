@@ -0,0 +1,185 @@
+/*********************                                                        */
+/*! \file node_value_pool.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Implementation of the hash-consing table of the NodeManager
+ **/
+
+#include "expr/node_value_pool.h"
+
+#include <algorithm>
+
+namespace CVC4 {
+namespace expr {
+
+NodeValuePool::const_iterator::const_iterator(const NodeValuePool* pool,
+                                              bool inOld,
+                                              size_t index)
+    : d_pool(pool), d_inOld(inOld), d_index(index)
+{
+  skipEmpty();
+}
+
+const NodeValuePool::Entry& NodeValuePool::const_iterator::current() const
+{
+  return d_inOld ? d_pool->d_old[d_index] : d_pool->d_table[d_index];
+}
+
+void NodeValuePool::const_iterator::skipEmpty()
+{
+  while (true)
+  {
+    const std::vector<Entry>& table = d_inOld ? d_pool->d_old : d_pool->d_table;
+    if (d_index == table.size())
+    {
+      if (!d_inOld)
+      {
+        return;
+      }
+      d_inOld = false;
+      d_index = 0;
+    }
+    else if (isLive(table[d_index]))
+    {
+      return;
+    }
+    else
+    {
+      ++d_index;
+    }
+  }
+}
+
+NodeValuePool::NodeValuePool()
+    : d_table(INITIAL_SIZE, Entry{0, nullptr}),
+      d_mask(INITIAL_SIZE - 1),
+      d_size(0),
+      d_maxSize(INITIAL_SIZE / 4 * 3),
+      d_oldSize(0),
+      d_migrateIndex(0)
+{
+}
+
+void NodeValuePool::erase(NodeValue* nv)
+{
+  size_t hash = NodeValuePoolHashFunction()(nv);
+  size_t slot = hash & d_mask;
+  for (size_t dist = 0;; ++dist)
+  {
+    const Entry& e = d_table[slot];
+    if (e.d_nv == nullptr || probeDistance(e.d_hash, slot) < dist)
+    {
+      break;
+    }
+    if (e.d_nv == nv)
+    {
+      // shift the following entries back until one is in its home slot
+      size_t next = (slot + 1) & d_mask;
+      while (d_table[next].d_nv != nullptr
+             && probeDistance(d_table[next].d_hash, next) > 0)
+      {
+        d_table[slot] = d_table[next];
+        slot = next;
+        next = (next + 1) & d_mask;
+      }
+      d_table[slot].d_nv = nullptr;
+      --d_size;
+      return;
+    }
+    slot = (slot + 1) & d_mask;
+  }
+
+  // not in the new table, so nv must be in the old table
+  Assert(d_oldSize > 0) << "NodeValue is not in the pool!";
+  size_t mask = d_old.size() - 1;
+  for (slot = hash & mask; d_old[slot].d_nv != nullptr;
+       slot = (slot + 1) & mask)
+  {
+    if (d_old[slot].d_nv == nv)
+    {
+      d_old[slot].d_nv = tombstone();
+      if (--d_oldSize == 0)
+      {
+        migrate(d_old.size());
+      }
+      return;
+    }
+  }
+  Assert(false) << "NodeValue is not in the pool!";
+}
+
+NodeValuePool::const_iterator NodeValuePool::begin() const
+{
+  return const_iterator(this, true, 0);
+}
+
+NodeValuePool::const_iterator NodeValuePool::end() const
+{
+  return const_iterator(this, false, d_table.size());
+}
+
+NodeValue* NodeValuePool::findInOld(const NodeValue* nv, size_t hash) const
+{
+  // the old table does not receive insertions, so it is searched by plain
+  // linear probing that skips over tombstones
+  size_t mask = d_old.size() - 1;
+  for (size_t slot = hash & mask; d_old[slot].d_nv != nullptr;
+       slot = (slot + 1) & mask)
+  {
+    const Entry& e = d_old[slot];
+    if (e.d_nv != tombstone() && e.d_hash == hash
+        && NodeValuePoolEq()(e.d_nv, nv))
+    {
+      return e.d_nv;
+    }
+  }
+  return nullptr;
+}
+
+void NodeValuePool::grow()
+{
+  // Each insertion migrates MIGRATE_SLOTS_PER_INSERT slots, so the previous
+  // resize has normally finished long before the new table is full.
+  migrate(d_old.size());
+  Assert(d_oldSize == 0);
+
+  d_old.swap(d_table);
+  d_oldSize = d_size;
+  d_migrateIndex = 0;
+
+  d_table.assign(2 * d_old.size(), Entry{0, nullptr});
+  d_mask = d_table.size() - 1;
+  d_size = 0;
+  d_maxSize = d_table.size() / 4 * 3;
+}
+
+void NodeValuePool::migrate(size_t n)
+{
+  size_t end = std::min(d_migrateIndex + n, d_old.size());
+  for (; d_migrateIndex < end && d_oldSize > 0; ++d_migrateIndex)
+  {
+    Entry& e = d_old[d_migrateIndex];
+    if (isLive(e))
+    {
+      insertEntry(e);
+      ++d_size;
+      --d_oldSize;
+      // keep the probe sequences of the remaining entries intact
+      e.d_nv = tombstone();
+    }
+  }
+  if (d_oldSize == 0)
+  {
+    // release the old table
+    std::vector<Entry>().swap(d_old);
+    d_migrateIndex = 0;
+  }
+}
+
+}  // namespace expr
+}  // namespace CVC4
@@ -0,0 +1,243 @@
+/*********************                                                        */
+/*! \file node_value_pool.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The hash-consing table of the NodeManager
+ **
+ ** An open-addressing hash set of NodeValues that is used by the NodeManager
+ ** to guarantee that structurally equal nodes share one NodeValue.
+ **/
+
+#include "cvc4_private.h"
+
+/* circular dependency; force node.h first */
+#include "expr/node.h"
+
+#ifndef CVC4__EXPR__NODE_VALUE_POOL_H
+#define CVC4__EXPR__NODE_VALUE_POOL_H
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "base/check.h"
+#include "expr/metakind.h"
+#include "expr/node_value.h"
+
+namespace CVC4 {
+namespace expr {
+
+/**
+ * A hash set of NodeValues with Robin Hood open addressing.
+ *
+ * Each slot stores the NodeValue together with its pool hash, so probing
+ * only dereferences a NodeValue if the cached hashes are equal, and inserting
+ * does not allocate. Hashing and equality are those of the NodeManager pool
+ * (NodeValuePoolHashFunction and NodeValuePoolEq); in particular, lookups
+ * with "non-inlined" constants are supported.
+ *
+ * When the table is full, it is not rehashed in one go. Instead, a table of
+ * twice the size is allocated and the entries of the old table are moved to
+ * the new one a few slots at a time on each insertion, so that the cost of
+ * growing is spread over many insertions. While entries are moved, lookups
+ * and removals consult both tables.
+ */
+class NodeValuePool
+{
+  /** A slot of a table. */
+  struct Entry
+  {
+    /** The pool hash of d_nv. */
+    size_t d_hash;
+    /** The NodeValue, null if the slot is empty. */
+    NodeValue* d_nv;
+  };
+
+  /** Marks slots of the old table whose entry was moved or removed. */
+  static NodeValue* tombstone()
+  {
+    return reinterpret_cast<NodeValue*>(static_cast<uintptr_t>(1));
+  }
+
+  /** Whether e holds a NodeValue. */
+  static bool isLive(const Entry& e)
+  {
+    return e.d_nv != nullptr && e.d_nv != tombstone();
+  }
+
+ public:
+  /** Iterates over the NodeValues in the pool in no particular order. */
+  class const_iterator
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = NodeValue*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = NodeValue* const*;
+    using reference = NodeValue* const&;
+
+    const_iterator(const NodeValuePool* pool, bool inOld, size_t index);
+
+    reference operator*() const { return current().d_nv; }
+
+    const_iterator& operator++()
+    {
+      ++d_index;
+      skipEmpty();
+      return *this;
+    }
+
+    bool operator==(const const_iterator& i) const
+    {
+      return d_inOld == i.d_inOld && d_index == i.d_index;
+    }
+
+    bool operator!=(const const_iterator& i) const { return !(*this == i); }
+
+   private:
+    /** The entry this iterator points to. */
+    const Entry& current() const;
+    /** Advance to the next live entry (or the end). */
+    void skipEmpty();
+
+    const NodeValuePool* d_pool;
+    /** Whether the iterator is in the old table of an incremental resize. */
+    bool d_inOld;
+    size_t d_index;
+  }; /* class NodeValuePool::const_iterator */
+
+  NodeValuePool();
+
+  /** The number of NodeValues in the pool. */
+  size_t size() const { return d_size + d_oldSize; }
+
+  /**
+   * Find a NodeValue in the pool that is equal to nv (as defined by
+   * NodeValuePoolEq), or return null if there is none.
+   */
+  inline NodeValue* find(const NodeValue* nv) const;
+
+  /**
+   * Insert nv into the pool. It is an error to insert a NodeValue for which
+   * an equal one is already in the pool.
+   */
+  inline void insert(NodeValue* nv);
+
+  /** Remove nv from the pool. It is an error if nv is not in the pool. */
+  void erase(NodeValue* nv);
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+ private:
+  /**
+   * The distance between the slot that an entry with the given hash is
+   * stored at and its home slot.
+   */
+  size_t probeDistance(size_t hash, size_t slot) const
+  {
+    return (slot - (hash & d_mask)) & d_mask;
+  }
+
+  /** Insert an entry into d_table, which must have room for it. */
+  inline void insertEntry(Entry entry);
+
+  /** Find nv in the old table. */
+  NodeValue* findInOld(const NodeValue* nv, size_t hash) const;
+
+  /** Start an incremental resize to a table of twice the size. */
+  void grow();
+
+  /** Move the entries of the next n slots of the old table to d_table. */
+  void migrate(size_t n);
+
+  /** The table that new entries are inserted into. */
+  std::vector<Entry> d_table;
+  /** d_table.size() - 1, the table sizes are powers of two. */
+  size_t d_mask;
+  /** The number of entries in d_table. */
+  size_t d_size;
+  /** The number of entries d_table may hold before it has to grow. */
+  size_t d_maxSize;
+
+  /** The table being migrated, empty if no resize is in progress. */
+  std::vector<Entry> d_old;
+  /** The number of entries in d_old. */
+  size_t d_oldSize;
+  /** The next slot of d_old to be migrated. */
+  size_t d_migrateIndex;
+
+  /** The number of slots of d_old migrated on each insertion. */
+  static constexpr size_t MIGRATE_SLOTS_PER_INSERT = 16;
+  /** The initial number of slots. */
+  static constexpr size_t INITIAL_SIZE = 1024;
+}; /* class NodeValuePool */
+
+inline NodeValue* NodeValuePool::find(const NodeValue* nv) const
+{
+  size_t hash = NodeValuePoolHashFunction()(nv);
+  size_t slot = hash & d_mask;
+  for (size_t dist = 0;; ++dist)
+  {
+    const Entry& e = d_table[slot];
+    // Robin Hood invariant: nv would have been stored before any entry that
+    // is closer to its home slot
+    if (e.d_nv == nullptr || probeDistance(e.d_hash, slot) < dist)
+    {
+      break;
+    }
+    if (e.d_hash == hash && NodeValuePoolEq()(e.d_nv, nv))
+    {
+      return e.d_nv;
+    }
+    slot = (slot + 1) & d_mask;
+  }
+  return d_oldSize == 0 ? nullptr : findInOld(nv, hash);
+}
+
+inline void NodeValuePool::insert(NodeValue* nv)
+{
+  Assert(find(nv) == nullptr) << "NodeValue already in the pool!";
+  if (d_oldSize > 0)
+  {
+    migrate(MIGRATE_SLOTS_PER_INSERT);
+  }
+  if (d_size >= d_maxSize)
+  {
+    grow();
+  }
+  insertEntry(Entry{NodeValuePoolHashFunction()(nv), nv});
+  ++d_size;
+}
+
+inline void NodeValuePool::insertEntry(Entry entry)
+{
+  size_t slot = entry.d_hash & d_mask;
+  for (size_t dist = 0;; ++dist)
+  {
+    Entry& e = d_table[slot];
+    if (e.d_nv == nullptr)
+    {
+      e = entry;
+      return;
+    }
+    size_t edist = probeDistance(e.d_hash, slot);
+    if (edist < dist)
+    {
+      // take the slot from the entry that is closer to its home
+      std::swap(e, entry);
+      dist = edist;
+    }
+    slot = (slot + 1) & d_mask;
+  }
+}
+
+}  // namespace expr
+}  // namespace CVC4
+
+#endif /* CVC4__EXPR__NODE_VALUE_POOL_H */
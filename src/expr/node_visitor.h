@@ -31,24 +31,24 @@ namespace CVC4 {
 template<typename Visitor>
 class NodeVisitor {
 
-  /** For re-entry checking */
+  /** Is run() in progress on this thread, i.e., is s_toVisit in use? */
   static thread_local bool s_inRun;
 
   /**
-   * Guard against NodeVisitor<> being re-entrant.
+   * Marks run() in progress for its lifetime, restoring the previous state
+   * when a nested run() ends.
    */
   template <class T>
   class GuardReentry {
     T& d_guard;
+    T d_old;
   public:
     GuardReentry(T& guard)
-    : d_guard(guard) {
-      Assert(!d_guard);
+    : d_guard(guard), d_old(guard) {
       d_guard = true;
     }
     ~GuardReentry() {
-      Assert(d_guard);
-      d_guard = false;
+      d_guard = d_old;
     }
   };/* class NodeVisitor<>::GuardReentry */
 
@@ -70,18 +70,29 @@ public:
     }
   };/* struct preprocess_stack_element */
 
+private:
+
+  /** The stack of run(), kept to reuse its memory across runs */
+  static thread_local std::vector<stack_element> s_toVisit;
+
+public:
+
   /**
    * Performs the traversal.
    */
   static typename Visitor::return_type run(Visitor& visitor, TNode node) {
 
+    // A run() nested in another one, e.g. from a visitor, cannot share the
+    // stack of the outer one and uses its own
+    std::vector<stack_element> nestedToVisit;
+    std::vector<stack_element>& toVisit = s_inRun ? nestedToVisit : s_toVisit;
     GuardReentry<bool> guard(s_inRun);
 
     // Notify of a start
     visitor.start(node);
 
     // Do a reverse-topological sort of the subexpressions
-    std::vector<stack_element> toVisit;
+    toVisit.clear();
     toVisit.push_back(stack_element(node, node));
     while (!toVisit.empty()) {
       stack_element& stackHead = toVisit.back();
@@ -123,4 +134,8 @@ public:
 template <typename Visitor>
 thread_local bool NodeVisitor<Visitor>::s_inRun = false;
 
+template <typename Visitor>
+thread_local std::vector<typename NodeVisitor<Visitor>::stack_element>
+    NodeVisitor<Visitor>::s_toVisit;
+
 }/* CVC4 namespace */
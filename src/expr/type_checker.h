@@ -31,6 +31,16 @@ public:
                              TNode n,
                              bool check = false);
 
+ /**
+  * Compute the type of n in constant time per child, using the fast rule
+  * of its kind (see "fasttyperule" in the kinds files).  This only
+  * succeeds if every child of n already has a checked type and these
+  * types satisfy the rule; the result is then the type of n, and n is
+  * well-typed.  Otherwise, returns the null type and computeType() must
+  * be used, which also reports type errors.
+  */
+ static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n);
+
  static bool computeIsConst(NodeManager* nodeManager, TNode n);
 
 };/* class TypeChecker */
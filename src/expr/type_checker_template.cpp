@@ -30,7 +30,14 @@ namespace expr {
 
 TypeNode TypeChecker::computeType(NodeManager* nodeManager, TNode n, bool check)
 {
-  TypeNode typeNode;
+  TypeNode typeNode = computeTypeFast(nodeManager, n);
+  if (!typeNode.isNull())
+  {
+    // the children are checked and the fast rule holds, so n is checked too
+    nodeManager->setAttribute(n, TypeAttr(), typeNode);
+    nodeManager->setAttribute(n, TypeCheckedAttr(), true);
+    return typeNode;
+  }
 
   // Infer the type
   switch(n.getKind()) {
@@ -44,7 +51,7 @@ TypeNode TypeChecker::computeType(NodeManager* nodeManager, TNode n, bool check)
 
 ${typerules}
 
-#line 48 "${template}"
+#line 55 "${template}"
 
   default:
     Debug("getType") << "FAILURE" << std::endl;
@@ -59,6 +66,21 @@ ${typerules}
 
 }/* TypeChecker::computeType */
 
+TypeNode TypeChecker::computeTypeFast(NodeManager* nodeManager, TNode n)
+{
+  switch (n.getKind())
+  {
+${fasttyperules}
+
+#line 76 "${template}"
+
+    default:;
+  }
+
+  return TypeNode::null();
+
+}/* TypeChecker::computeTypeFast */
+
 bool TypeChecker::computeIsConst(NodeManager* nodeManager, TNode n)
 {
   Assert(n.getMetaKind() == kind::metakind::OPERATOR
@@ -68,7 +90,7 @@ bool TypeChecker::computeIsConst(NodeManager* nodeManager, TNode n)
   switch(n.getKind()) {
 ${construles}
 
-#line 72 "${template}"
+#line 94 "${template}"
 
     default:;
   }
@@ -19,14 +19,32 @@
 
 #include "cvc4_private.h"
 
+#ifndef CVC4__EXPR__TYPE_CHECKER_UTIL_H
+#define CVC4__EXPR__TYPE_CHECKER_UTIL_H
+
 #include "expr/kind.h"
 #include "expr/node.h"
 #include "expr/node_manager.h"
+#include "expr/node_manager_attributes.h"
 #include "expr/type_node.h"
 
 namespace CVC4 {
 namespace expr {
 
+/**
+ * The type of n if it has been computed and checked, and the null type
+ * otherwise.  Never computes a type; used by the fast type rules.
+ */
+inline TypeNode getCheckedType(NodeManager* nm, TNode n)
+{
+  TypeNode t;
+  if (nm->getAttribute(n, TypeCheckedAttr()))
+  {
+    nm->getAttribute(n, TypeAttr(), t);
+  }
+  return t;
+}
+
 /** Type check returns the builtin operator sort */
 struct RBuiltinOperator
 {
@@ -71,6 +89,10 @@ struct ANone
     Assert(arg >= n.getNumChildren());
     return true;
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg >= n.getNumChildren();
+  }
   constexpr static const char* typeName = "<none>";
 };
 
@@ -85,6 +107,10 @@ struct AOptional
     }
     return true;
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg >= n.getNumChildren() || A::checkArgFast(nm, n, arg);
+  }
   constexpr static const char* typeName = A::typeName;
 };
 
@@ -96,6 +122,10 @@ struct AInteger
     TypeNode t = n[arg].getType(true);
     return t.isInteger();
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg < n.getNumChildren() && getCheckedType(nm, n[arg]).isInteger();
+  }
   constexpr static const char* typeName = "integer";
 };
 
@@ -107,6 +137,10 @@ struct AReal
     TypeNode t = n[arg].getType(true);
     return t.isReal();
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg < n.getNumChildren() && getCheckedType(nm, n[arg]).isReal();
+  }
   constexpr static const char* typeName = "real";
 };
 
@@ -118,6 +152,10 @@ struct ARegExp
     TypeNode t = n[arg].getType(true);
     return t.isRegExp();
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg < n.getNumChildren() && getCheckedType(nm, n[arg]).isRegExp();
+  }
   constexpr static const char* typeName = "regexp";
 };
 
@@ -129,6 +167,10 @@ struct AString
     TypeNode t = n[arg].getType(true);
     return t.isString();
   }
+  static bool checkArgFast(NodeManager* nm, TNode n, size_t arg)
+  {
+    return arg < n.getNumChildren() && getCheckedType(nm, n[arg]).isString();
+  }
   constexpr static const char* typeName = "string";
 };
 
@@ -169,6 +211,16 @@ class SimpleTypeRule
     }
     return R::mkType(nm);
   }
+
+  static TypeNode computeTypeFast(NodeManager* nm, TNode n)
+  {
+    if (A0::checkArgFast(nm, n, 0) && A1::checkArgFast(nm, n, 1)
+        && A2::checkArgFast(nm, n, 2))
+    {
+      return R::mkType(nm);
+    }
+    return TypeNode::null();
+  }
 };
 
 /** 
@@ -197,7 +249,21 @@ class SimpleTypeRuleVar
     }
     return R::mkType(nm);
   }
+
+  static TypeNode computeTypeFast(NodeManager* nm, TNode n)
+  {
+    for (size_t i = 0, size = n.getNumChildren(); i < size; i++)
+    {
+      if (!A::checkArgFast(nm, n, i))
+      {
+        return TypeNode::null();
+      }
+    }
+    return R::mkType(nm);
+  }
 };
 
 }  // namespace expr
 }  // namespace CVC4
+
+#endif /* CVC4__EXPR__TYPE_CHECKER_UTIL_H */
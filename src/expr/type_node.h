@@ -246,6 +246,14 @@ public:
     return d_nv->getId();
   }
 
+  /**
+   * Returns the structural hash of this type node.
+   * @see expr::NodeValue::getStructuralHash
+   */
+  inline uint64_t getStructuralHash() const {
+    return d_nv->getStructuralHash();
+  }
+
   /**
    * Returns the kind of this type node.
    *
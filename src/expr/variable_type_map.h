@@ -20,12 +20,17 @@
 #ifndef CVC4__VARIABLE_TYPE_MAP_H
 #define CVC4__VARIABLE_TYPE_MAP_H
 
+#include <memory>
 #include <unordered_map>
 
 #include "expr/expr.h"
 
 namespace CVC4 {
 
+namespace expr {
+class ExportCache;
+}  // namespace expr
+
 class Expr;
 struct ExprHashFunction;
 class Type;
@@ -56,6 +61,13 @@ struct CVC4_PUBLIC ExprManagerMapCollection {
   VariableTypeMap d_typeMap;
   VarMap d_to;
   VarMap d_from;
+  /**
+   * The translations of all exported expressions, so that exporting an
+   * expression again only translates its new subexpressions.  Like
+   * d_typeMap, it holds expressions of the target ExprManagers, so the
+   * collection must be destroyed before them.
+   */
+  std::shared_ptr<expr::ExportCache> d_exportCache;
 };/* struct ExprManagerMapCollection */
 
 }/* CVC4 namespace */
@@ -121,25 +121,31 @@ void CommandExecutor::reset()
   d_solver.reset(new api::Solver(&d_options));
 }
 
-bool CommandExecutor::doCommandSingleton(Command* cmd)
+Command* CommandExecutor::invokeCommand(Command* cmd, bool& status)
 {
-  bool status = true;
   if(d_options.getVerbosity() >= -1) {
     status = smtEngineInvoke(d_smtEngine, cmd, d_options.getOut());
   } else {
     status = smtEngineInvoke(d_smtEngine, cmd, NULL);
   }
+  return cmd;
+}
+
+bool CommandExecutor::doCommandSingleton(Command* cmd)
+{
+  bool status = true;
+  const Command* done = invokeCommand(cmd, status);
 
   Result res;
-  CheckSatCommand* cs = dynamic_cast<CheckSatCommand*>(cmd);
+  const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(done);
   if(cs != NULL) {
     d_result = res = cs->getResult();
   }
-  QueryCommand* q = dynamic_cast<QueryCommand*>(cmd);
+  const QueryCommand* q = dynamic_cast<const QueryCommand*>(done);
   if(q != NULL) {
     d_result = res = q->getResult();
   }
-  CheckSynthCommand* csy = dynamic_cast<CheckSynthCommand*>(cmd);
+  const CheckSynthCommand* csy = dynamic_cast<const CheckSynthCommand*>(done);
   if(csy != NULL) {
     d_result = res = csy->getResult();
   }
@@ -98,6 +98,13 @@ protected:
   /** Executes treating cmd as a singleton */
   virtual bool doCommandSingleton(CVC4::Command* cmd);
 
+  /**
+   * Invokes cmd and prints its result.  Returns the command that holds the
+   * result, cmd itself unless overridden, and sets status to false iff the
+   * command failed.
+   */
+  virtual CVC4::Command* invokeCommand(CVC4::Command* cmd, bool& status);
+
 private:
   CommandExecutor();
 
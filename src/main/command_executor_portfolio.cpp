@@ -0,0 +1,354 @@
+/*********************                                                        */
+/*! \file command_executor_portfolio.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An additional layer between commands and invoking them, running
+ ** several solvers in parallel
+ **
+ ** An additional layer between commands and invoking them, running several
+ ** solvers in parallel.
+ **/
+
+#include "main/command_executor_portfolio.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "expr/variable_type_map.h"
+#include "options/option_exception.h"
+#include "smt/command.h"
+
+namespace CVC4 {
+namespace main {
+
+namespace {
+
+/**
+ * The option sets used for the solvers that are not given one, cycled
+ * through.  Each solver also gets its own SAT solver seed.
+ */
+const char* const s_defaultOptionSets[] = {
+    "--decision=justification",
+    "--simplification=none",
+    "--random-freq=0.05",
+};
+const size_t kNumDefaultOptionSets =
+    sizeof(s_defaultOptionSets) / sizeof(s_defaultOptionSets[0]);
+
+/** The option sets of --portfolio-opts and --portfolio-config */
+std::vector<std::string> getOptionSets(const Options& options)
+{
+  std::vector<std::string> sets;
+  std::stringstream opts(options.getPortfolioOptions());
+  std::string set;
+  while (std::getline(opts, set, ';'))
+  {
+    if (set.find_first_not_of(" \t") != std::string::npos)
+    {
+      sets.push_back(set);
+    }
+  }
+  const std::string& config = options.getPortfolioConfig();
+  if (!config.empty())
+  {
+    std::ifstream in(config);
+    if (!in.good())
+    {
+      throw OptionException("cannot open portfolio configuration " + config);
+    }
+    while (std::getline(in, set))
+    {
+      size_t start = set.find_first_not_of(" \t");
+      if (start != std::string::npos && set[start] != '#')
+      {
+        sets.push_back(set);
+      }
+    }
+  }
+  return sets;
+}
+
+/** Parse the option set into options */
+void parseOptionSet(Options& options, const std::string& set)
+{
+  std::vector<std::string> args;
+  args.push_back(options.getBinaryName());
+  std::stringstream ss(set);
+  std::string arg;
+  while (ss >> arg)
+  {
+    args.push_back(arg);
+  }
+  std::vector<char*> argv;
+  for (std::string& a : args)
+  {
+    argv.push_back(&a[0]);
+  }
+  argv.push_back(nullptr);
+  std::vector<std::string> rest =
+      Options::parseOptions(&options, args.size(), argv.data());
+  if (!rest.empty())
+  {
+    throw OptionException("portfolio option set \"" + set
+                          + "\" has a non-option argument " + rest[0]);
+  }
+}
+
+/** Is cmd a check that the solvers race on? */
+bool isCheck(const Command* cmd)
+{
+  return dynamic_cast<const CheckSatCommand*>(cmd) != nullptr
+         || dynamic_cast<const CheckSatAssumingCommand*>(cmd) != nullptr
+         || dynamic_cast<const QueryCommand*>(cmd) != nullptr;
+}
+
+/** The result of a check */
+Result getCheckResult(const Command* cmd)
+{
+  if (const CheckSatCommand* cs = dynamic_cast<const CheckSatCommand*>(cmd))
+  {
+    return cs->getResult();
+  }
+  if (const CheckSatAssumingCommand* csa =
+          dynamic_cast<const CheckSatAssumingCommand*>(cmd))
+  {
+    return csa->getResult();
+  }
+  return static_cast<const QueryCommand*>(cmd)->getResult();
+}
+
+/**
+ * The copies of a check, run in parallel on their solvers, one thread per
+ * solver.  The destructor stops the solvers that are still running.
+ */
+class Race
+{
+ public:
+  Race(const std::vector<Command*>& cmds, const std::vector<SmtEngine*>& smts)
+      : d_cmds(cmds),
+        d_smts(smts),
+        d_done(cmds.size(), false),
+        d_numDone(0),
+        d_winner(cmds.size())
+  {
+    for (size_t i = 0; i < cmds.size(); ++i)
+    {
+      d_threads.emplace_back([this, i]() {
+        d_cmds[i]->invoke(d_smts[i]);
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_done[i] = true;
+        ++d_numDone;
+        if (d_winner == d_done.size() && d_cmds[i]->ok()
+            && !getCheckResult(d_cmds[i]).isUnknown())
+        {
+          d_winner = i;
+        }
+        d_doneCond.notify_one();
+      });
+    }
+  }
+
+  ~Race()
+  {
+    {
+      std::unique_lock<std::mutex> lock(d_mutex);
+      // Interrupt the losers until they stop: a solver that is not yet in
+      // its SAT search ignores an interrupt
+      while (d_numDone < d_done.size())
+      {
+        for (size_t i = 0; i < d_done.size(); ++i)
+        {
+          if (!d_done[i])
+          {
+            d_smts[i]->interrupt();
+          }
+        }
+        d_doneCond.wait_for(lock, std::chrono::milliseconds(10));
+      }
+    }
+    for (std::thread& t : d_threads)
+    {
+      t.join();
+    }
+  }
+
+  /**
+   * Wait until one of the solvers gives a definite answer or all of them
+   * are done.  Returns the index of the winner, or of the first solver if
+   * none gave a definite answer.  The other solvers may still be running.
+   */
+  size_t wait()
+  {
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_doneCond.wait(lock, [this]() {
+      return d_winner != d_done.size() || d_numDone == d_done.size();
+    });
+    return d_winner == d_done.size() ? 0 : d_winner;
+  }
+
+ private:
+  /** The copies of the check, and the solvers that run them */
+  std::vector<Command*> d_cmds;
+  std::vector<SmtEngine*> d_smts;
+  std::mutex d_mutex;
+  std::condition_variable d_doneCond;
+  std::vector<bool> d_done;
+  size_t d_numDone;
+  size_t d_winner;
+  /** Declared last, to start once the other members are constructed */
+  std::vector<std::thread> d_threads;
+}; /* class Race */
+
+}  // namespace
+
+CommandExecutorPortfolio::CommandExecutorPortfolio(Options& options)
+    : CommandExecutor(options),
+      d_winner(0),
+      d_otherWins("portfolio::otherWins", 0)
+{
+  std::vector<std::string> sets = getOptionSets(options);
+  size_t n = options.getPortfolio();
+  if (sets.size() > n)
+  {
+    throw OptionException("more portfolio option sets than solvers");
+  }
+  for (size_t i = 0; i < n; ++i)
+  {
+    std::string set;
+    if (i < sets.size())
+    {
+      set = sets[i];
+    }
+    else if (i > 0)
+    {
+      std::stringstream ss;
+      ss << s_defaultOptionSets[(i - 1) % kNumDefaultOptionSets]
+         << " --random-seed=" << i;
+      set = ss.str();
+    }
+    if (i == 0 && set.empty())
+    {
+      // the solver of the base class has the options as given
+      continue;
+    }
+    Options opts;
+    opts.copyValues(options);
+    parseOptionSet(opts, set);
+    if (i == 0)
+    {
+      d_solver.reset(new api::Solver(&opts));
+      d_smtEngine = d_solver->getSmtEngine();
+    }
+    else
+    {
+      d_others.emplace_back(new api::Solver(&opts));
+      d_maps.emplace_back(new ExprManagerMapCollection());
+    }
+  }
+  d_copies.resize(d_others.size());
+  d_stats.registerStat(&d_otherWins);
+}
+
+CommandExecutorPortfolio::~CommandExecutorPortfolio()
+{
+  d_stats.unregisterStat(&d_otherWins);
+}
+
+api::Solver* CommandExecutorPortfolio::getSolver(size_t i) const
+{
+  return i == 0 ? d_solver.get() : d_others[i - 1].get();
+}
+
+void CommandExecutorPortfolio::flushStatistics(std::ostream& out) const
+{
+  api::Solver* winner = getSolver(d_winner);
+  winner->getExprManager()->getStatistics().flushInformation(out);
+  winner->getSmtEngine()->getStatistics().flushInformation(out);
+  d_stats.flushInformation(out);
+}
+
+Command* CommandExecutorPortfolio::invokeCommand(Command* cmd, bool& status)
+{
+  // Export the command to the other solvers, in this thread, as the export
+  // reads the expressions of the first solver
+  std::vector<Command*> cmds(1, cmd);
+  for (size_t i = 1; i < size(); ++i)
+  {
+    try
+    {
+      d_copies[i - 1].reset(cmd->exportTo(
+          getSolver(i)->getExprManager(), *d_maps[i - 1]));
+    }
+    catch (const ExportUnsupportedException& e)
+    {
+      throw OptionException("cannot run " + cmd->getCommandName()
+                            + " with --portfolio: " + e.getMessage());
+    }
+    cmds.push_back(d_copies[i - 1].get());
+  }
+
+  // The losers of a check are stopped when race is destroyed, after the
+  // answer of the winner is printed
+  std::unique_ptr<Race> race;
+  if (isCheck(cmd))
+  {
+    std::vector<SmtEngine*> smts;
+    for (size_t i = 0; i < size(); ++i)
+    {
+      smts.push_back(getSolver(i)->getSmtEngine());
+    }
+    race.reset(new Race(cmds, smts));
+    d_winner = race->wait();
+    if (d_winner > 0)
+    {
+      ++d_otherWins;
+    }
+  }
+  else
+  {
+    // The other commands change or query the state of every solver, the
+    // solver that won the last check answers
+    for (size_t i = 0; i < size(); ++i)
+    {
+      if (i != d_winner)
+      {
+        cmds[i]->invoke(getSolver(i)->getSmtEngine());
+      }
+    }
+    cmds[d_winner]->invoke(getSolver(d_winner)->getSmtEngine());
+  }
+
+  SmtEngine* smt = getSolver(d_winner)->getSmtEngine();
+  Command* done = cmds[d_winner];
+  if (d_options.getVerbosity() >= -1 && !(done->isMuted() && done->ok()))
+  {
+    done->printResult(
+        *d_options.getOut(),
+        smt->getOption("command-verbosity:" + done->getCommandName())
+            .getIntegerValue()
+            .toUnsignedInt());
+    if (race)
+    {
+      d_options.getOut()->flush();
+    }
+  }
+  // ignore the error if the command-verbosity is 0 for this command
+  status = smt->getOption("command-verbosity:" + done->getCommandName())
+                   .getIntegerValue()
+               == 0
+           || !done->fail();
+  return done;
+}
+
+}  // namespace main
+}  // namespace CVC4
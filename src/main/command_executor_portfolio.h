@@ -0,0 +1,87 @@
+/*********************                                                        */
+/*! \file command_executor_portfolio.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An additional layer between commands and invoking them, running
+ ** several solvers in parallel
+ **
+ ** The portfolio command executor runs the commands on N solvers with
+ ** different options.  The checks (check-sat, check-sat-assuming and query)
+ ** are run in parallel, one thread per solver, and the first definite
+ ** answer wins: the other solvers are interrupted.  The other commands are
+ ** run on every solver in turn, and print the output of the solver that won
+ ** the last check.
+ **/
+
+#ifndef CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H
+#define CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "main/command_executor.h"
+
+namespace CVC4 {
+
+struct ExprManagerMapCollection;
+
+namespace main {
+
+class CommandExecutorPortfolio : public CommandExecutor
+{
+ public:
+  /**
+   * Create the solvers given by the portfolio options of options: solver i
+   * gets the i-th option set of --portfolio-opts and --portfolio-config on
+   * top of options, or a default variation of options if there are fewer
+   * option sets than solvers.
+   */
+  CommandExecutorPortfolio(Options& options);
+
+  ~CommandExecutorPortfolio() override;
+
+  /** Flushes the statistics of the solver that won the last check. */
+  void flushStatistics(std::ostream& out) const override;
+
+ protected:
+  CVC4::Command* invokeCommand(CVC4::Command* cmd, bool& status) override;
+
+ private:
+  /** The number of solvers */
+  size_t size() const { return d_others.size() + 1; }
+
+  /** Solver i; solver 0 is the solver of the base class */
+  api::Solver* getSolver(size_t i) const;
+
+  /** The solvers 1 to N-1 */
+  std::vector<std::unique_ptr<api::Solver>> d_others;
+
+  /**
+   * The maps used to export the commands to the solvers 1 to N-1.  They
+   * hold expressions of the solvers, so they are declared after them.
+   */
+  std::vector<std::unique_ptr<ExprManagerMapCollection>> d_maps;
+
+  /**
+   * The copies of the last command for the solvers 1 to N-1.  They are
+   * kept until the next command, as they may hold the result.
+   */
+  std::vector<std::unique_ptr<CVC4::Command>> d_copies;
+
+  /** The solver that won the last check */
+  size_t d_winner;
+
+  /** The number of checks won by a solver other than the first one */
+  IntStat d_otherWins;
+}; /* class CommandExecutorPortfolio */
+
+}  // namespace main
+}  // namespace CVC4
+
+#endif /* CVC4__MAIN__COMMAND_EXECUTOR_PORTFOLIO_H */
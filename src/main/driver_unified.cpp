@@ -30,6 +30,7 @@
 #include "expr/expr_iomanip.h"
 #include "expr/expr_manager.h"
 #include "main/command_executor.h"
+#include "main/command_executor_portfolio.h"
 #include "main/interactive_shell.h"
 #include "main/main.h"
 #include "options/options.h"
@@ -160,6 +161,8 @@ int runCvc4(int argc, char* argv[], Options& opts) {
         opts.setInputLanguage(language::input::LANG_SYGUS);
         //since there is no sygus output language, set this to SMT lib 2
         //opts.setOutputLanguage(language::output::LANG_SMTLIB_V2_0);
+      } else if(len >= 4 && !strcmp(".dag", filename + len - 4)) {
+        opts.setInputLanguage(language::input::LANG_DAG);
       }
     }
   }
@@ -182,7 +185,19 @@ int runCvc4(int argc, char* argv[], Options& opts) {
   (*(opts.getOut())) << language::SetLanguage(opts.getOutputLanguage());
 
   // Create the command executor to execute the parsed commands
-  pExecutor = new CommandExecutor(opts);
+  if (opts.getPortfolio() > 1)
+  {
+    if (opts.getTearDownIncremental() > 0)
+    {
+      throw OptionException(
+          "--portfolio is not supported with --tear-down-incremental");
+    }
+    pExecutor = new CommandExecutorPortfolio(opts);
+  }
+  else
+  {
+    pExecutor = new CommandExecutor(opts);
+  }
 
   std::unique_ptr<Parser> replayParser;
   if (opts.getReplayInputFilename() != "")
@@ -115,6 +115,10 @@ OutputLanguage toOutputLanguage(InputLanguage language) {
     // these entries directly correspond (by design)
     return OutputLanguage(int(language));
 
+  case input::LANG_DAG:
+    // DAG files are caches of SMT-LIB inputs, so answer in SMT-LIB
+    return output::LANG_SMTLIB_V2_6;
+
   default:
     // Revert to the default (AST) language.
     //
@@ -214,6 +218,10 @@ InputLanguage toInputLanguage(std::string language) {
   {
     return input::LANG_SYGUS_V2;
   }
+  else if (language == "dag" || language == "LANG_DAG")
+  {
+    return input::LANG_DAG;
+  }
   else if (language == "auto" || language == "LANG_AUTO")
   {
     return input::LANG_AUTO;
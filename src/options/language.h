@@ -64,6 +64,8 @@ enum CVC4_PUBLIC Language
   LANG_SYGUS,
   /** The SyGuS input language version 2.0 */
   LANG_SYGUS_V2,
+  /** The binary DAG format (see expr/dag_serializer.h) */
+  LANG_DAG,
 
   // START OUTPUT-ONLY LANGUAGES AT ENUM VALUE 10
   // THESE ARE IN PRINCIPLE NOT POSSIBLE INPUT LANGUAGES
@@ -101,6 +103,7 @@ inline std::ostream& operator<<(std::ostream& out, Language lang) {
     out << "LANG_SYGUS";
     break;
   case LANG_SYGUS_V2: out << "LANG_SYGUS_V2"; break;
+  case LANG_DAG: out << "LANG_DAG"; break;
   default:
     out << "undefined_input_language";
   }
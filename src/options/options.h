@@ -223,6 +223,9 @@ public:
   bool getStatsHideZeros() const;
   bool getStrictParsing() const;
   int getTearDownIncremental() const;
+  unsigned getPortfolio() const;
+  const std::string& getPortfolioConfig() const;
+  const std::string& getPortfolioOptions() const;
   bool getVersion() const;
   const std::string& getForceLogicString() const;
   int getVerbosity() const;
@@ -35,6 +35,7 @@
 #include "options/didyoumean.h"
 #include "options/language.h"
 #include "options/option_exception.h"
+#include "options/prop_options.h"
 #include "options/smt_options.h"
 #include "options/theory_options.h"
 
@@ -244,6 +245,21 @@ void OptionsHandler::setBitblastAig(std::string option, bool arg)
   }
 }
 
+// prop/options_handlers.h
+void OptionsHandler::checkMainSatSolver(std::string option,
+                                        MainSatSolverMode m)
+{
+  if (m == MainSatSolverMode::CADICAL
+      && !Configuration::isBuiltWithCadicalDpll())
+  {
+    std::stringstream ss;
+    ss << "option `" << option
+       << "' requires a build of CVC4 configured with --cadical-dpll; this "
+          "binary was not built with the CaDiCaL DPLL(T) backend";
+    throw OptionException(ss.str());
+  }
+}
+
 // theory/options_handlers.h
 std::string OptionsHandler::handleUseTheoryList(std::string option, std::string optarg) {
   std::string currentList = options::useTheoryList();
@@ -368,6 +384,16 @@ void OptionsHandler::statsEnabledBuild(std::string option, bool value)
 #endif /* CVC4_STATISTICS_ON */
 }
 
+void OptionsHandler::checkContextChunkSize(std::string option, unsigned value)
+{
+  if (value < 64)
+  {
+    std::stringstream ss;
+    ss << "option `" << option << "' requires a chunk size of at least 64 bytes";
+    throw OptionException(ss.str());
+  }
+}
+
 void OptionsHandler::threadN(std::string option) {
   throw OptionException(option + " is not a real option by itself.  Use e.g. --thread0=\"--random-seed=10 --random-freq=0.02\" --thread1=\"--random-seed=20 --random-freq=0.05\"");
 }
@@ -472,6 +498,7 @@ void OptionsHandler::showConfiguration(std::string option) {
   print_config_cond("cln", Configuration::isBuiltWithCln());
   print_config_cond("glpk", Configuration::isBuiltWithGlpk());
   print_config_cond("cadical", Configuration::isBuiltWithCadical());
+  print_config_cond("cadical-dpll", Configuration::isBuiltWithCadicalDpll());
   print_config_cond("cryptominisat", Configuration::isBuiltWithCryptominisat());
   print_config_cond("drat2er", Configuration::isBuiltWithDrat2Er());
   print_config_cond("gmp", Configuration::isBuiltWithGmp());
@@ -30,6 +30,7 @@
 #include "options/option_exception.h"
 #include "options/options.h"
 #include "options/printer_modes.h"
+#include "options/prop_options.h"
 #include "options/quantifiers_options.h"
 
 namespace CVC4 {
@@ -72,6 +73,9 @@ public:
   void checkBvSatSolver(std::string option, SatSolverMode m);
   void checkBitblastMode(std::string option, BitblastMode m);
 
+  // prop/options_handlers.h
+  void checkMainSatSolver(std::string option, MainSatSolverMode m);
+
   void setBitblastAig(std::string option, bool arg);
 
   // theory/options_handlers.h
@@ -101,6 +105,8 @@ public:
 
   void statsEnabledBuild(std::string option, bool value);
 
+  void checkContextChunkSize(std::string option, unsigned value);
+
   unsigned long limitHandler(std::string option, std::string optarg);
 
   void notifyTlimit(const std::string& option);
@@ -154,6 +154,18 @@ int Options::getTearDownIncremental() const{
   return (*this)[options::tearDownIncremental];
 }
 
+unsigned Options::getPortfolio() const{
+  return (*this)[options::portfolio];
+}
+
+const std::string& Options::getPortfolioConfig() const{
+  return (*this)[options::portfolioConfig];
+}
+
+const std::string& Options::getPortfolioOptions() const{
+  return (*this)[options::portfolioOptions];
+}
+
 bool Options::getVersion() const{
   return (*this)[options::version];
 }
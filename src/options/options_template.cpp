@@ -439,6 +439,7 @@ Languages currently supported as arguments to the -L / --lang option:\n\
   smt2.6.1 | smtlib2.6.1         SMT-LIB format 2.6 with support for the strings standard\n\
   tptp                           TPTP format (cnf, fof and tff)\n\
   sygus | sygus2                 SyGuS version 1.0 and 2.0 formats\n\
+  dag                            binary DAG files written with --write-dag\n\
 \n\
 Languages currently supported as arguments to the --output-lang option:\n\
   auto                           match output language to input language\n\
@@ -0,0 +1,155 @@
+/*********************                                                        */
+/*! \file dag_input.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Input for the binary DAG format
+ **
+ ** Input for the binary DAG format.
+ **/
+
+#include "parser/dag/dag_input.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* _WIN32 */
+
+#include <fstream>
+#include <sstream>
+
+#include "api/cvc4cpp.h"
+#include "base/output.h"
+#include "parser/parser.h"
+#include "parser/parser_exception.h"
+#include "smt/dag_command_stream.h"
+
+namespace CVC4 {
+namespace parser {
+
+DagInputStream::DagInputStream(const std::string& filename)
+    : InputStream(filename), d_data(nullptr), d_size(0), d_mapped(false)
+{
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    throw InputStreamException("Couldn't open file: " + filename);
+  }
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+  {
+    close(fd);
+    throw InputStreamException("Couldn't stat file: " + filename);
+  }
+  d_size = st.st_size;
+  if (d_size > 0)
+  {
+    void* p = mmap(nullptr, d_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      d_data = static_cast<const char*>(p);
+      d_mapped = true;
+    }
+  }
+  close(fd);
+  if (d_mapped || d_size == 0)
+  {
+    return;
+  }
+#endif /* _WIN32 */
+  // fall back to reading the file
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+  {
+    throw InputStreamException("Couldn't open file: " + filename);
+  }
+  std::stringstream ss;
+  ss << in.rdbuf();
+  d_contents = ss.str();
+  d_data = d_contents.data();
+  d_size = d_contents.size();
+}
+
+DagInputStream::DagInputStream(const std::string& name,
+                               std::string&& contents)
+    : InputStream(name),
+      d_data(nullptr),
+      d_size(0),
+      d_mapped(false),
+      d_contents(std::move(contents))
+{
+  d_data = d_contents.data();
+  d_size = d_contents.size();
+}
+
+DagInputStream::~DagInputStream()
+{
+#ifndef _WIN32
+  if (d_mapped)
+  {
+    munmap(const_cast<char*>(d_data), d_size);
+  }
+#endif /* _WIN32 */
+}
+
+DagInput::DagInput(DagInputStream& inputStream) : Input(inputStream) {}
+
+DagInput::~DagInput() {}
+
+Command* DagInput::parseCommand()
+{
+  try
+  {
+    return d_commands->next();
+  }
+  catch (Exception& e)
+  {
+    parseError(e.getMessage());
+  }
+  return nullptr;
+}
+
+api::Term DagInput::parseExpr()
+{
+  parseError("expressions cannot be read from DAG files");
+  return api::Term();
+}
+
+void DagInput::warning(const std::string& msg)
+{
+  Warning() << getInputStream()->getName() << ": " << msg << std::endl;
+}
+
+void DagInput::parseError(const std::string& msg, bool eofException)
+{
+  if (eofException)
+  {
+    throw ParserEndOfFileException(msg, getInputStream()->getName(), 0, 0);
+  }
+  throw ParserException(msg, getInputStream()->getName(), 0, 0);
+}
+
+void DagInput::setParser(Parser& parser)
+{
+  DagInputStream* in = static_cast<DagInputStream*>(getInputStream());
+  try
+  {
+    d_commands.reset(new DagCommandStream(
+        parser.getSolver()->getExprManager(), in->data(), in->size()));
+  }
+  catch (Exception& e)
+  {
+    parseError(e.getMessage());
+  }
+}
+
+}  // namespace parser
+}  // namespace CVC4
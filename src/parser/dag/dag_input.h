@@ -0,0 +1,88 @@
+/*********************                                                        */
+/*! \file dag_input.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Input for the binary DAG format
+ **
+ ** Reads the commands of a binary DAG file (see --write-dag) without any
+ ** lexing or parsing.  Files are memory-mapped; streams and strings are read
+ ** into memory first.
+ **/
+
+#include "cvc4parser_private.h"
+
+#ifndef CVC4__PARSER__DAG_INPUT_H
+#define CVC4__PARSER__DAG_INPUT_H
+
+#include <memory>
+#include <string>
+
+#include "parser/input.h"
+
+namespace CVC4 {
+
+class DagCommandStream;
+
+namespace parser {
+
+/** The bytes of a DAG file, either mapped or held in a string. */
+class DagInputStream : public InputStream
+{
+ public:
+  /** Map the given file.  Throws an InputStreamException on failure. */
+  DagInputStream(const std::string& filename);
+  /** Take the contents of a stream or string. */
+  DagInputStream(const std::string& name, std::string&& contents);
+  ~DagInputStream() override;
+
+  const char* data() const { return d_data; }
+  size_t size() const { return d_size; }
+
+ private:
+  const char* d_data;
+  size_t d_size;
+  /** Whether d_data is a mapping that must be unmapped */
+  bool d_mapped;
+  /** The contents, unless mapped */
+  std::string d_contents;
+}; /* class DagInputStream */
+
+class DagInput : public Input
+{
+ public:
+  DagInput(DagInputStream& inputStream);
+  ~DagInput() override;
+
+ protected:
+  /**
+   * Read the next command from the file.  Returns <code>NULL</code> at the
+   * end of the file.
+   *
+   * @throws ParserException if the file is malformed
+   */
+  Command* parseCommand() override;
+
+  /** DAG files hold commands only; this always raises a parse error. */
+  api::Term parseExpr() override;
+
+  void warning(const std::string& msg) override;
+
+  void parseError(const std::string& msg, bool eofException = false) override;
+
+  /** Starts reading the file into the solver of the parser. */
+  void setParser(Parser& parser) override;
+
+ private:
+  /** The stream of commands, created by setParser() */
+  std::unique_ptr<DagCommandStream> d_commands;
+}; /* class DagInput */
+
+}  // namespace parser
+}  // namespace CVC4
+
+#endif /* CVC4__PARSER__DAG_INPUT_H */
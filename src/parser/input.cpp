@@ -19,8 +19,11 @@
 
 #include "parser/input.h"
 
+#include <sstream>
+
 #include "base/output.h"
 #include "expr/type.h"
+#include "parser/dag/dag_input.h"
 #include "parser/parser.h"
 #include "parser/parser_exception.h"
 #include "smt/command.h"
@@ -58,6 +61,10 @@ Input* Input::newFileInput(InputLanguage lang,
                            const std::string& filename,
                            bool useMmap)
 {
+  if (lang == language::input::LANG_DAG)
+  {
+    return new DagInput(*new DagInputStream(filename));
+  }
   AntlrInputStream *inputStream = 
     AntlrInputStream::newFileInputStream(filename, useMmap);
   return AntlrInput::newInput(lang, *inputStream);
@@ -68,6 +75,12 @@ Input* Input::newStreamInput(InputLanguage lang,
                              const std::string& name,
                              bool lineBuffered)
 {
+  if (lang == language::input::LANG_DAG)
+  {
+    std::stringstream ss;
+    ss << input.rdbuf();
+    return new DagInput(*new DagInputStream(name, ss.str()));
+  }
   AntlrInputStream *inputStream =
     AntlrInputStream::newStreamInputStream(input, name, lineBuffered);
   return AntlrInput::newInput(lang, *inputStream);
@@ -77,6 +90,10 @@ Input* Input::newStringInput(InputLanguage lang,
                              const std::string& str,
                              const std::string& name)
 {
+  if (lang == language::input::LANG_DAG)
+  {
+    return new DagInput(*new DagInputStream(name, std::string(str)));
+  }
   AntlrInputStream *inputStream = AntlrInputStream::newStringInputStream(str, name);
   return AntlrInput::newInput(lang, *inputStream);
 }
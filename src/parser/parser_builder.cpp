@@ -96,6 +96,9 @@ Parser* ParserBuilder::build()
     case language::input::LANG_TPTP:
       parser = new Tptp(d_solver, input, d_strictMode, d_parseOnly);
       break;
+    case language::input::LANG_DAG:
+      parser = new Parser(d_solver, input, d_strictMode, d_parseOnly);
+      break;
     default:
       if (language::isInputLang_smt2(d_lang))
       {
@@ -50,12 +50,8 @@ void PreprocessingPassContext::enableIntegers()
 void PreprocessingPassContext::recordSymbolsInAssertions(
     const std::vector<Node>& assertions)
 {
-  std::unordered_set<TNode, TNodeHashFunction> visited;
   std::unordered_set<Node, NodeHashFunction> syms;
-  for (TNode cn : assertions)
-  {
-    expr::getSymbols(cn, syms, visited);
-  }
+  expr::getSymbols(assertions, syms);
   for (const Node& s : syms)
   {
     d_symsInAssertions.insert(s);
@@ -486,7 +486,7 @@ Node ITECompressor::compressTerm(Node toCompress)
 
 Node ITECompressor::compressBoolean(Node toCompress)
 {
-  static int instance = 0;
+  static thread_local int instance = 0;
   ++instance;
   if (toCompress.isConst() || toCompress.isVar())
   {
@@ -648,6 +648,9 @@ ITESimplifier::ITESimplifier(ContainsTermITEVisitor* contains)
       d_constantLeaves(),
       d_allocatedConstantLeaves(),
       d_citeEqConstApplications(0),
+      d_numBranches(0),
+      d_numFalseBranches(0),
+      d_itesMade(0),
       d_constantIteEqualsConstantCache(),
       d_replaceOverCache(),
       d_replaceOverTermIteCache(),
@@ -1086,13 +1089,9 @@ Node ITESimplifier::transformAtom(TNode atom)
   }
 }
 
-static unsigned numBranches = 0;
-static unsigned numFalseBranches = 0;
-static unsigned itesMade = 0;
-
 Node ITESimplifier::constantIteEqualsConstant(TNode cite, TNode constant)
 {
-  static int instance = 0;
+  static thread_local int instance = 0;
   ++instance;
   Debug("ite::constantIteEqualsConstant")
       << instance << "constantIteEqualsConstant(" << cite << ", " << constant
@@ -1139,13 +1138,13 @@ Node ITESimplifier::constantIteEqualsConstant(TNode cite, TNode constant)
       Node boolIte = cnd.iteNode(tEqs, fEqs);
       if (!(tEqs.isConst() || fEqs.isConst()))
       {
-        ++numBranches;
+        ++d_numBranches;
       }
       if (!(tEqs == d_false || fEqs == d_false))
       {
-        ++numFalseBranches;
+        ++d_numFalseBranches;
       }
-      ++itesMade;
+      ++d_itesMade;
       d_constantIteEqualsConstantCache[pair] = boolIte;
       // Debug("ite::constantIteEqualsConstant") << instance << "->" << boolIte
       // << endl;
@@ -1172,13 +1171,13 @@ Node ITESimplifier::intersectConstantIte(TNode lcite, TNode rcite)
     TNode cite = lIsConst ? rcite : lcite;
 
     (d_statistics.d_inSmaller) << 1;
-    unsigned preItesMade = itesMade;
-    unsigned preNumBranches = numBranches;
-    unsigned preNumFalseBranches = numFalseBranches;
+    unsigned preItesMade = d_itesMade;
+    unsigned preNumBranches = d_numBranches;
+    unsigned preNumFalseBranches = d_numFalseBranches;
     Node bterm = constantIteEqualsConstant(cite, constant);
-    Debug("intersectConstantIte") << (numBranches - preNumBranches) << " "
-                                  << (numFalseBranches - preNumFalseBranches)
-                                  << " " << (itesMade - preItesMade) << endl;
+    Debug("intersectConstantIte") << (d_numBranches - preNumBranches) << " "
+                                  << (d_numFalseBranches - preNumFalseBranches)
+                                  << " " << (d_itesMade - preItesMade) << endl;
     return bterm;
   }
   Assert(lcite.getKind() == kind::ITE);
@@ -1546,7 +1545,7 @@ Node ITESimplifier::simpITE(TNode assertion)
   vector<preprocess_stack_element> toVisit;
   toVisit.push_back(assertion);
 
-  static int call = 0;
+  static thread_local int call = 0;
   ++call;
   int iteration = 0;
 
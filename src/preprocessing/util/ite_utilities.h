@@ -265,6 +265,10 @@ class ITESimplifier
   // return a boolean expression equivalent to (= lcite c)
   Node constantIteEqualsConstant(TNode cite, TNode c);
   uint32_t d_citeEqConstApplications;
+  // Debugging counters of constantIteEqualsConstant
+  unsigned d_numBranches;
+  unsigned d_numFalseBranches;
+  unsigned d_itesMade;
 
   typedef std::pair<Node, Node> NodePair;
   using NodePairHashFunction =
@@ -106,8 +106,12 @@ class Printer
   /** Make a Printer for a given OutputLanguage */
   static std::unique_ptr<Printer> makePrinter(OutputLanguage lang);
 
-  /** Printers for each OutputLanguage */
-  static std::unique_ptr<Printer> d_printers[language::output::LANG_MAX];
+  /**
+   * Printers for each OutputLanguage. These are created lazily, so each thread
+   * has its own set.
+   */
+  static thread_local std::unique_ptr<Printer>
+      d_printers[language::output::LANG_MAX];
 
 }; /* class Printer */
 
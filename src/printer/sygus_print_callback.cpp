@@ -136,7 +136,8 @@ void SygusEmptyPrintCallback::toStreamSygus(const Printer* p,
   }
 }
 
-std::shared_ptr<SygusEmptyPrintCallback> SygusEmptyPrintCallback::d_empty_pc = nullptr;
+thread_local std::shared_ptr<SygusEmptyPrintCallback>
+    SygusEmptyPrintCallback::d_empty_pc = nullptr;
 
 } /* CVC4::printer namespace */
 } /* CVC4 namespace */
@@ -127,7 +127,7 @@ class CVC4_PUBLIC SygusEmptyPrintCallback : public SygusPrintCallback
 
  private:
   /* empty callback object */
-  static std::shared_ptr<SygusEmptyPrintCallback> d_empty_pc;
+  static thread_local std::shared_ptr<SygusEmptyPrintCallback> d_empty_pc;
 };
 
 } /* CVC4::printer namespace */
@@ -0,0 +1,554 @@
+/*********************                                                        */
+/*! \file cadical_dpll.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Wrapper for CaDiCaL as the SAT solver of the DPLL(T) search
+ **
+ ** Implementation of the DPLL(T) search with CaDiCaL and its external
+ ** propagator interface.
+ **/
+
+#include "prop/cadical_dpll.h"
+
+#ifdef CVC4_USE_CADICAL_DPLL
+
+#include <cstdlib>
+
+#include "base/check.h"
+#include "prop/theory_proxy.h"
+#include "util/resource_manager.h"
+
+namespace CVC4 {
+namespace prop {
+
+namespace {
+
+int toCadicalLit(SatLiteral lit)
+{
+  int var = lit.getSatVariable();
+  return lit.isNegated() ? -var : var;
+}
+
+SatLiteral toSatLiteral(int lit)
+{
+  return SatLiteral(std::abs(lit), lit < 0);
+}
+
+}  // namespace
+
+CadicalDPLLSatSolver::CadicalDPLLSatSolver(StatisticsRegistry* registry)
+    : d_solver(new CaDiCaL::Solver()),
+      d_proxy(nullptr),
+      d_context(nullptr),
+      d_true(0),
+      d_false(0),
+      d_reasonPos(0),
+      d_lemmaPos(0),
+      d_inSearch(false),
+      d_okay(true),
+      d_interrupted(false),
+      d_statistics(registry)
+{
+  d_solver->set("quiet", 1);  // CaDiCaL is verbose by default
+  // CaDiCaL variables start with index 1
+  d_vars.emplace_back(false);
+}
+
+CadicalDPLLSatSolver::~CadicalDPLLSatSolver()
+{
+  if (d_proxy != nullptr)
+  {
+    d_solver->disconnect_terminator();
+    d_solver->disconnect_external_propagator();
+  }
+}
+
+void CadicalDPLLSatSolver::initialize(context::Context* context,
+                                      TheoryProxy* theoryProxy)
+{
+  d_context = context;
+  d_proxy = theoryProxy;
+  d_solver->connect_external_propagator(this);
+  d_solver->connect_terminator(this);
+
+  d_true = mkVar(false);
+  d_false = mkVar(false);
+  d_solver->add(d_true);
+  d_solver->add(0);
+  d_solver->add(-static_cast<int>(d_false));
+  d_solver->add(0);
+}
+
+SatVariable CadicalDPLLSatSolver::mkVar(bool theoryAtom)
+{
+  SatVariable var = d_vars.size();
+  d_vars.emplace_back(theoryAtom);
+  // All the variables are observed: CaDiCaL notifies us of their assignments,
+  // and does not eliminate them
+  d_solver->add_observed_var(var);
+  ++d_statistics.d_numVariables;
+  return var;
+}
+
+SatVariable CadicalDPLLSatSolver::newVar(bool isTheoryAtom,
+                                         bool preRegister,
+                                         bool canErase)
+{
+  SatVariable var = mkVar(isTheoryAtom);
+  if (preRegister && getDecisionLevel() > 0)
+  {
+    d_toRegister.emplace_back(var, getDecisionLevel());
+  }
+  return var;
+}
+
+ClauseId CadicalDPLLSatSolver::addClause(SatClause& clause, bool removable)
+{
+  std::vector<int> lits;
+  lits.reserve(clause.size() + 1);
+  for (const SatLiteral& lit : clause)
+  {
+    lits.push_back(toCadicalLit(lit));
+  }
+  if (!removable && !d_activation.empty())
+  {
+    // The clause only holds while the current user level is active
+    lits.push_back(-static_cast<int>(d_activation.back()));
+  }
+  ++d_statistics.d_numClauses;
+
+  if (d_inSearch)
+  {
+    // CaDiCaL asks for the clauses added during the search through
+    // cb_add_external_clause_lit()
+    d_lemmas.push_back(std::move(lits));
+    ++d_statistics.d_numLemmas;
+  }
+  else
+  {
+    for (int lit : lits)
+    {
+      d_solver->add(lit);
+    }
+    d_solver->add(0);
+  }
+  return ClauseIdUndef;
+}
+
+SatValue CadicalDPLLSatSolver::solve()
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_solveTime);
+  ++d_statistics.d_numSatCalls;
+  d_model.clear();
+  for (SatVariable activation : d_activation)
+  {
+    d_solver->assume(activation);
+  }
+
+  d_inSearch = true;
+  int res = d_solver->solve();
+  d_inSearch = false;
+  d_interrupted = false;
+
+  // Add the lemmas CaDiCaL did not ask for before it stopped, they are
+  // needed by the next calls
+  for (const std::vector<int>& lemma : d_lemmas)
+  {
+    for (int lit : lemma)
+    {
+      d_solver->add(lit);
+    }
+    d_solver->add(0);
+  }
+  d_lemmas.clear();
+  d_lemmaPos = 0;
+  d_propagations.clear();
+  d_reasonPos = 0;
+
+  if (res == 10)
+  {
+    return SAT_VALUE_TRUE;
+  }
+  if (res == 20)
+  {
+    bool failed = false;
+    for (SatVariable activation : d_activation)
+    {
+      failed = failed || d_solver->failed(activation);
+    }
+    // Unsatisfiable at every user level
+    d_okay = d_okay && failed;
+    return SAT_VALUE_FALSE;
+  }
+  Assert(res == 0);
+  return SAT_VALUE_UNKNOWN;
+}
+
+SatValue CadicalDPLLSatSolver::solve(long unsigned int&)
+{
+  Unimplemented() << "Setting limits for CaDiCaL not supported yet";
+}
+
+void CadicalDPLLSatSolver::interrupt() { d_interrupted = true; }
+
+SatValue CadicalDPLLSatSolver::value(SatLiteral l)
+{
+  Assert(l.getSatVariable() < d_vars.size());
+  SatValue val = d_vars[l.getSatVariable()].d_value;
+  return l.isNegated() ? invertValue(val) : val;
+}
+
+SatValue CadicalDPLLSatSolver::modelValue(SatLiteral l)
+{
+  if (l.getSatVariable() >= d_model.size())
+  {
+    return SAT_VALUE_UNKNOWN;
+  }
+  SatValue val = d_model[l.getSatVariable()];
+  return l.isNegated() ? invertValue(val) : val;
+}
+
+bool CadicalDPLLSatSolver::properExplanation(SatLiteral lit,
+                                             SatLiteral expl) const
+{
+  const VarInfo& litInfo = d_vars[lit.getSatVariable()];
+  const VarInfo& explInfo = d_vars[expl.getSatVariable()];
+  return explInfo.d_value != SAT_VALUE_UNKNOWN
+         && (litInfo.d_value == SAT_VALUE_UNKNOWN
+             || explInfo.d_trailIndex < litInfo.d_trailIndex);
+}
+
+void CadicalDPLLSatSolver::push()
+{
+  Assert(!d_inSearch);
+  backtrack(0);
+  d_activation.push_back(mkVar(false));
+  d_context->push();
+}
+
+void CadicalDPLLSatSolver::pop()
+{
+  Assert(!d_inSearch);
+  Assert(!d_activation.empty());
+  backtrack(0);
+  d_context->pop();
+  // The clauses of the popped level are satisfied for good
+  d_solver->add(-static_cast<int>(d_activation.back()));
+  d_solver->add(0);
+  d_activation.pop_back();
+  d_toRegister.clear();
+  reassertFixed();
+}
+
+void CadicalDPLLSatSolver::resetTrail() { backtrack(0); }
+
+void CadicalDPLLSatSolver::requirePhase(SatLiteral lit)
+{
+  d_solver->phase(toCadicalLit(lit));
+}
+
+bool CadicalDPLLSatSolver::isDecision(SatVariable decn) const
+{
+  return d_solver->is_decision(decn);
+}
+
+void CadicalDPLLSatSolver::assign(SatLiteral lit)
+{
+  VarInfo& info = d_vars[lit.getSatVariable()];
+  Assert(info.d_value == SAT_VALUE_UNKNOWN);
+  info.d_value = lit.isNegated() ? SAT_VALUE_FALSE : SAT_VALUE_TRUE;
+  info.d_trailIndex = d_trail.size();
+  d_trail.push_back(lit);
+  if (info.d_theoryAtom)
+  {
+    d_proxy->enqueueTheoryLiteral(lit);
+  }
+}
+
+void CadicalDPLLSatSolver::backtrack(size_t level)
+{
+  if (getDecisionLevel() <= level)
+  {
+    return;
+  }
+  // Unassign the literals above the level, but the fixed ones, which CaDiCaL
+  // does not notify us of again
+  size_t limit = d_trailLimits[level];
+  std::vector<SatLiteral> kept;
+  for (size_t i = limit; i < d_trail.size(); ++i)
+  {
+    VarInfo& info = d_vars[d_trail[i].getSatVariable()];
+    if (info.d_fixed)
+    {
+      kept.push_back(d_trail[i]);
+    }
+    else
+    {
+      info.d_value = SAT_VALUE_UNKNOWN;
+    }
+  }
+  d_trail.resize(limit);
+  for (const SatLiteral& lit : kept)
+  {
+    d_vars[lit.getSatVariable()].d_trailIndex = d_trail.size();
+    d_trail.push_back(lit);
+  }
+  while (getDecisionLevel() > level)
+  {
+    d_trailLimits.pop_back();
+    d_context->pop();
+  }
+  d_propagations.clear();
+  reassertFixed();
+
+  // Pre-register again the variables the theories forgot
+  for (auto it = d_toRegister.rbegin();
+       it != d_toRegister.rend() && it->second > level;
+       ++it)
+  {
+    it->second = level;
+    d_proxy->variableNotify(it->first);
+  }
+}
+
+void CadicalDPLLSatSolver::reassertFixed()
+{
+  int level = d_context->getLevel();
+  for (std::pair<SatLiteral, int>& fixed : d_fixed)
+  {
+    if (fixed.second > level)
+    {
+      fixed.second = level;
+      d_proxy->enqueueTheoryLiteral(fixed.first);
+    }
+  }
+}
+
+void CadicalDPLLSatSolver::theoryPropagate()
+{
+  SatClause propagated;
+  d_proxy->theoryPropagate(propagated);
+  d_propagations.insert(
+      d_propagations.end(), propagated.begin(), propagated.end());
+}
+
+bool CadicalDPLLSatSolver::theoryCheckFull()
+{
+  for (;;)
+  {
+    d_proxy->theoryCheck(theory::Theory::EFFORT_FULL);
+    theoryPropagate();
+    // The assignment is complete, CaDiCaL does not take propagations at this
+    // point: those of unassigned or false literals are added as lemmas
+    for (const SatLiteral& lit : d_propagations)
+    {
+      if (value(lit) != SAT_VALUE_TRUE)
+      {
+        SatClause reason;
+        d_proxy->explainPropagation(lit, reason);
+        addClause(reason, true);
+      }
+    }
+    d_propagations.clear();
+    if (!d_lemmas.empty())
+    {
+      return false;
+    }
+    if (!d_proxy->theoryNeedCheck())
+    {
+      return true;
+    }
+  }
+}
+
+void CadicalDPLLSatSolver::notify_assignment(int lit, bool is_fixed)
+{
+  SatLiteral l = toSatLiteral(lit);
+  VarInfo& info = d_vars[l.getSatVariable()];
+  if (info.d_value != SAT_VALUE_UNKNOWN)
+  {
+    // A literal assigned above the root level, which is now fixed
+    Assert(value(l) == SAT_VALUE_TRUE);
+    if (is_fixed && !info.d_fixed)
+    {
+      info.d_fixed = true;
+      if (info.d_theoryAtom)
+      {
+        d_fixed.emplace_back(l, d_context->getLevel());
+      }
+    }
+    return;
+  }
+  info.d_fixed = is_fixed;
+  assign(l);
+  if (is_fixed && info.d_theoryAtom)
+  {
+    d_fixed.emplace_back(l, d_context->getLevel());
+  }
+}
+
+void CadicalDPLLSatSolver::notify_new_decision_level()
+{
+  d_trailLimits.push_back(d_trail.size());
+  d_context->push();
+}
+
+void CadicalDPLLSatSolver::notify_backtrack(size_t new_level)
+{
+  backtrack(new_level);
+}
+
+bool CadicalDPLLSatSolver::cb_check_found_model(const std::vector<int>& model)
+{
+  ++d_statistics.d_numModelChecks;
+  if (!theoryCheckFull())
+  {
+    return false;
+  }
+  d_model.assign(d_vars.size(), SAT_VALUE_UNKNOWN);
+  for (int lit : model)
+  {
+    size_t var = std::abs(lit);
+    if (var < d_model.size())
+    {
+      d_model[var] = lit > 0 ? SAT_VALUE_TRUE : SAT_VALUE_FALSE;
+    }
+  }
+  return true;
+}
+
+int CadicalDPLLSatSolver::cb_decide()
+{
+  SatLiteral lit = d_proxy->getNextTheoryDecisionRequest();
+  while (lit != undefSatLiteral)
+  {
+    if (value(lit) == SAT_VALUE_UNKNOWN)
+    {
+      ++d_statistics.d_numDecisionRequests;
+      return toCadicalLit(lit);
+    }
+    lit = d_proxy->getNextTheoryDecisionRequest();
+  }
+  // CaDiCaL cannot stop the search before the assignment is complete: when
+  // the decision engine is done, CaDiCaL decides the remaining variables
+  bool stopSearch = false;
+  lit = d_proxy->getNextDecisionEngineRequest(stopSearch);
+  if (!stopSearch && lit != undefSatLiteral
+      && value(lit) == SAT_VALUE_UNKNOWN)
+  {
+    ++d_statistics.d_numDecisionRequests;
+    return toCadicalLit(lit);
+  }
+  return 0;
+}
+
+int CadicalDPLLSatSolver::cb_propagate()
+{
+  if (d_propagations.empty())
+  {
+    d_proxy->theoryCheck(theory::Theory::EFFORT_STANDARD);
+    theoryPropagate();
+  }
+  while (!d_propagations.empty())
+  {
+    SatLiteral lit = d_propagations.front();
+    d_propagations.pop_front();
+    // A propagation of a false literal is a conflict, CaDiCaL asks for its
+    // reason
+    if (value(lit) != SAT_VALUE_TRUE)
+    {
+      ++d_statistics.d_numPropagations;
+      return toCadicalLit(lit);
+    }
+  }
+  return 0;
+}
+
+int CadicalDPLLSatSolver::cb_add_reason_clause_lit(int propagated_lit)
+{
+  if (d_reasonPos == 0)
+  {
+    // The first literal of the explanation is the propagated literal
+    d_reason.clear();
+    d_proxy->explainPropagation(toSatLiteral(propagated_lit), d_reason);
+  }
+  if (d_reasonPos < d_reason.size())
+  {
+    return toCadicalLit(d_reason[d_reasonPos++]);
+  }
+  d_reasonPos = 0;
+  return 0;
+}
+
+bool CadicalDPLLSatSolver::cb_has_external_clause()
+{
+  if (d_lemmas.empty())
+  {
+    return false;
+  }
+  d_proxy->spendResource(ResourceManager::Resource::LemmaStep);
+  return true;
+}
+
+int CadicalDPLLSatSolver::cb_add_external_clause_lit()
+{
+  Assert(!d_lemmas.empty());
+  const std::vector<int>& lemma = d_lemmas.front();
+  if (d_lemmaPos < lemma.size())
+  {
+    return lemma[d_lemmaPos++];
+  }
+  d_lemmas.pop_front();
+  d_lemmaPos = 0;
+  return 0;
+}
+
+bool CadicalDPLLSatSolver::terminate()
+{
+  // Polled by CaDiCaL as it searches, which we account for as conflicts
+  d_proxy->spendResource(ResourceManager::Resource::SatConflictStep);
+  return d_interrupted;
+}
+
+CadicalDPLLSatSolver::Statistics::Statistics(StatisticsRegistry* registry)
+    : d_registry(registry),
+      d_numSatCalls("sat::cadical::calls_to_solve", 0),
+      d_numVariables("sat::cadical::variables", 0),
+      d_numClauses("sat::cadical::clauses", 0),
+      d_numLemmas("sat::cadical::lemmas", 0),
+      d_numPropagations("sat::cadical::theory_propagations", 0),
+      d_numDecisionRequests("sat::cadical::decision_requests", 0),
+      d_numModelChecks("sat::cadical::model_checks", 0),
+      d_solveTime("sat::cadical::solve_time")
+{
+  d_registry->registerStat(&d_numSatCalls);
+  d_registry->registerStat(&d_numVariables);
+  d_registry->registerStat(&d_numClauses);
+  d_registry->registerStat(&d_numLemmas);
+  d_registry->registerStat(&d_numPropagations);
+  d_registry->registerStat(&d_numDecisionRequests);
+  d_registry->registerStat(&d_numModelChecks);
+  d_registry->registerStat(&d_solveTime);
+}
+
+CadicalDPLLSatSolver::Statistics::~Statistics()
+{
+  d_registry->unregisterStat(&d_numSatCalls);
+  d_registry->unregisterStat(&d_numVariables);
+  d_registry->unregisterStat(&d_numClauses);
+  d_registry->unregisterStat(&d_numLemmas);
+  d_registry->unregisterStat(&d_numPropagations);
+  d_registry->unregisterStat(&d_numDecisionRequests);
+  d_registry->unregisterStat(&d_numModelChecks);
+  d_registry->unregisterStat(&d_solveTime);
+}
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif  // CVC4_USE_CADICAL_DPLL
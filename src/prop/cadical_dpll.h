@@ -0,0 +1,238 @@
+/*********************                                                        */
+/*! \file cadical_dpll.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Wrapper for CaDiCaL as the SAT solver of the DPLL(T) search
+ **
+ ** With --sat-solver=cadical, the PropEngine searches with CaDiCaL instead
+ ** of Minisat.  The theories are connected through the external propagator
+ ** interface of CaDiCaL (IPASIR-UP, CaDiCaL 1.9 or later): the solver is
+ ** notified of the assignments and of the decision levels, which it mirrors
+ ** in the SAT context, and asks for theory propagations, their reasons,
+ ** lemmas, decisions, and the approval of the models it finds.
+ **
+ ** CaDiCaL has no user levels: the clauses asserted at user level n > 0 get
+ ** the negation of an activation literal of level n, assumed while level n
+ ** is active, and asserted false when it is popped.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__PROP__CADICAL_DPLL_H
+#define CVC4__PROP__CADICAL_DPLL_H
+
+#ifdef CVC4_USE_CADICAL_DPLL
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "context/context.h"
+#include "prop/sat_solver.h"
+#include "util/statistics_registry.h"
+
+#include <cadical.hpp>
+
+namespace CVC4 {
+namespace prop {
+
+class CadicalDPLLSatSolver : public DPLLSatSolverInterface,
+                             private CaDiCaL::ExternalPropagator,
+                             private CaDiCaL::Terminator
+{
+ public:
+  CadicalDPLLSatSolver(StatisticsRegistry* registry);
+  ~CadicalDPLLSatSolver() override;
+
+  void initialize(context::Context* context, TheoryProxy* theoryProxy) override;
+
+  ClauseId addClause(SatClause& clause, bool removable) override;
+  ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override
+  {
+    Unreachable() << "CaDiCaL does not support native XOR reasoning";
+  }
+
+  SatVariable newVar(bool isTheoryAtom,
+                     bool preRegister,
+                     bool canErase) override;
+  SatVariable trueVar() override { return d_true; }
+  SatVariable falseVar() override { return d_false; }
+
+  SatValue solve() override;
+  SatValue solve(long unsigned int&) override;
+
+  bool ok() const override { return d_okay; }
+
+  void interrupt() override;
+
+  SatValue value(SatLiteral l) override;
+
+  SatValue modelValue(SatLiteral l) override;
+
+  bool properExplanation(SatLiteral lit, SatLiteral expl) const override;
+
+  unsigned getAssertionLevel() const override { return d_activation.size(); }
+
+  void push() override;
+
+  void pop() override;
+
+  void resetTrail() override;
+
+  void requirePhase(SatLiteral lit) override;
+
+  bool isDecision(SatVariable decn) const override;
+
+  /** CaDiCaL does not expose the scores of its decision heuristics */
+  double getActivity(SatVariable var) const override { return 0; }
+
+ private:
+  /** What we know of a variable */
+  struct VarInfo
+  {
+    VarInfo(bool theoryAtom)
+        : d_theoryAtom(theoryAtom),
+          d_value(SAT_VALUE_UNKNOWN),
+          d_trailIndex(0),
+          d_fixed(false)
+    {
+    }
+    /** Whether its literals are asserted to the theories */
+    bool d_theoryAtom;
+    /** Its value in the current assignment, and its index in d_trail */
+    SatValue d_value;
+    size_t d_trailIndex;
+    /** Whether it is assigned at the root level, for good */
+    bool d_fixed;
+  };
+
+  /* Callbacks of the external propagator */
+  void notify_assignment(int lit, bool is_fixed) override;
+  void notify_new_decision_level() override;
+  void notify_backtrack(size_t new_level) override;
+  bool cb_check_found_model(const std::vector<int>& model) override;
+  int cb_decide() override;
+  int cb_propagate() override;
+  int cb_add_reason_clause_lit(int propagated_lit) override;
+  bool cb_has_external_clause() override;
+  int cb_add_external_clause_lit() override;
+
+  /* Callback of the terminator */
+  bool terminate() override;
+
+  /** Create a variable in CaDiCaL */
+  SatVariable mkVar(bool theoryAtom);
+
+  /** Record the assignment of lit, and assert it to the theories */
+  void assign(SatLiteral lit);
+
+  /** Backtrack to the given decision level */
+  void backtrack(size_t level);
+
+  /** The number of decision levels in the current assignment */
+  size_t getDecisionLevel() const { return d_trailLimits.size(); }
+
+  /** Assert again to the theories the fixed literals they forgot */
+  void reassertFixed();
+
+  /** Pick up the literals propagated by the theories */
+  void theoryPropagate();
+
+  /**
+   * Run the full effort check of the theories on the current assignment,
+   * returns true if they accept it.
+   */
+  bool theoryCheckFull();
+
+  /** The solver */
+  std::unique_ptr<CaDiCaL::Solver> d_solver;
+
+  /** The theory proxy, and the SAT context mirroring the decision levels */
+  TheoryProxy* d_proxy;
+  context::Context* d_context;
+
+  /** The variables, indexed by CaDiCaL variable */
+  std::vector<VarInfo> d_vars;
+  SatVariable d_true;
+  SatVariable d_false;
+
+  /**
+   * The assigned literals, in the order of their notification, and the
+   * start of each decision level in it.
+   */
+  std::vector<SatLiteral> d_trail;
+  std::vector<size_t> d_trailLimits;
+
+  /**
+   * The theory literals fixed at the root level, with the SAT context level
+   * they were asserted to the theories at: the theories forget them on pops
+   * below it, CaDiCaL does not assign them again.
+   */
+  std::vector<std::pair<SatLiteral, int>> d_fixed;
+
+  /**
+   * The pre-registered variables introduced during the search, with their
+   * decision level: they are pre-registered again when the search
+   * backtracks below it, as the theories forget them.
+   */
+  std::vector<std::pair<SatVariable, size_t>> d_toRegister;
+
+  /** The theory propagations not given to CaDiCaL yet */
+  std::deque<SatLiteral> d_propagations;
+
+  /** The reason of the propagation being explained, and our position in it */
+  SatClause d_reason;
+  size_t d_reasonPos;
+
+  /**
+   * The clauses added during the search, not given to CaDiCaL yet, and our
+   * position in the first one.
+   */
+  std::deque<std::vector<int>> d_lemmas;
+  size_t d_lemmaPos;
+
+  /** The activation literal of each user level */
+  std::vector<SatVariable> d_activation;
+
+  /** The model of the last satisfiable solve */
+  std::vector<SatValue> d_model;
+
+  /** Are we in solve()? */
+  bool d_inSearch;
+
+  /** False once the clauses are unsatisfiable at user level 0 */
+  bool d_okay;
+
+  /** Set by interrupt(), from any thread */
+  std::atomic<bool> d_interrupted;
+
+  struct Statistics
+  {
+    StatisticsRegistry* d_registry;
+    IntStat d_numSatCalls;
+    IntStat d_numVariables;
+    IntStat d_numClauses;
+    IntStat d_numLemmas;
+    IntStat d_numPropagations;
+    IntStat d_numDecisionRequests;
+    IntStat d_numModelChecks;
+    TimerStat d_solveTime;
+    Statistics(StatisticsRegistry* registry);
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+}; /* class CadicalDPLLSatSolver */
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif  // CVC4_USE_CADICAL_DPLL
+#endif  // CVC4__PROP__CADICAL_DPLL_H
@@ -0,0 +1,117 @@
+/*********************                                                        */
+/*! \file clause_exchange.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Exchange of learned clauses between parallel SAT solvers
+ **
+ ** Exchange of learned clauses between parallel SAT solvers.
+ **/
+
+#include "prop/clause_exchange.h"
+
+#include "base/check.h"
+
+namespace CVC4 {
+namespace prop {
+
+ClauseExchange::Ring::Ring() : d_slots(new Slot[kCapacity]), d_head(0)
+{
+  for (size_t i = 0; i < kCapacity; ++i)
+  {
+    d_slots[i].d_seq.store(0, std::memory_order_relaxed);
+    d_slots[i].d_size.store(0, std::memory_order_relaxed);
+  }
+}
+
+ClauseExchange::ClauseExchange(size_t numInstances)
+    : d_cursors(numInstances, std::vector<uint64_t>(numInstances, 0)),
+      d_exported(0),
+      d_imported(0),
+      d_useful(0)
+{
+  for (size_t i = 0; i < numInstances; ++i)
+  {
+    d_rings.emplace_back(new Ring());
+  }
+}
+
+ClauseExchange::~ClauseExchange() {}
+
+uint32_t ClauseExchange::getAtomId(const std::string& key)
+{
+  std::lock_guard<std::mutex> lock(d_atomMutex);
+  return d_atomIds.emplace(key, d_atomIds.size()).first->second;
+}
+
+void ClauseExchange::publish(size_t instance, const Clause& clause)
+{
+  Assert(instance < d_rings.size());
+  Assert(clause.size() <= kMaxSize);
+  Ring& ring = *d_rings[instance];
+  uint64_t pos = ring.d_head.load(std::memory_order_relaxed);
+  Slot& slot = ring.d_slots[pos % kCapacity];
+  // Mark the slot as being written before the data changes
+  slot.d_seq.store(2 * pos + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.d_size.store(clause.size(), std::memory_order_relaxed);
+  for (size_t i = 0; i < clause.size(); ++i)
+  {
+    slot.d_lits[i].store(clause[i], std::memory_order_relaxed);
+  }
+  slot.d_seq.store(2 * pos + 2, std::memory_order_release);
+  ring.d_head.store(pos + 1, std::memory_order_release);
+  ++d_exported;
+}
+
+void ClauseExchange::collect(size_t instance, std::vector<Clause>& clauses)
+{
+  Assert(instance < d_rings.size());
+  for (size_t other = 0; other < d_rings.size(); ++other)
+  {
+    if (other == instance)
+    {
+      continue;
+    }
+    Ring& ring = *d_rings[other];
+    uint64_t& cursor = d_cursors[instance][other];
+    uint64_t head = ring.d_head.load(std::memory_order_acquire);
+    if (head - cursor > kCapacity)
+    {
+      // the oldest clauses are overwritten
+      cursor = head - kCapacity;
+    }
+    for (; cursor < head; ++cursor)
+    {
+      Slot& slot = ring.d_slots[cursor % kCapacity];
+      uint64_t seq = slot.d_seq.load(std::memory_order_acquire);
+      if (seq != 2 * cursor + 2)
+      {
+        continue;
+      }
+      Clause clause(slot.d_size.load(std::memory_order_relaxed));
+      if (clause.size() > kMaxSize)
+      {
+        continue;
+      }
+      for (size_t i = 0; i < clause.size(); ++i)
+      {
+        clause[i] = slot.d_lits[i].load(std::memory_order_relaxed);
+      }
+      // Keep the clause only if the producer did not overwrite the slot
+      // while it was read
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.d_seq.load(std::memory_order_relaxed) == seq)
+      {
+        clauses.push_back(clause);
+      }
+    }
+  }
+}
+
+}  // namespace prop
+}  // namespace CVC4
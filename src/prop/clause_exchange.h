@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file clause_exchange.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Exchange of learned clauses between parallel SAT solvers
+ **
+ ** The SAT solvers of several instances of the same problem, each on its own
+ ** thread and in its own expression manager, share their short learned
+ ** clauses through a ClauseExchange.  The atoms of the clauses are given
+ ** ids common to the instances (see getAtomId()), and each instance
+ ** publishes its clauses into its own ring buffer, which the other instances
+ ** read without locking: a slot that is overwritten while it is read is
+ ** skipped, and a reader that falls behind by more than the capacity of a
+ ** ring loses the oldest clauses.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__PROP__CLAUSE_EXCHANGE_H
+#define CVC4__PROP__CLAUSE_EXCHANGE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CVC4 {
+namespace prop {
+
+class ClauseExchange
+{
+ public:
+  /**
+   * A clause over the shared atoms, the literal of atom a being 2 * a, and
+   * its negation 2 * a + 1.
+   */
+  typedef std::vector<uint32_t> Clause;
+
+  /** The size of the largest clause that can be exchanged */
+  static const size_t kMaxSize = 32;
+
+  /** An exchange between the instances 0 to numInstances - 1 */
+  ClauseExchange(size_t numInstances);
+  ~ClauseExchange();
+
+  /** The number of instances */
+  size_t getNumInstances() const { return d_rings.size(); }
+
+  /**
+   * The id of the atom with the given key, a description of the atom that
+   * is the same in every instance.  Thread-safe.
+   */
+  uint32_t getAtomId(const std::string& key);
+
+  /**
+   * Publish a clause of at most kMaxSize literals learned by the given
+   * instance.  Only that instance may publish to its ring.
+   */
+  void publish(size_t instance, const Clause& clause);
+
+  /**
+   * Add to clauses the clauses published by the other instances since the
+   * last call of collect() by the given instance.
+   */
+  void collect(size_t instance, std::vector<Clause>& clauses);
+
+  /** Count a clause imported, or useful to its importer.  Thread-safe. */
+  void notifyImported() { ++d_imported; }
+  void notifyUseful() { ++d_useful; }
+
+  /** The number of clauses published, imported and useful */
+  uint64_t getExported() const { return d_exported; }
+  uint64_t getImported() const { return d_imported; }
+  uint64_t getUseful() const { return d_useful; }
+
+ private:
+  /**
+   * A slot of a ring: the sequence number of the slot is odd while the
+   * producer writes it, and 2 * (p + 1) once it holds the p-th clause
+   * published to the ring.
+   */
+  struct Slot
+  {
+    std::atomic<uint64_t> d_seq;
+    std::atomic<uint32_t> d_size;
+    std::atomic<uint32_t> d_lits[kMaxSize];
+  };
+
+  /** The ring of clauses published by one instance */
+  struct Ring
+  {
+    Ring();
+    std::unique_ptr<Slot[]> d_slots;
+    /** The number of clauses published to the ring */
+    std::atomic<uint64_t> d_head;
+  };
+
+  /** The number of slots of a ring */
+  static const size_t kCapacity = 4096;
+
+  /** The ring of each instance */
+  std::vector<std::unique_ptr<Ring>> d_rings;
+
+  /**
+   * The read position of each instance in each ring, only accessed by the
+   * reading instance.
+   */
+  std::vector<std::vector<uint64_t>> d_cursors;
+
+  /** The ids of the atoms, guarded by d_atomMutex */
+  std::mutex d_atomMutex;
+  std::unordered_map<std::string, uint32_t> d_atomIds;
+
+  std::atomic<uint64_t> d_exported;
+  std::atomic<uint64_t> d_imported;
+  std::atomic<uint64_t> d_useful;
+}; /* class ClauseExchange */
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif /* CVC4__PROP__CLAUSE_EXCHANGE_H */
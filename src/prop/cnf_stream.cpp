@@ -17,6 +17,7 @@
  **/
 #include "prop/cnf_stream.h"
 
+#include <algorithm>
 #include <queue>
 
 #include "base/check.h"
@@ -35,6 +36,7 @@
 #include "smt/smt_engine_scope.h"
 #include "theory/theory.h"
 #include "theory/theory_engine.h"
+#include "util/hash.h"
 
 using namespace std;
 using namespace CVC4::kind;
@@ -42,9 +44,12 @@ using namespace CVC4::kind;
 namespace CVC4 {
 namespace prop {
 
-CnfStream::CnfStream(SatSolver* satSolver, Registrar* registrar,
-                     context::Context* context, bool fullLitToNodeMap,
-                     std::string name)
+CnfStream::CnfStream(SatSolver* satSolver,
+                     Registrar* registrar,
+                     context::Context* context,
+                     bool fullLitToNodeMap,
+                     std::string name,
+                     StatisticsRegistry* registry)
     : d_satSolver(satSolver),
       d_booleanVariables(context),
       d_nodeToLiteralMap(context),
@@ -54,15 +59,64 @@ CnfStream::CnfStream(SatSolver* satSolver, Registrar* registrar,
       d_registrar(registrar),
       d_name(name),
       d_cnfProof(NULL),
+      d_statistics(registry, name.empty() ? "cnf::" : "cnf::" + name + "::"),
       d_removable(false) {
 }
 
-TseitinCnfStream::TseitinCnfStream(SatSolver* satSolver, Registrar* registrar,
+CnfStream::Statistics::Statistics(StatisticsRegistry* registry,
+                                  const std::string& prefix)
+    : d_registry(registry),
+      d_numClauses(prefix + "clauses", 0),
+      d_numLiterals(prefix + "literals", 0),
+      d_numVariables(prefix + "variables", 0),
+      d_numSharedGates(prefix + "sharedGates", 0)
+{
+  if (d_registry != nullptr)
+  {
+    d_registry->registerStat(&d_numClauses);
+    d_registry->registerStat(&d_numLiterals);
+    d_registry->registerStat(&d_numVariables);
+    d_registry->registerStat(&d_numSharedGates);
+  }
+}
+
+CnfStream::Statistics::~Statistics()
+{
+  if (d_registry != nullptr)
+  {
+    d_registry->unregisterStat(&d_numClauses);
+    d_registry->unregisterStat(&d_numLiterals);
+    d_registry->unregisterStat(&d_numVariables);
+    d_registry->unregisterStat(&d_numSharedGates);
+  }
+}
+
+TseitinCnfStream::TseitinCnfStream(SatSolver* satSolver,
+                                   Registrar* registrar,
                                    context::Context* context,
-                                   bool fullLitToNodeMap, std::string name)
-  : CnfStream(satSolver, registrar, context, fullLitToNodeMap, name)
+                                   bool fullLitToNodeMap,
+                                   std::string name,
+                                   StatisticsRegistry* registry,
+                                   bool polarityEncoding,
+                                   bool gateHashing)
+    : CnfStream(
+          satSolver, registrar, context, fullLitToNodeMap, name, registry),
+      d_polarityEncoding(polarityEncoding),
+      d_gateHashing(gateHashing),
+      d_gatePolarity(context),
+      d_gates(context)
 {}
 
+size_t TseitinCnfStream::GateHashFunction::operator()(const Gate& gate) const
+{
+  uint64_t hash = fnv1a::fnv1a_64(static_cast<uint64_t>(gate.first));
+  for (const SatLiteral& lit : gate.second)
+  {
+    hash = fnv1a::fnv1a_64(lit.toInt(), hash);
+  }
+  return static_cast<size_t>(hash);
+}
+
 void CnfStream::assertClause(TNode node, SatClause& c) {
   Debug("cnf") << "Inserting into stream " << c << " node = " << node << endl;
   if(Dump.isOn("clauses")) {
@@ -84,6 +138,9 @@ void CnfStream::assertClause(TNode node, SatClause& c) {
     d_cnfProof->pushCurrentDefinition(node);
   }
 
+  ++d_statistics.d_numClauses;
+  d_statistics.d_numLiterals += c.size();
+
   ClauseId clause_id = d_satSolver->addClause(c, d_removable);
   if (clause_id == ClauseIdUndef) return; // nothing to store (no clause was added)
 
@@ -129,6 +186,11 @@ void TseitinCnfStream::ensureLiteral(TNode n, bool noPreregistration) {
 
   Debug("cnf") << "ensureLiteral(" << n << ")" << endl;
   if(hasLiteral(n)) {
+    if (d_polarityEncoding)
+    {
+      // Add the clauses of the polarities n did not occur in yet
+      toCNF(n);
+    }
     SatLiteral lit = getLiteral(n);
     if(!d_literalToNodeMap.contains(lit)){
       // Store backward-mappings
@@ -182,7 +244,8 @@ void TseitinCnfStream::ensureLiteral(TNode n, bool noPreregistration) {
     lit = convertAtom(n, noPreregistration);
   }
 
-  Assert(hasLiteral(n) && getNode(lit) == n);
+  // With gate hashing, the literal may be shared with another node
+  Assert(hasLiteral(n) && (d_gateHashing || getNode(lit) == n));
   Debug("ensureLiteral") << "CnfStream::ensureLiteral(): out lit is " << lit << std::endl;
 }
 
@@ -202,6 +265,7 @@ SatLiteral CnfStream::newLiteral(TNode node, bool isTheoryAtom, bool preRegister
       }
     } else {
       lit = SatLiteral(d_satSolver->newVar(isTheoryAtom, preRegister, canEliminate));
+      ++d_statistics.d_numVariables;
     }
     d_nodeToLiteralMap.insert(node, lit);
     d_nodeToLiteralMap.insert(node.notNode(), ~lit);
@@ -283,8 +347,141 @@ SatLiteral CnfStream::getLiteral(TNode node) {
   return literal;
 }
 
-SatLiteral TseitinCnfStream::handleXor(TNode xorNode) {
-  Assert(!hasLiteral(xorNode)) << "Atom already mapped!";
+void TseitinCnfStream::getGateInputs(TNode node,
+                                     bool negated,
+                                     unsigned polarity,
+                                     SatClause& inputs)
+{
+  Assert(node.getKind() == AND || node.getKind() == OR);
+  for (TNode child : node)
+  {
+    bool childNegated = negated;
+    if (d_gateHashing)
+    {
+      while (child.getKind() == NOT)
+      {
+        child = child[0];
+        childNegated = !childNegated;
+      }
+      // (and a (and b c)) is (and a b c), (and a (not (or b c))) is
+      // (and a (not b) (not c)), and dually for OR
+      Kind k = child.getKind();
+      if ((k == AND || k == OR) && !hasLiteral(child)
+          && (k == node.getKind()) == (childNegated == negated))
+      {
+        getGateInputs(child, childNegated, polarity, inputs);
+        continue;
+      }
+    }
+    inputs.push_back(toCNF(
+        child, childNegated, childNegated ? flipPolarity(polarity) : polarity));
+  }
+}
+
+unsigned TseitinCnfStream::getGateLiteral(TNode node,
+                                          Kind kind,
+                                          SatClause& inputs,
+                                          unsigned polarity,
+                                          SatLiteral& lit)
+{
+  if (d_gateHashing)
+  {
+    if (kind == AND || kind == OR)
+    {
+      std::sort(inputs.begin(), inputs.end());
+      inputs.erase(std::unique(inputs.begin(), inputs.end()), inputs.end());
+      // A default SatLiteral is not null, track the constant explicitly
+      bool haveConstant = false;
+      SatLiteral constant;
+      for (unsigned i = 1; i < inputs.size() && !haveConstant; ++i)
+      {
+        // x | ~x is true, x & ~x is false
+        if (inputs[i] == ~inputs[i - 1])
+        {
+          constant = SatLiteral(kind == OR ? d_satSolver->trueVar()
+                                           : d_satSolver->falseVar());
+          haveConstant = true;
+        }
+      }
+      if (!haveConstant && inputs.size() == 1)
+      {
+        constant = inputs[0];
+        haveConstant = true;
+      }
+      if (haveConstant && !hasLiteral(node))
+      {
+        lit = constant;
+        d_nodeToLiteralMap.insert(node, lit);
+        d_nodeToLiteralMap.insert(node.notNode(), ~lit);
+        d_literalToNodeMap.insert_safe(lit, node);
+        d_literalToNodeMap.insert_safe(~lit, node.notNode());
+        return 0;
+      }
+    }
+    else if (kind == XOR || kind == EQUAL)
+    {
+      std::sort(inputs.begin(), inputs.end());
+    }
+    if (!hasLiteral(node))
+    {
+      Gate gate(kind, inputs);
+      context::CDInsertHashMap<Gate, SatLiteral, GateHashFunction>::
+          const_iterator it = d_gates.find(gate);
+      if (it != d_gates.end())
+      {
+        lit = (*it).second;
+        d_nodeToLiteralMap.insert(node, lit);
+        d_nodeToLiteralMap.insert(node.notNode(), ~lit);
+        d_literalToNodeMap.insert_safe(lit, node);
+        d_literalToNodeMap.insert_safe(~lit, node.notNode());
+        ++d_statistics.d_numSharedGates;
+        return d_polarityEncoding ? polarity & ~getPolarity(lit) : 0;
+      }
+      // The gates get new clauses when they occur in a new polarity, or
+      // are shared, so they are not eliminated
+      lit = newLiteral(node, false, false, !d_polarityEncoding);
+      d_gates.insert(gate, lit);
+      return polarity;
+    }
+  }
+  if (!hasLiteral(node))
+  {
+    lit = newLiteral(node, false, false, !d_polarityEncoding);
+    return polarity;
+  }
+  lit = getLiteral(node);
+  if (inputs.size() == 1 && inputs[0] == lit)
+  {
+    return 0;
+  }
+  return polarity;
+}
+
+unsigned TseitinCnfStream::getPolarity(SatLiteral lit) const
+{
+  context::CDHashMap<SatVariable, unsigned>::const_iterator it =
+      d_gatePolarity.find(lit.getSatVariable());
+  if (it == d_gatePolarity.end())
+  {
+    return 0;
+  }
+  return lit.isNegated() ? flipPolarity((*it).second) : (*it).second;
+}
+
+void TseitinCnfStream::addPolarity(SatLiteral lit, unsigned polarity)
+{
+  if (lit.isNegated())
+  {
+    polarity = flipPolarity(polarity);
+  }
+  unsigned current = getPolarity(SatLiteral(lit.getSatVariable()));
+  if ((current | polarity) != current)
+  {
+    d_gatePolarity.insert(lit.getSatVariable(), current | polarity);
+  }
+}
+
+SatLiteral TseitinCnfStream::handleXor(TNode xorNode, unsigned polarity) {
   Assert(xorNode.getKind() == XOR) << "Expecting an XOR expression!";
   Assert(xorNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -292,119 +489,148 @@ SatLiteral TseitinCnfStream::handleXor(TNode xorNode) {
   SatLiteral a = toCNF(xorNode[0]);
   SatLiteral b = toCNF(xorNode[1]);
 
-  SatLiteral xorLit = newLiteral(xorNode);
+  SatClause inputs{a, b};
+  SatLiteral xorLit;
+  polarity = getGateLiteral(xorNode, XOR, inputs, polarity, xorLit);
 
-  assertClause(xorNode.negate(), a, b, ~xorLit);
-  assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
-  assertClause(xorNode, a, ~b, xorLit);
-  assertClause(xorNode, ~a, b, xorLit);
+  if (polarity & POLARITY_POS)
+  {
+    assertClause(xorNode.negate(), a, b, ~xorLit);
+    assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
+  }
+  if (polarity & POLARITY_NEG)
+  {
+    assertClause(xorNode, a, ~b, xorLit);
+    assertClause(xorNode, ~a, b, xorLit);
+  }
 
   return xorLit;
 }
 
-SatLiteral TseitinCnfStream::handleOr(TNode orNode) {
-  Assert(!hasLiteral(orNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleOr(TNode orNode, unsigned polarity) {
   Assert(orNode.getKind() == OR) << "Expecting an OR expression!";
   Assert(orNode.getNumChildren() > 1) << "Expecting more then 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
 
-  // Number of children
-  unsigned n_children = orNode.getNumChildren();
-
   // Transform all the children first
-  TNode::const_iterator node_it = orNode.begin();
-  TNode::const_iterator node_it_end = orNode.end();
-  SatClause clause(n_children + 1);
-  for(int i = 0; node_it != node_it_end; ++node_it, ++i) {
-    clause[i] = toCNF(*node_it);
-  }
+  SatClause clause;
+  getGateInputs(orNode, false, polarity, clause);
 
   // Get the literal for this node
-  SatLiteral orLit = newLiteral(orNode);
+  SatLiteral orLit;
+  polarity = getGateLiteral(orNode, OR, clause, polarity, orLit);
+
+  // Number of children
+  unsigned n_children = clause.size();
 
   // lit <- (a_1 | a_2 | a_3 | ... | a_n)
   // lit | ~(a_1 | a_2 | a_3 | ... | a_n)
   // (lit | ~a_1) & (lit | ~a_2) & (lit & ~a_3) & ... & (lit & ~a_n)
-  for(unsigned i = 0; i < n_children; ++i) {
-    assertClause(orNode, orLit, ~clause[i]);
+  if (polarity & POLARITY_NEG)
+  {
+    for (unsigned i = 0; i < n_children; ++i)
+    {
+      assertClause(orNode, orLit, ~clause[i]);
+    }
   }
 
   // lit -> (a_1 | a_2 | a_3 | ... | a_n)
   // ~lit | a_1 | a_2 | a_3 | ... | a_n
-  clause[n_children] = ~orLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(orNode.negate(), clause);
+  if (polarity & POLARITY_POS)
+  {
+    clause.push_back(~orLit);
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(orNode.negate(), clause);
+  }
 
   // Return the literal
   return orLit;
 }
 
-SatLiteral TseitinCnfStream::handleAnd(TNode andNode) {
-  Assert(!hasLiteral(andNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleAnd(TNode andNode, unsigned polarity) {
   Assert(andNode.getKind() == AND) << "Expecting an AND expression!";
   Assert(andNode.getNumChildren() > 1) << "Expecting more than 1 child!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
 
-  // Number of children
-  unsigned n_children = andNode.getNumChildren();
-
-  // Transform all the children first (remembering the negation)
-  TNode::const_iterator node_it = andNode.begin();
-  TNode::const_iterator node_it_end = andNode.end();
-  SatClause clause(n_children + 1);
-  for(int i = 0; node_it != node_it_end; ++node_it, ++i) {
-    clause[i] = ~toCNF(*node_it);
-  }
+  // Transform all the children first
+  SatClause clause;
+  getGateInputs(andNode, false, polarity, clause);
 
   // Get the literal for this node
-  SatLiteral andLit = newLiteral(andNode);
+  SatLiteral andLit;
+  polarity = getGateLiteral(andNode, AND, clause, polarity, andLit);
+
+  // Number of children
+  unsigned n_children = clause.size();
 
   // lit -> (a_1 & a_2 & a_3 & ... & a_n)
   // ~lit | (a_1 & a_2 & a_3 & ... & a_n)
   // (~lit | a_1) & (~lit | a_2) & ... & (~lit | a_n)
-  for(unsigned i = 0; i < n_children; ++i) {
-    assertClause(andNode.negate(), ~andLit, ~clause[i]);
+  if (polarity & POLARITY_POS)
+  {
+    for (unsigned i = 0; i < n_children; ++i)
+    {
+      assertClause(andNode.negate(), ~andLit, clause[i]);
+    }
   }
 
   // lit <- (a_1 & a_2 & a_3 & ... a_n)
   // lit | ~(a_1 & a_2 & a_3 & ... & a_n)
   // lit | ~a_1 | ~a_2 | ~a_3 | ... | ~a_n
-  clause[n_children] = andLit;
-  // This needs to go last, as the clause might get modified by the SAT solver
-  assertClause(andNode, clause);
+  if (polarity & POLARITY_NEG)
+  {
+    for (unsigned i = 0; i < n_children; ++i)
+    {
+      clause[i] = ~clause[i];
+    }
+    clause.push_back(andLit);
+    // This needs to go last, as the clause might get modified by the SAT
+    // solver
+    assertClause(andNode, clause);
+  }
 
   return andLit;
 }
 
-SatLiteral TseitinCnfStream::handleImplies(TNode impliesNode) {
-  Assert(!hasLiteral(impliesNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleImplies(TNode impliesNode,
+                                           unsigned polarity)
+{
   Assert(impliesNode.getKind() == IMPLIES)
       << "Expecting an IMPLIES expression!";
   Assert(impliesNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
 
   // Convert the children to cnf
-  SatLiteral a = toCNF(impliesNode[0]);
-  SatLiteral b = toCNF(impliesNode[1]);
+  SatLiteral a = toCNF(impliesNode[0], false, flipPolarity(polarity));
+  SatLiteral b = toCNF(impliesNode[1], false, polarity);
 
-  SatLiteral impliesLit = newLiteral(impliesNode);
+  // a -> b is the gate ~a | b
+  SatClause inputs{~a, b};
+  SatLiteral impliesLit;
+  polarity = getGateLiteral(impliesNode, OR, inputs, polarity, impliesLit);
 
   // lit -> (a->b)
   // ~lit | ~ a | b
-  assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  if (polarity & POLARITY_POS)
+  {
+    assertClause(impliesNode.negate(), ~impliesLit, ~a, b);
+  }
 
   // (a->b) -> lit
   // ~(~a | b) | lit
   // (a | l) & (~b | l)
-  assertClause(impliesNode, a, impliesLit);
-  assertClause(impliesNode, ~b, impliesLit);
+  if (polarity & POLARITY_NEG)
+  {
+    assertClause(impliesNode, a, impliesLit);
+    assertClause(impliesNode, ~b, impliesLit);
+  }
 
   return impliesLit;
 }
 
 
-SatLiteral TseitinCnfStream::handleIff(TNode iffNode) {
-  Assert(!hasLiteral(iffNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleIff(TNode iffNode, unsigned polarity) {
   Assert(iffNode.getKind() == EQUAL) << "Expecting an EQUAL expression!";
   Assert(iffNode.getNumChildren() == 2) << "Expecting exactly 2 children!";
 
@@ -415,37 +641,44 @@ SatLiteral TseitinCnfStream::handleIff(TNode iffNode) {
   SatLiteral b = toCNF(iffNode[1]);
 
   // Get the now literal
-  SatLiteral iffLit = newLiteral(iffNode);
+  SatClause inputs{a, b};
+  SatLiteral iffLit;
+  polarity = getGateLiteral(iffNode, EQUAL, inputs, polarity, iffLit);
 
   // lit -> ((a-> b) & (b->a))
   // ~lit | ((~a | b) & (~b | a))
   // (~a | b | ~lit) & (~b | a | ~lit)
-  assertClause(iffNode.negate(), ~a, b, ~iffLit);
-  assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  if (polarity & POLARITY_POS)
+  {
+    assertClause(iffNode.negate(), ~a, b, ~iffLit);
+    assertClause(iffNode.negate(), a, ~b, ~iffLit);
+  }
 
   // (a<->b) -> lit
   // ~((a & b) | (~a & ~b)) | lit
   // (~(a & b)) & (~(~a & ~b)) | lit
   // ((~a | ~b) & (a | b)) | lit
   // (~a | ~b | lit) & (a | b | lit)
-  assertClause(iffNode, ~a, ~b, iffLit);
-  assertClause(iffNode, a, b, iffLit);
+  if (polarity & POLARITY_NEG)
+  {
+    assertClause(iffNode, ~a, ~b, iffLit);
+    assertClause(iffNode, a, b, iffLit);
+  }
 
   return iffLit;
 }
 
 
-SatLiteral TseitinCnfStream::handleNot(TNode notNode) {
-  Assert(!hasLiteral(notNode)) << "Atom already mapped!";
+SatLiteral TseitinCnfStream::handleNot(TNode notNode, unsigned polarity) {
   Assert(notNode.getKind() == NOT) << "Expecting a NOT expression!";
   Assert(notNode.getNumChildren() == 1) << "Expecting exactly 1 child!";
 
-  SatLiteral notLit = ~toCNF(notNode[0]);
+  SatLiteral notLit = ~toCNF(notNode[0], false, flipPolarity(polarity));
 
   return notLit;
 }
 
-SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
+SatLiteral TseitinCnfStream::handleIte(TNode iteNode, unsigned polarity) {
   Assert(iteNode.getKind() == ITE);
   Assert(iteNode.getNumChildren() == 3);
   Assert(!d_removable) << "Removable clauses can not contain Boolean structure";
@@ -453,10 +686,12 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   Debug("cnf") << "handleIte(" << iteNode[0] << " " << iteNode[1] << " " << iteNode[2] << ")" << endl;
 
   SatLiteral condLit = toCNF(iteNode[0]);
-  SatLiteral thenLit = toCNF(iteNode[1]);
-  SatLiteral elseLit = toCNF(iteNode[2]);
+  SatLiteral thenLit = toCNF(iteNode[1], false, polarity);
+  SatLiteral elseLit = toCNF(iteNode[2], false, polarity);
 
-  SatLiteral iteLit = newLiteral(iteNode);
+  SatClause inputs{condLit, thenLit, elseLit};
+  SatLiteral iteLit;
+  polarity = getGateLiteral(iteNode, ITE, inputs, polarity, iteLit);
 
   // If ITE is true then one of the branches is true and the condition
   // implies which one
@@ -464,9 +699,12 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   // lit -> (t | e) & (b -> t) & (!b -> e)
   // lit -> (t | e) & (!b | t) & (b | e)
   // (!lit | t | e) & (!lit | !b | t) & (!lit | b | e)
-  assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
-  assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
-  assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  if (polarity & POLARITY_POS)
+  {
+    assertClause(iteNode.negate(), ~iteLit, thenLit, elseLit);
+    assertClause(iteNode.negate(), ~iteLit, ~condLit, thenLit);
+    assertClause(iteNode.negate(), ~iteLit, condLit, elseLit);
+  }
 
   // If ITE is false then one of the branches is false and the condition
   // implies which one
@@ -474,48 +712,84 @@ SatLiteral TseitinCnfStream::handleIte(TNode iteNode) {
   // !lit -> (!t | !e) & (b -> !t) & (!b -> !e)
   // !lit -> (!t | !e) & (!b | !t) & (b | !e)
   // (lit | !t | !e) & (lit | !b | !t) & (lit | b | !e)
-  assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
-  assertClause(iteNode, iteLit, ~condLit, ~thenLit);
-  assertClause(iteNode, iteLit, condLit, ~elseLit);
+  if (polarity & POLARITY_NEG)
+  {
+    assertClause(iteNode, iteLit, ~thenLit, ~elseLit);
+    assertClause(iteNode, iteLit, ~condLit, ~thenLit);
+    assertClause(iteNode, iteLit, condLit, ~elseLit);
+  }
 
   return iteLit;
 }
 
+namespace {
 
-SatLiteral TseitinCnfStream::toCNF(TNode node, bool negated) {
+/** Is node a Boolean connective, whose literal is defined by clauses? */
+bool isGate(TNode node)
+{
+  switch (node.getKind())
+  {
+    case NOT:
+    case XOR:
+    case ITE:
+    case IMPLIES:
+    case OR:
+    case AND: return true;
+    case EQUAL: return node[0].getType().isBoolean();
+    default: return false;
+  }
+}
+
+}  // namespace
+
+SatLiteral TseitinCnfStream::toCNF(TNode node,
+                                   bool negated,
+                                   unsigned polarity)
+{
   Debug("cnf") << "toCNF(" << node << ", negated = " << (negated ? "true" : "false") << ")" << endl;
 
   SatLiteral nodeLit;
-  Node negatedNode = node.notNode();
+
+  // The polarities of node whose clauses are to be asserted
+  if (!d_polarityEncoding)
+  {
+    polarity = POLARITY_BOTH;
+  }
 
   // If the non-negated node has already been translated, get the translation
   if(hasLiteral(node)) {
     Debug("cnf") << "toCNF(): already translated" << endl;
     nodeLit = getLiteral(node);
-  } else {
+    polarity = d_polarityEncoding && isGate(node)
+                   ? polarity & ~getPolarity(nodeLit)
+                   : 0;
+  }
+
+  if (polarity != 0)
+  {
     // Handle each Boolean operator case
     switch(node.getKind()) {
     case NOT:
-      nodeLit = handleNot(node);
+      nodeLit = handleNot(node, polarity);
       break;
     case XOR:
-      nodeLit = handleXor(node);
+      nodeLit = handleXor(node, polarity);
       break;
     case ITE:
-      nodeLit = handleIte(node);
+      nodeLit = handleIte(node, polarity);
       break;
     case IMPLIES:
-      nodeLit = handleImplies(node);
+      nodeLit = handleImplies(node, polarity);
       break;
     case OR:
-      nodeLit = handleOr(node);
+      nodeLit = handleOr(node, polarity);
       break;
     case AND:
-      nodeLit = handleAnd(node);
+      nodeLit = handleAnd(node, polarity);
       break;
     case EQUAL:
       if(node[0].getType().isBoolean()) {
-        nodeLit = handleIff(node);
+        nodeLit = handleIff(node, polarity);
       } else {
         nodeLit = convertAtom(node);
       }
@@ -530,6 +804,10 @@ SatLiteral TseitinCnfStream::toCNF(TNode node, bool negated) {
       }
       break;
     }
+    if (d_polarityEncoding)
+    {
+      addPolarity(nodeLit, polarity);
+    }
   }
 
   // Return the appropriate (negated) literal
@@ -553,7 +831,7 @@ void TseitinCnfStream::convertAndAssertAnd(TNode node, bool negated) {
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, true);
+      clause[i] = toCNF(*disjunct, true, POLARITY_NEG);
     }
     Assert(disjunct == node.end());
     assertClause(node.negate(), clause);
@@ -569,7 +847,7 @@ void TseitinCnfStream::convertAndAssertOr(TNode node, bool negated) {
     TNode::const_iterator disjunct = node.begin();
     for(int i = 0; i < nChildren; ++ disjunct, ++ i) {
       Assert(disjunct != node.end());
-      clause[i] = toCNF(*disjunct, false);
+      clause[i] = toCNF(*disjunct, false, POLARITY_POS);
     }
     Assert(disjunct == node.end());
     assertClause(node, clause);
@@ -646,8 +924,8 @@ void TseitinCnfStream::convertAndAssertIff(TNode node, bool negated) {
 void TseitinCnfStream::convertAndAssertImplies(TNode node, bool negated) {
   if (!negated) {
     // p => q
-    SatLiteral p = toCNF(node[0], false);
-    SatLiteral q = toCNF(node[1], false);
+    SatLiteral p = toCNF(node[0], false, POLARITY_NEG);
+    SatLiteral q = toCNF(node[1], false, POLARITY_POS);
     // Construct the clause ~p || q
     SatClause clause(2);
     clause[0] = ~p;
@@ -665,8 +943,9 @@ void TseitinCnfStream::convertAndAssertImplies(TNode node, bool negated) {
 void TseitinCnfStream::convertAndAssertIte(TNode node, bool negated) {
   // ITE(p, q, r)
   SatLiteral p = toCNF(node[0], false);
-  SatLiteral q = toCNF(node[1], negated);
-  SatLiteral r = toCNF(node[2], negated);
+  unsigned polarity = negated ? POLARITY_NEG : POLARITY_POS;
+  SatLiteral q = toCNF(node[1], negated, polarity);
+  SatLiteral r = toCNF(node[2], negated, polarity);
   // Construct the clauses:
   // (p => q) and (!p => r)
   Node nnode = node;
@@ -760,7 +1039,8 @@ void TseitinCnfStream::convertAndAssert(TNode node, bool negated) {
       nnode = node.negate();
     }
     // Atoms
-    assertClause(nnode, toCNF(node, negated));
+    assertClause(nnode,
+                 toCNF(node, negated, negated ? POLARITY_NEG : POLARITY_POS));
   }
     break;
   }
@@ -25,12 +25,17 @@
 #ifndef CVC4__PROP__CNF_STREAM_H
 #define CVC4__PROP__CNF_STREAM_H
 
+#include <string>
+#include <utility>
+
+#include "context/cdhashmap.h"
 #include "context/cdinsert_hashmap.h"
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/proof_manager.h"
 #include "prop/registrar.h"
 #include "prop/theory_proxy.h"
+#include "util/statistics_registry.h"
 
 namespace CVC4 {
 
@@ -87,6 +92,20 @@ class CnfStream {
   /** Pointer to the proof corresponding to this CnfStream */
   CnfProof* d_cnfProof;
 
+  struct Statistics
+  {
+    /** The registry of the statistics, if any */
+    StatisticsRegistry* d_registry;
+    IntStat d_numClauses;
+    IntStat d_numLiterals;
+    IntStat d_numVariables;
+    IntStat d_numSharedGates;
+    Statistics(StatisticsRegistry* registry, const std::string& prefix);
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+
   /** Remove nots from the node */
   TNode stripNot(TNode node) {
     while (node.getKind() == kind::NOT) {
@@ -169,10 +188,14 @@ class CnfStream {
    * @param fullLitToNodeMap maintain a full SAT-literal-to-Node mapping.
    * @param name string identifier to distinguish between different instances
    * even for non-theory literals.
+   * @param registry the registry of the statistics of the conversion, if any
    */
-  CnfStream(SatSolver* satSolver, Registrar* registrar,
-            context::Context* context, bool fullLitToNodeMap = false,
-            std::string name = "");
+  CnfStream(SatSolver* satSolver,
+            Registrar* registrar,
+            context::Context* context,
+            bool fullLitToNodeMap = false,
+            std::string name = "",
+            StatisticsRegistry* registry = nullptr);
 
   /**
    * Destructs a CnfStream.  This implementation does nothing, but we
@@ -244,6 +267,18 @@ class CnfStream {
  * recursively.
  *
  * This implementation does this in a single recursive pass. [??? -Chris]
+ *
+ * With the polarity encoding (Plaisted-Greenbaum), a subexpression only gets
+ * the clauses of the polarities it occurs in: lit -> phi if it occurs
+ * positively, phi -> lit if it occurs negatively.  The polarities whose
+ * clauses are asserted are recorded, in the context of the stream, so that
+ * the missing clauses are added when the subexpression later occurs in
+ * another polarity, or when ensureLiteral() requires its literal to be
+ * definitionally equal to it.
+ *
+ * With gate hashing, the nested AND and OR gates that have no literal yet
+ * are flattened into their parent, and the gates of the same kind over the
+ * same input literals share their literal.
  */
 class TseitinCnfStream : public CnfStream {
  public:
@@ -255,10 +290,20 @@ class TseitinCnfStream : public CnfStream {
    * @param context the context that the CNF should respect.
    * @param fullLitToNodeMap maintain a full SAT-literal-to-Node mapping,
    * even for non-theory literals
+   * @param registry the registry of the statistics of the conversion, if any
+   * @param polarityEncoding assert only the clauses of the polarities the
+   * subexpressions occur in
+   * @param gateHashing flatten the AND and OR gates and share the literals
+   * of the structurally equal gates
    */
-  TseitinCnfStream(SatSolver* satSolver, Registrar* registrar,
-                   context::Context* context, bool fullLitToNodeMap = false,
-                   std::string name = "");
+  TseitinCnfStream(SatSolver* satSolver,
+                   Registrar* registrar,
+                   context::Context* context,
+                   bool fullLitToNodeMap = false,
+                   std::string name = "",
+                   StatisticsRegistry* registry = nullptr,
+                   bool polarityEncoding = false,
+                   bool gateHashing = false);
 
   /**
    * Convert a given formula to CNF and assert it to the SAT solver.
@@ -273,6 +318,33 @@ class TseitinCnfStream : public CnfStream {
                         TNode from = TNode::null()) override;
 
  private:
+  /**
+   * The polarities of the occurrences of a subexpression phi of literal lit:
+   * a positive occurrence needs the clauses of lit -> phi, a negative one
+   * those of phi -> lit.
+   */
+  enum Polarity
+  {
+    POLARITY_POS = 1,
+    POLARITY_NEG = 2,
+    POLARITY_BOTH = 3
+  };
+
+  /** The polarities of the negation of a subexpression */
+  static unsigned flipPolarity(unsigned polarity)
+  {
+    return ((polarity & POLARITY_POS) ? POLARITY_NEG : 0)
+           | ((polarity & POLARITY_NEG) ? POLARITY_POS : 0);
+  }
+
+  /** A gate: its kind and the literals of its inputs */
+  typedef std::pair<Kind, SatClause> Gate;
+
+  struct GateHashFunction
+  {
+    size_t operator()(const Gate& gate) const;
+  };
+
   /**
    * Same as above, except that removable is remembered.
    */
@@ -280,21 +352,52 @@ class TseitinCnfStream : public CnfStream {
 
   // Each of these formulas handles takes care of a Node of each Kind.
   //
-  // Each handleX(Node &n) is responsible for:
+  // Each handleX(Node &n, polarity) is responsible for:
   //   - constructing a new literal, l (if necessary)
   //   - calling registerNode(n,l)
-  //   - adding clauses assure that l is equivalent to the Node
+  //   - adding clauses assure that l is equivalent to the Node, in the
+  //     given polarities (only the missing ones if l already exists)
   //   - calling toCNF on its children (if necessary)
   //   - returning l
-  //
-  // handleX( n ) can assume that n is not in d_translationCache
-  SatLiteral handleNot(TNode node);
-  SatLiteral handleXor(TNode node);
-  SatLiteral handleImplies(TNode node);
-  SatLiteral handleIff(TNode node);
-  SatLiteral handleIte(TNode node);
-  SatLiteral handleAnd(TNode node);
-  SatLiteral handleOr(TNode node);
+  SatLiteral handleNot(TNode node, unsigned polarity);
+  SatLiteral handleXor(TNode node, unsigned polarity);
+  SatLiteral handleImplies(TNode node, unsigned polarity);
+  SatLiteral handleIff(TNode node, unsigned polarity);
+  SatLiteral handleIte(TNode node, unsigned polarity);
+  SatLiteral handleAnd(TNode node, unsigned polarity);
+  SatLiteral handleOr(TNode node, unsigned polarity);
+
+  /**
+   * Adds to inputs the literals of the children of the AND or OR node,
+   * negated if negated is true, converted in the given polarity.  With gate
+   * hashing, the children of the same kind (or of the dual kind under a
+   * negation) that have no literal yet are flattened into node.
+   */
+  void getGateInputs(TNode node,
+                     bool negated,
+                     unsigned polarity,
+                     SatClause& inputs);
+
+  /**
+   * Gets in lit the literal of the gate node of the given kind and inputs,
+   * and returns the polarities of node whose clauses are still to be
+   * asserted.  With gate hashing, the inputs of AND and OR gates are sorted
+   * and deduplicated; a gate that is constant, or equivalent to its only
+   * input, gets the literal of that constant or input and needs no clauses,
+   * and a gate structurally equal to a gate converted before shares its
+   * literal.
+   */
+  unsigned getGateLiteral(TNode node,
+                          Kind kind,
+                          SatClause& inputs,
+                          unsigned polarity,
+                          SatLiteral& lit);
+
+  /** The polarities whose clauses are asserted for the gate of lit */
+  unsigned getPolarity(SatLiteral lit) const;
+
+  /** Record that the clauses of the given polarities are asserted for lit */
+  void addPolarity(SatLiteral lit, unsigned polarity);
 
   void convertAndAssertAnd(TNode node, bool negated);
   void convertAndAssertOr(TNode node, bool negated);
@@ -307,12 +410,31 @@ class TseitinCnfStream : public CnfStream {
    * Transforms the node into CNF recursively.
    * @param node the formula to transform
    * @param negated whether the literal is negated
+   * @param polarity the polarities node occurs in, with the polarity
+   * encoding (both polarities otherwise)
    * @return the literal representing the root of the formula
    */
-  SatLiteral toCNF(TNode node, bool negated = false);
+  SatLiteral toCNF(TNode node,
+                   bool negated = false,
+                   unsigned polarity = POLARITY_BOTH);
 
   void ensureLiteral(TNode n, bool noPreregistration = false) override;
 
+  /** Whether we use the polarity encoding */
+  const bool d_polarityEncoding;
+
+  /** Whether we flatten and hash the gates */
+  const bool d_gateHashing;
+
+  /**
+   * The polarities whose clauses are asserted for each gate variable, for
+   * its positive literal, with the polarity encoding.
+   */
+  context::CDHashMap<SatVariable, unsigned> d_gatePolarity;
+
+  /** The literal of each gate, with gate hashing */
+  context::CDInsertHashMap<Gate, SatLiteral, GateHashFunction> d_gates;
+
 }; /* class TseitinCnfStream */
 
 } /* CVC4::prop namespace */
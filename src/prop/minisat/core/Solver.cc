@@ -34,6 +34,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "proof/sat_proof.h"
 #include "proof/sat_proof_implementation.h"
 #include "prop/minisat/minisat.h"
+#include "prop/clause_exchange.h"
 #include "prop/minisat/mtl/Sort.h"
 #include "prop/theory_proxy.h"
 
@@ -152,7 +153,9 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       d_context(context),
       assertionLevel(0),
       d_enable_incremental(enable_incremental),
-      minisat_busy(false)
+      minisat_busy(false),
+      lemmas_imported_begin(0),
+      lemmas_imported_end(0)
       // Parameters (user settable):
       //
       ,
@@ -180,7 +183,20 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       //
       ,
       learntsize_adjust_start_confl(100),
-      learntsize_adjust_inc(1.5)
+      learntsize_adjust_inc(1.5),
+      chrono_backtrack(false),
+      chrono_distance(100),
+      chrono_conflicts(4000),
+      tier_core_lbd(2),
+      tier_mid_lbd(6),
+      inprocessing(false),
+      inprocess_interval(10000),
+      inprocess_effort(0.1),
+      lemma_dedup(false),
+      lemma_limit(0),
+      target_phases(false),
+      rephasing(false),
+      rephase_interval(1000)
 
       // Statistics: (formerly in 'SolverStats')
       //
@@ -196,7 +212,28 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       clauses_literals(0),
       learnts_literals(0),
       max_literals(0),
-      tot_literals(0)
+      tot_literals(0),
+      learnts_core(0),
+      learnts_mid(0),
+      learnts_local(0),
+      reductions(0),
+      tier_promotions(0),
+      tier_demotions(0),
+      chrono_backtracks(0),
+      nonchrono_backtracks(0),
+      inprocessings(0),
+      failed_literals(0),
+      subsumed_clauses(0),
+      strengthened_clauses(0),
+      vivified_clauses(0),
+      vivified_literals(0),
+      theory_lemmas(0),
+      duplicate_lemmas(0),
+      evicted_lemmas(0),
+      rephases(0),
+      rephases_best(0),
+      rephases_flipped(0),
+      rephases_random(0)
 
       ,
       ok(true),
@@ -208,7 +245,14 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy,
       simpDB_props(0),
       order_heap(VarOrderLt(activity)),
       progress_estimate(0),
-      remove_satisfied(!enable_incremental)
+      remove_satisfied(!enable_incremental),
+      lbd_stamp_counter(0),
+      next_inprocess(0),
+      inprocess_props(0),
+      probe_next(0),
+      target_assigned(0),
+      best_assigned(0),
+      next_rephase(0)
 
       // Resource constraints:
       //
@@ -258,6 +302,8 @@ Var Solver::newVar(bool sign, bool dvar, bool isTheoryAtom, bool preRegister, bo
     activity .push(rnd_init_act ? drand(random_seed) * 0.00001 : 0);
     seen     .push(0);
     polarity .push(sign);
+    target_phase.push(2);
+    best_phase.push(2);
     decision .push();
     trail    .capacity(v+1);
     theory   .push(isTheoryAtom);
@@ -290,6 +336,8 @@ void Solver::resizeVars(int newSize) {
     activity.shrink(shrinkSize);
     seen.shrink(shrinkSize);
     polarity.shrink(shrinkSize);
+    target_phase.shrink(shrinkSize);
+    best_phase.shrink(shrinkSize);
     decision.shrink(shrinkSize);
     theory.shrink(shrinkSize);
 
@@ -401,6 +449,7 @@ CRef Solver::reason(Var x) {
           ProofManager::getCnfProof()->popCurrentAssertion(););
     vardata[x] = VarData(real_reason, level(x), user_level(x), intro_level(x), trail_index(x));
     clauses_removable.push(real_reason);
+    learnts_local++;
     attachClause(real_reason);
 
     return real_reason;
@@ -598,6 +647,7 @@ void Solver::removeClause(CRef cr) {
     detachClause(cr);
     // Don't leave pointers to free'd memory!
     if (locked(c)) vardata[var(c[0])].d_reason = CRef_Undef;
+    if (c.lemma()) theory_lemmas--;
     c.mark(1);
     ca.free(cr);
 }
@@ -625,6 +675,12 @@ void Solver::cancelUntil(int level) {
         }
         for (int c = trail.size()-1; c >= trail_lim[level]; c--){
             Var      x  = var(trail[c]);
+            // Keep the literals assigned out of order at or below the level
+            // (see search())
+            if (vardata[x].d_level <= level) {
+              cancel_kept.push(trail[c]);
+              continue;
+            }
             assigns [x] = l_Undef;
             vardata[x].d_trail_index = -1;
             if ((phase_saving > 1 ||
@@ -639,6 +695,19 @@ void Solver::cancelUntil(int level) {
         trail_lim.shrink(trail_lim.size() - level);
         flipped.shrink(flipped.size() - level);
 
+        // Put the kept literals back on the trail, to be propagated again, and
+        // assert them again to the theories, which forgot them with the
+        // popped contexts
+        for (int k = cancel_kept.size() - 1; k >= 0; k--) {
+          Lit p = cancel_kept[k];
+          vardata[var(p)].d_trail_index = trail.size();
+          trail.push_(p);
+          if (theory[var(p)]) {
+            d_proxy->enqueueTheoryLiteral(MinisatSatSolver::toSatLiteral(p));
+          }
+        }
+        cancel_kept.clear();
+
         // Register variables that have not been registered yet
         int currentLevel = decisionLevel();
         for (int i = variables_to_register.size() - 1;
@@ -779,6 +848,13 @@ Lit Solver::pickBranchLit()
         Assert(dec_pol == l_True || dec_pol == l_False);
         decisionLit = mkLit(next, (dec_pol == l_True));
       }
+      else if (target_phases && !rnd_pol && (polarity[next] & 0x2) == 0
+               && target_phase[next] != 2)
+      {
+        // The polarity of the largest conflict-free assignment, unless the
+        // theories require one
+        decisionLit = mkLit(next, target_phase[next]);
+      }
       else
       {
         // If it can't use internal heuristic to do that
@@ -847,7 +923,16 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
           Clause& c = ca[confl];
           max_resolution_level = std::max(max_resolution_level, c.level());
 
-          if (c.removable()) claBumpActivity(c);
+          if (c.removable())
+          {
+            claBumpActivity(c);
+            updateLBD(c);
+          }
+          if (c.imported())
+          {
+            c.imported(false);
+            d_proxy->notifyImportedClauseUseful();
+          }
         }
 
         for (int j = (p == lit_Undef) ? 0 : 1, size = ca[confl].size();
@@ -883,9 +968,12 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
           }
         }
 
-        // Select next clause to look at:
-        while (!seen[var(trail[index--])]);
-        p     = trail[index+1];
+        // Select next clause to look at, skipping the literals of lower
+        // levels assigned out of order:
+        do {
+            while (!seen[var(trail[index--])]);
+            p = trail[index+1];
+        } while (level(var(p)) < decisionLevel());
         confl = reason(var(p));
         seen[var(p)] = 0;
         pathC--;
@@ -969,6 +1057,37 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 }
 
 
+// Put in front of the conflict clause 'confl' its literal of highest level, and then the one of
+// highest level of the others, which are watched. Returns the highest level, and sets 'single' if
+// the second literal is below it.
+int Solver::conflictLevel(CRef confl, bool& single)
+{
+    Clause& c  = ca[confl];
+    int     i0 = 0;
+    for (int k = 1; k < c.size(); k++)
+        if (level(var(c[k])) > level(var(c[i0])))
+            i0 = k;
+    int     i1 = i0 == 0 ? 1 : 0;
+    for (int k = 0; k < c.size(); k++)
+        if (k != i0 && level(var(c[k])) > level(var(c[i1])))
+            i1 = k;
+
+    if (i0 > 1 || i1 > 1){
+        remove(watches[~c[0]], Watcher(confl, c[1]));
+        remove(watches[~c[1]], Watcher(confl, c[0]));
+        Lit tmp = c[0]; c[0] = c[i0]; c[i0] = tmp;
+        if (i1 == 0) i1 = i0;
+        tmp = c[1]; c[1] = c[i1]; c[i1] = tmp;
+        watches[~c[0]].push(Watcher(confl, c[1]));
+        watches[~c[1]].push(Watcher(confl, c[0]));
+    }else if (i0 == 1){
+        Lit tmp = c[0]; c[0] = c[1]; c[1] = tmp; }
+
+    single = level(var(c[1])) < level(var(c[0]));
+    return level(var(c[0]));
+}
+
+
 // Check if 'p' can be removed. 'abstract_levels' is used to abort early if the algorithm is
 // visiting literals at levels that cannot be removed later.
 bool Solver::litRedundant(Lit p, uint32_t abstract_levels)
@@ -1049,13 +1168,14 @@ void Solver::analyzeFinal(Lit p, vec<Lit>& out_conflict)
 }
 
 
-void Solver::uncheckedEnqueue(Lit p, CRef from)
+void Solver::uncheckedEnqueue(Lit p, CRef from, int level)
 {
     Debug("minisat") << "unchecked enqueue of " << p << " (" << trail_index(var(p)) << ") trail size is " << trail.size() << " cap is " << trail.capacity() << std::endl;
     assert(value(p) == l_Undef);
     assert(var(p) < nVars());
     assigns[var(p)] = lbool(!sign(p));
-    vardata[var(p)] = VarData(from, decisionLevel(), assertionLevel, intro_level(var(p)), trail.size());
+    assert(level <= decisionLevel());
+    vardata[var(p)] = VarData(from, level, assertionLevel, intro_level(var(p)), trail.size());
     trail.push_(p);
     if (theory[var(p)]) {
       // Enqueue to the theory
@@ -1258,15 +1378,32 @@ CRef Solver::propagateBool()
                     goto NextClause; }
 
             // Did not find watch -- clause is unit under assignment:
-            *j++ = w;
             if (value(first) == l_False){
+                *j++ = w;
                 confl = cr;
                 qhead = trail.size();
                 // Copy the remaining watches:
                 while (i < end)
                     *j++ = *i++;
-            }else
+            }else if (level(var(p)) == decisionLevel()){
+                *j++ = w;
                 uncheckedEnqueue(first, cr);
+            }else{
+                // 'p' was assigned out of order: 'first' is implied at the
+                // highest level of the other literals, which is watched
+                int lvl   = level(var(p));
+                int max_k = 1;
+                for (int k = 2; k < c.size(); k++)
+                    if (level(var(c[k])) > lvl){
+                        lvl   = level(var(c[k]));
+                        max_k = k; }
+                if (max_k == 1)
+                    *j++ = w;
+                else{
+                    c[1] = c[max_k]; c[max_k] = false_lit;
+                    watches[~c[1]].push(w); }
+                uncheckedEnqueue(first, cr, lvl);
+            }
 
         NextClause:;
         }
@@ -1284,8 +1421,11 @@ CRef Solver::propagateBool()
 |  reduceDB : ()  ->  [void]
 |
 |  Description:
-|    Remove half of the learnt clauses, minus the clauses locked by the current assignment. Locked
-|    clauses are clauses that are reason to some assignment. Binary clauses are never removed.
+|    Reduce the removable clauses, which are in three tiers by their LBD: the core clauses are
+|    kept, and so are the mid-tier clauses used in a conflict since the last reduction, the
+|    others moving to the local tier.  Half of the local clauses are removed, those of lowest
+|    activity, minus the clauses locked by the current assignment. Locked clauses are clauses
+|    that are reason to some assignment. Binary clauses are never removed.
 |________________________________________________________________________________________________@*/
 struct reduceDB_lt {
     ClauseAllocator& ca;
@@ -1295,23 +1435,123 @@ struct reduceDB_lt {
 };
 void Solver::reduceDB()
 {
+    assert(tiersCounted());
     int     i, j;
-    double  extra_lim = cla_inc / clauses_removable.size();    // Remove any clause below this activity
+    reductions++;
 
-    sort(clauses_removable, reduceDB_lt(ca));
+    // Move the core and mid-tier clauses in front of the local ones, demoting the mid-tier
+    // clauses that were not used:
+    for (i = j = 0; i < clauses_removable.size(); i++){
+        Clause& c = ca[clauses_removable[i]];
+        if (c.tier() == Clause::TIER_MID && !c.used()){
+            setTier(c, Clause::TIER_LOCAL);
+            tier_demotions++; }
+        c.used(false);
+        if (c.tier() != Clause::TIER_LOCAL){
+            CRef cr = clauses_removable[i];
+            clauses_removable[i] = clauses_removable[j];
+            clauses_removable[j++] = cr; }
+    }
+
+    int     first_local = j;
+    int     num_local   = clauses_removable.size() - first_local;
+    if (num_local == 0)
+        return;
+    double  extra_lim = cla_inc / num_local;    // Remove any clause below this activity
+
+    sort((CRef*)clauses_removable + first_local, num_local, reduceDB_lt(ca));
     // Don't delete binary or locked clauses. From the rest, delete clauses from the first half
     // and clauses with activity smaller than 'extra_lim':
-    for (i = j = 0; i < clauses_removable.size(); i++){
+    for (i = j = first_local; i < clauses_removable.size(); i++){
         Clause& c = ca[clauses_removable[i]];
-        if (c.size() > 2 && !locked(c) && (i < clauses_removable.size() / 2 || c.activity() < extra_lim))
-            removeClause(clauses_removable[i]);
+        if (c.size() > 2 && !locked(c) && (i - first_local < num_local / 2 || c.activity() < extra_lim)){
+            removeClause(clauses_removable[i]); }
         else
             clauses_removable[j++] = clauses_removable[i];
     }
     clauses_removable.shrink(i - j);
+    countTiers();
     checkGarbage();
 }
 
+void Solver::countTiers()
+{
+    learnts_core = learnts_mid = learnts_local = 0;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        int tier = ca[clauses_removable[i]].tier();
+        if      (tier == Clause::TIER_CORE) learnts_core++;
+        else if (tier == Clause::TIER_MID)  learnts_mid++;
+        else                                learnts_local++;
+    }
+}
+
+bool Solver::tiersCounted() const
+{
+    uint64_t counts[] = { 0, 0, 0 };
+    for (int i = 0; i < clauses_removable.size(); i++)
+        counts[ca[clauses_removable[i]].tier()]++;
+    return counts[Clause::TIER_CORE] == learnts_core
+        && counts[Clause::TIER_MID] == learnts_mid
+        && counts[Clause::TIER_LOCAL] == learnts_local;
+}
+
+/*_________________________________________________________________________________________________
+|
+|  reduceLemmas : [void]  ->  [void]
+|
+|  Description:
+|    Remove the least active half of the removable theory lemmas that are in the local tier, i.e.
+|    that have not been useful in conflicts, at a restart where the database has too many of
+|    them. Binary and locked lemmas are kept.
+|________________________________________________________________________________________________@*/
+void Solver::reduceLemmas()
+{
+    assert(tiersCounted());
+    int       i, j;
+    vec<CRef> local;
+    for (i = 0; i < clauses_removable.size(); i++){
+        Clause& c = ca[clauses_removable[i]];
+        if (c.lemma() && c.tier() == Clause::TIER_LOCAL && c.size() > 2 && !locked(c))
+            local.push(clauses_removable[i]);
+    }
+    sort(local, reduceDB_lt(ca));
+    for (i = 0; i < local.size() / 2; i++){
+        removeClause(local[i]);
+        evicted_lemmas++;
+    }
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+    countTiers();
+    checkGarbage();
+}
+
+void Solver::setTier(Clause& c, int tier)
+{
+    uint64_t* counts[] = { &learnts_core, &learnts_mid, &learnts_local };
+    (*counts[c.tier()])--;
+    (*counts[tier])++;
+    c.tier(tier);
+}
+
+void Solver::updateLBD(Clause& c)
+{
+    c.used(true);
+    if (c.tier() == Clause::TIER_CORE)
+        return;
+    int lbd = computeLBD(c);
+    if (lbd >= c.lbd())
+        return;
+    c.lbd(lbd);
+    if (lbd <= tier_core_lbd){
+        setTier(c, Clause::TIER_CORE);
+        tier_promotions++;
+    }else if (lbd <= tier_mid_lbd && c.tier() == Clause::TIER_LOCAL){
+        setTier(c, Clause::TIER_MID);
+        tier_promotions++; }
+}
+
 
 void Solver::removeSatisfied(vec<CRef>& cs)
 {
@@ -1346,6 +1586,58 @@ void Solver::removeClausesAboveLevel(vec<CRef>& cs, int level)
     cs.shrink(i - j);
 }
 
+/*_________________________________________________________________________________________________
+|
+|  updatePhases : (consistent : int)  ->  [void]
+|
+|  Description:
+|    Given that the first 'consistent' literals of the trail are free of conflict, record their
+|    polarities as the target phases if they are more than the literals of the current target,
+|    and as the best phases if they are more than those of the current best.
+|________________________________________________________________________________________________@*/
+void Solver::updatePhases(int consistent)
+{
+    if (consistent > target_assigned){
+        for (int i = 0; i < consistent; i++)
+            target_phase[var(trail[i])] = sign(trail[i]);
+        target_assigned = consistent; }
+    if (consistent > best_assigned){
+        for (int i = 0; i < consistent; i++)
+            best_phase[var(trail[i])] = sign(trail[i]);
+        best_assigned = consistent; }
+}
+
+/*_________________________________________________________________________________________________
+|
+|  rephase : [void]  ->  [void]
+|
+|  Description:
+|    Reset the saved polarities, in turn to the best phases, to their negation, to the best phases
+|    again, and to random ones, and start a new target from them. The polarities required by the
+|    theories are kept.
+|________________________________________________________________________________________________@*/
+void Solver::rephase()
+{
+    int step = rephases % 4;
+    rephases++;
+    next_rephase = conflicts + rephase_interval * (rephases + 1);
+
+    for (Var v = 0; v < nVars(); v++){
+        if ((polarity[v] & 0x2) == 0){
+            if      (step == 1)           polarity[v] ^= 1;
+            else if (step == 3)           polarity[v] = drand(random_seed) < 0.5;
+            else if (best_phase[v] != 2)  polarity[v] = best_phase[v]; }
+        target_phase[v] = polarity[v] & 0x1;
+    }
+    target_assigned = 0;
+
+    if      (step == 1) rephases_flipped++;
+    else if (step == 3) rephases_random++;
+    else {
+        rephases_best++;
+        best_assigned = 0; }
+}
+
 void Solver::rebuildOrderHeap()
 {
     vec<Var> vs;
@@ -1376,6 +1668,7 @@ bool Solver::simplify()
 
     // Remove satisfied clauses:
     removeSatisfied(clauses_removable);
+    countTiers();
     if (remove_satisfied)        // Can be turned off.
         removeSatisfied(clauses_persistent);
     checkGarbage();
@@ -1388,6 +1681,276 @@ bool Solver::simplify()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  inprocess : [void]  ->  [bool]
+|
+|  Description:
+|    Simplify the clauses at level 0, between two restarts: assert the negation of the failed
+|    literals, remove or strengthen the subsumed removable clauses, and vivify the core and
+|    mid-tier ones. The persistent clauses are left as they are, only 'SimpSolver' eliminates
+|    variables in them. Only the Boolean propagation is used, the theories get the units found when
+|    the search propagates again. The probing and the vivification spend a fraction of the
+|    propagations of the search since the last inprocessing ('inprocess_effort').
+|    Returns FALSE if the clauses are found unsatisfiable.
+|________________________________________________________________________________________________@*/
+bool Solver::inprocess()
+{
+    assert(decisionLevel() == 0);
+    inprocessings++;
+    next_inprocess = conflicts + inprocess_interval * (inprocessings + 1);
+
+    uint64_t budget = (uint64_t)((propagations - inprocess_props) * inprocess_effort / 2) + nVars();
+
+    // The probes must not change the saved phases
+    int saved_phase_saving = phase_saving;
+    phase_saving = 0;
+    bool result = ok
+               && propagateBool() == CRef_Undef
+               && probe(propagations + budget)
+               && subsumeRemovable(budget)
+               && vivify(propagations + budget);
+    phase_saving = saved_phase_saving;
+
+    // Forget the removable clauses removed or replaced:
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+    countTiers();
+
+    inprocess_props = propagations;
+    if (!result)
+        return ok = false;
+    checkGarbage();
+    return true;
+}
+
+// Probe the literals that propagate something, in turn from 'probe_next': when the propagation
+// of a literal conflicts, its negation holds at level 0.
+bool Solver::probe(uint64_t limit)
+{
+    int n;
+    for (n = 0; n < nVars() && propagations < limit && !asynch_interrupt; n++){
+        Var v = (probe_next + n) % nVars();
+        if (!decision[v])
+            continue;
+        for (int s = 0; s < 2 && value(v) == l_Undef; s++){
+            Lit p = mkLit(v, s);
+            if (watches[p].size() == 0)
+                continue;
+            newDecisionLevel();
+            uncheckedEnqueue(p);
+            bool failed = propagateBool() != CRef_Undef;
+            cancelUntil(0);
+            if (failed){
+                failed_literals++;
+                uncheckedEnqueue(~p);
+                if (propagateBool() != CRef_Undef)
+                    return false;
+            }
+        }
+    }
+    if (nVars() > 0)
+        probe_next = (probe_next + n) % nVars();
+    return true;
+}
+
+// Remove the removable clauses subsumed by another one, and strengthen those that another one
+// resolves with into a subsuming clause, the shortest ones first. A clause is only reduced by the
+// clauses of user level at most its own, which it does not outlive. Each clause is listed under
+// one of its literals, so that the clauses reducing a clause are found under its literals and
+// their negations.
+struct subsume_lt {
+    ClauseAllocator& ca;
+    subsume_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) { return ca[x].size() < ca[y].size(); }
+};
+bool Solver::subsumeRemovable(uint64_t limit)
+{
+    vec<CRef> cs;
+    clauses_removable.copyTo(cs);
+    sort(cs, subsume_lt(ca));
+
+    vec<vec<CRef> > occs(2 * nVars());
+    vec<char>       marks(2 * nVars(), 0);
+    vec<Lit>        lits;
+    uint64_t        steps = 0;
+
+    for (int i = 0; i < cs.size() && steps < limit && !asynch_interrupt; i++){
+        CRef cr = cs[i];
+        if (ca[cr].mark() != 0 || satisfied(ca[cr]))
+            continue;
+
+        Lit removed;
+        do {
+            Clause& c        = ca[cr];
+            bool    subsumed = false;
+            removed = lit_Undef;
+            for (int k = 0; k < c.size(); k++)
+                marks[toInt(c[k])] = 1;
+            for (int k = 0; k < c.size() && !subsumed && removed == lit_Undef; k++)
+                for (int s = 0; s < 2 && !subsumed && removed == lit_Undef; s++){
+                    const vec<CRef>& os = occs[toInt(c[k] ^ (bool)s)];
+                    for (int m = 0; m < os.size(); m++){
+                        Clause& o = ca[os[m]];
+                        if (o.level() > c.level())
+                            continue;
+                        steps += o.size();
+                        // All the literals of 'o' are in 'c', but maybe one that is negated:
+                        Lit flip = lit_Undef;
+                        int q;
+                        for (q = 0; q < o.size(); q++){
+                            if (marks[toInt(o[q])])
+                                continue;
+                            if (flip != lit_Undef || !marks[toInt(~o[q])])
+                                break;
+                            flip = o[q];
+                        }
+                        if (q < o.size())
+                            continue;
+                        if (flip == lit_Undef){
+                            subsumed = true;
+                            // The subsuming clause is kept as long as 'c' would have been:
+                            if (o.tier() > c.tier())
+                                o.tier(c.tier());
+                        }else
+                            removed = ~flip;
+                        break;
+                    }
+                }
+            for (int k = 0; k < c.size(); k++)
+                marks[toInt(c[k])] = 0;
+
+            if (subsumed){
+                subsumed_clauses++;
+                removeClause(cr);
+                cr = CRef_Undef;
+            }else if (removed != lit_Undef){
+                strengthened_clauses++;
+                lits.clear();
+                for (int k = 0; k < c.size(); k++)
+                    if (c[k] != removed)
+                        lits.push(c[k]);
+                detachClause(cr);
+                if (!replaceRemovable(cr, lits, c.level()))
+                    return false;
+            }
+        } while (cr != CRef_Undef && removed != lit_Undef);
+
+        if (cr != CRef_Undef){
+            const Clause& c = ca[cr];
+            Lit best = c[0];
+            for (int k = 1; k < c.size(); k++)
+                if (occs[toInt(c[k])].size() < occs[toInt(best)].size())
+                    best = c[k];
+            occs[toInt(best)].push(cr);
+        }
+    }
+    return true;
+}
+
+// Shorten the core and mid-tier removable clauses not vivified yet, the lowest LBD first: with a
+// clause detached, the negations of its literals are asserted one by one, until a literal is true
+// or the propagation conflicts. The clause is then implied by the literals asserted and the true
+// one, without the literals found false.
+struct vivify_lt {
+    ClauseAllocator& ca;
+    vivify_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) { return ca[x].lbd() < ca[y].lbd(); }
+};
+bool Solver::vivify(uint64_t limit)
+{
+    vec<CRef> cs;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        if (c.mark() == 0 && c.tier() != Clause::TIER_LOCAL && c.size() > 2 && !c.vivified())
+            cs.push(clauses_removable[i]);
+    }
+    sort(cs, vivify_lt(ca));
+
+    vec<Lit> lits;
+    for (int i = 0; i < cs.size() && propagations < limit && !asynch_interrupt; i++){
+        CRef    cr = cs[i];
+        Clause& c  = ca[cr];
+        if (satisfied(c))
+            continue;
+        c.vivified(true);
+
+        detachClause(cr, true);
+        newDecisionLevel();
+        lits.clear();
+        for (int k = 0; k < c.size(); k++){
+            Lit l = c[k];
+            if (value(l) == l_False)
+                continue;
+            lits.push(l);
+            if (value(l) == l_True)
+                break;
+            uncheckedEnqueue(~l);
+            if (propagateBool() != CRef_Undef)
+                break;
+        }
+        cancelUntil(0);
+
+        if (lits.size() == c.size()){
+            attachClause(cr);
+            continue;
+        }
+        vivified_clauses++;
+        vivified_literals += c.size() - lits.size();
+        if (!replaceRemovable(cr, lits, assertionLevel))
+            return false;
+    }
+    return true;
+}
+
+// Replace the removable clause 'cr', detached, by the clause of the given literals, which the
+// clauses of user level at most 'level' imply. 'cr' becomes the new clause, or CRef_Undef when
+// the new clause is a unit, which is asserted. Returns FALSE on a conflict at level 0.
+bool Solver::replaceRemovable(CRef& cr, const vec<Lit>& lits, int level)
+{
+    assert(decisionLevel() == 0);
+    Clause& c    = ca[cr];
+    int     tier = c.tier();
+    int     lbd  = c.lbd();
+    float   act  = c.activity();
+    bool    viv  = c.vivified();
+    bool    lem  = c.lemma();
+    if (lem) theory_lemmas--;
+    c.mark(1);
+    ca.free(cr);
+    cr = CRef_Undef;
+
+    vec<Lit> ps;
+    for (int i = 0; i < lits.size(); i++)
+        if (value(lits[i]) != l_False)
+            ps.push(lits[i]);
+    if (ps.size() == 0)
+        return false;
+    if (ps.size() == 1){
+        if (value(ps[0]) == l_Undef)
+            uncheckedEnqueue(ps[0]);
+        return propagateBool() == CRef_Undef;
+    }
+
+    cr = ca.alloc(level, ps, true);
+    Clause& n = ca[cr];
+    n.lbd(std::min(lbd, ps.size()));
+    n.tier(tier);
+    n.activity() = act;
+    n.vivified(viv);
+    if (lem){
+        n.lemma(true);
+        theory_lemmas++;
+        if (lemma_dedup) indexLemma(n, cr); }
+    clauses_removable.push(cr);
+    attachClause(cr);
+    return true;
+}
+
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -1409,6 +1972,11 @@ lbool Solver::search(int nof_conflicts)
     vec<Lit>    learnt_clause;
     starts++;
 
+    // Pick up the clauses shared by the other solvers at each restart
+    if (d_proxy->isSharingClauses()) {
+      importClauses();
+    }
+
     TheoryCheckType check_type = CHECK_WITH_THEORY;
     for (;;) {
 
@@ -1425,10 +1993,59 @@ lbool Solver::search(int nof_conflicts)
                 return l_False;
             }
 
+            // The levels below the current one were propagated without conflict
+            if (target_phases || rephasing) {
+                updatePhases(trail_lim.last());
+            }
+
+            // After chronological backtracking, the conflict can be below the
+            // current level, and have a single literal at its level. Without
+            // it, the search is that of plain Minisat.
+            if (chrono_backtrack && confl != CRef_Lazy) {
+                bool single;
+                int  confl_level = conflictLevel(confl, single);
+                if (confl_level == 0) {
+                    cancelUntil(0);
+                    PROOF( ProofManager::getSatProof()->finalizeProof(confl); )
+                    return l_False;
+                }
+                if (single) {
+                    // The clause propagates its first literal at the level
+                    // of the second one
+                    cancelUntil(level(var(ca[confl][1])));
+                    uncheckedEnqueue(ca[confl][0], confl);
+                    continue;
+                }
+                cancelUntil(confl_level);
+            }
+
             // Analyze the conflict
             learnt_clause.clear();
             int max_level = analyze(confl, learnt_clause, backtrack_level);
-            cancelUntil(backtrack_level);
+            // The LBD needs the decision levels of the literals
+            int lbd = computeLBD(learnt_clause);
+            // Only the clauses that do not depend on the user assertions
+            // hold in the other solvers
+            if (d_proxy->isSharingClauses()
+                && (assertionLevelOnly() ? assertionLevel : max_level) == 0)
+            {
+              exportClause(learnt_clause, lbd);
+            }
+            // Backtrack only one level instead of jumping far back, which
+            // would make the theories assert and propagate again the
+            // literals of the levels in between
+            if (chrono_backtrack && learnt_clause.size() > 1
+                && conflicts >= chrono_conflicts
+                && decisionLevel() - backtrack_level > chrono_distance)
+            {
+              chrono_backtracks++;
+              cancelUntil(decisionLevel() - 1);
+            }
+            else
+            {
+              nonchrono_backtracks++;
+              cancelUntil(backtrack_level);
+            }
 
             // Assert the conflict clause and the asserting literal
             if (learnt_clause.size() == 1) {
@@ -1442,9 +2059,15 @@ lbool Solver::search(int nof_conflicts)
                            learnt_clause,
                            true);
               clauses_removable.push(cr);
+              learnts_local++;
+              ca[cr].lbd(lbd);
+              if (lbd <= tier_core_lbd)
+                setTier(ca[cr], Clause::TIER_CORE);
+              else if (lbd <= tier_mid_lbd)
+                setTier(ca[cr], Clause::TIER_MID);
               attachClause(cr);
               claBumpActivity(ca[cr]);
-              uncheckedEnqueue(learnt_clause[0], cr);
+              uncheckedEnqueue(learnt_clause[0], cr, backtrack_level);
               PROOF(ClauseId id =
                         ProofManager::getSatProof()->registerClause(cr, LEARNT);
                     PSTATS(std::unordered_set<int> cl_levels;
@@ -1507,6 +2130,12 @@ lbool Solver::search(int nof_conflicts)
               // [mdeters] notify theory engine of restarts for deferred
               // theory processing
               d_proxy->notifyRestart();
+              if (lemma_limit > 0 && theory_lemmas > lemma_limit) {
+                reduceLemmas();
+              }
+              if (rephasing && conflicts >= next_rephase) {
+                rephase();
+              }
               return l_Undef;
             }
 
@@ -1515,7 +2144,16 @@ lbool Solver::search(int nof_conflicts)
                 return l_False;
             }
 
-            if (clauses_removable.size()-nAssigns() >= max_learnts) {
+            // Inprocess every so many conflicts, and propagate the units
+            // found with the theories
+            if (inprocessing && decisionLevel() == 0 && conflicts >= next_inprocess) {
+                if (!inprocess()) {
+                    return l_False;
+                }
+                continue;
+            }
+
+            if ((int64_t)learnts_local - nAssigns() >= max_learnts) {
                 // Reduce the set of learnt clauses:
                 reduceDB();
             }
@@ -1624,6 +2262,10 @@ lbool Solver::solve_()
     max_learnts               = nClauses() * learntsize_factor;
     learntsize_adjust_confl   = learntsize_adjust_start_confl;
     learntsize_adjust_cnt     = (int)learntsize_adjust_confl;
+    next_inprocess            = conflicts + inprocess_interval * (inprocessings + 1);
+    next_rephase              = conflicts + rephase_interval * (rephases + 1);
+    target_assigned           = 0;
+    best_assigned             = 0;
     lbool   status            = l_Undef;
 
     if (verbosity >= 1){
@@ -1781,6 +2423,14 @@ void Solver::relocAll(ClauseAllocator& to)
       ca.reloc(
           clauses_persistent[i], to, NULLPROOF(ProofManager::getSatProof()));
 
+    // The index of the theory lemmas:
+    //
+    lemma_index.clear();
+    if (lemma_dedup)
+        for (int i = 0; i < clauses_removable.size(); i++)
+            if (to[clauses_removable[i]].lemma())
+                indexLemma(to[clauses_removable[i]], clauses_removable[i]);
+
     PROOF(ProofManager::getSatProof()->finishUpdateCRef();)
 }
 
@@ -1841,6 +2491,7 @@ void Solver::pop()
   // Remove the clauses
   removeClausesAboveLevel(clauses_persistent, assertionLevel);
   removeClausesAboveLevel(clauses_removable, assertionLevel);
+  countTiers();
 
   // Pop the SAT context to notify everyone
   d_context->pop();  // SAT context for CVC4
@@ -1855,6 +2506,61 @@ void Solver::pop()
   trail_ok.pop();
 }
 
+/** A hash of the literals of a clause that does not depend on their order */
+template <class C>
+static uint32_t lemmaHash(const C& lits)
+{
+  uint32_t h = lits.size();
+  for (int i = 0; i < lits.size(); ++i)
+  {
+    uint32_t x = toInt(lits[i]) * 0x9e3779b1u;
+    h += x ^ (x >> 16);
+  }
+  return h;
+}
+
+void Solver::indexLemma(const Clause& c, CRef cr)
+{
+  uint32_t h = lemmaHash(c);
+  if (lemma_index.has(h))
+  {
+    lemma_index[h] = cr;
+  }
+  else
+  {
+    lemma_index.insert(h, cr);
+  }
+}
+
+CRef Solver::findLemma(const vec<Lit>& lemma, int level)
+{
+  CRef cr;
+  if (!lemma_index.peek(lemmaHash(lemma), cr))
+  {
+    return CRef_Undef;
+  }
+  // The clause may have been removed since it was indexed
+  const Clause& c = ca[cr];
+  if (c.mark() == 1 || c.size() != lemma.size() || c.level() > level)
+  {
+    return CRef_Undef;
+  }
+  for (int i = 0; i < lemma.size(); ++i)
+  {
+    seen[var(lemma[i])] = 1 + sign(lemma[i]);
+  }
+  bool same = true;
+  for (int i = 0; same && i < c.size(); ++i)
+  {
+    same = seen[var(c[i])] == 1 + sign(c[i]);
+  }
+  for (int i = 0; i < lemma.size(); ++i)
+  {
+    seen[var(lemma[i])] = 0;
+  }
+  return same ? cr : CRef_Undef;
+}
+
 CRef Solver::updateLemmas() {
 
   Debug("minisat::lemmas") << "Solver::updateLemmas() begin" << std::endl;
@@ -1926,6 +2632,8 @@ CRef Solver::updateLemmas() {
     vec<Lit>& lemma = lemmas[j];
     bool removable = lemmas_removable[j];
 
+    bool imported = j >= lemmas_imported_begin && j < lemmas_imported_end;
+
     // Attach it if non-unit
     CRef lemma_ref = CRef_Undef;
     if (lemma.size() > 1) {
@@ -1940,7 +2648,31 @@ CRef Solver::updateLemmas() {
         }
       }
 
+      // A removable theory lemma with two literals that are not false
+      // neither propagates nor conflicts: drop it if the database has it
+      // already
+      if (lemma_dedup && removable && !imported && !PROOF_ON()
+          && value(lemma[1]) != l_False
+          && findLemma(lemma, clauseLevel) != CRef_Undef)
+      {
+        duplicate_lemmas++;
+        continue;
+      }
+
       lemma_ref = ca.alloc(clauseLevel, lemma, removable);
+      if (imported)
+      {
+        ca[lemma_ref].imported(true);
+      }
+      else if (removable)
+      {
+        ca[lemma_ref].lemma(true);
+        theory_lemmas++;
+        if (lemma_dedup)
+        {
+          indexLemma(ca[lemma_ref], lemma_ref);
+        }
+      }
       PROOF(TNode cnf_assertion = lemmas_cnf_assertion[j].first;
             TNode cnf_def = lemmas_cnf_assertion[j].second;
 
@@ -1952,6 +2684,7 @@ CRef Solver::updateLemmas() {
             ProofManager::getCnfProof()->setClauseDefinition(id, cnf_def););
       if (removable) {
         clauses_removable.push(lemma_ref);
+        learnts_local++;
       } else {
         clauses_persistent.push(lemma_ref);
       }
@@ -1986,6 +2719,11 @@ CRef Solver::updateLemmas() {
           }
         } else {
           Debug("minisat::lemmas") << "lemma size is " << lemma.size() << std::endl;
+          // An imported unit is useful if it propagates
+          if (lemma.size() == 1 && imported)
+          {
+            d_proxy->notifyImportedClauseUseful();
+          }
           uncheckedEnqueue(lemma[0], lemma_ref);
         }
       }
@@ -1997,6 +2735,8 @@ CRef Solver::updateLemmas() {
   lemmas.clear();
   lemmas_cnf_assertion.clear();
   lemmas_removable.clear();
+  lemmas_imported_begin = 0;
+  lemmas_imported_end = 0;
 
   if (conflict != CRef_Undef) {
     theoryConflict = true;
@@ -2007,6 +2747,51 @@ CRef Solver::updateLemmas() {
   return conflict;
 }
 
+void Solver::exportClause(const vec<Lit>& clause, int lbd)
+{
+  if (clause.size() > (int)CVC4::prop::ClauseExchange::kMaxSize)
+  {
+    return;
+  }
+  if (clause.size() > (int)options::satShareSize()
+      && lbd > (int)options::satShareLbd())
+  {
+    return;
+  }
+  CVC4::prop::SatClause satClause;
+  for (int i = 0; i < clause.size(); ++i)
+  {
+    satClause.push_back(MinisatSatSolver::toSatLiteral(clause[i]));
+  }
+  d_proxy->exportClause(satClause);
+}
+
+void Solver::importClauses()
+{
+  assert(decisionLevel() == 0);
+  std::vector<CVC4::prop::SatClause> clauses;
+  d_proxy->importClauses(clauses);
+  lemmas_imported_begin = lemmas.size();
+  for (CVC4::prop::SatClause& clause : clauses)
+  {
+    vec<Lit> ps;
+    MinisatSatSolver::toMinisatClause(clause, ps);
+    // Skip the clauses satisfied whatever the user level
+    bool satisfied = false;
+    for (int i = 0; i < ps.size() && !satisfied; ++i)
+    {
+      satisfied = value(ps[i]) == l_True && user_level(var(ps[i])) == 0;
+    }
+    if (!satisfied)
+    {
+      lemmas.push();
+      ps.copyTo(lemmas.last());
+      lemmas_removable.push(true);
+    }
+  }
+  lemmas_imported_end = lemmas.size();
+}
+
 void ClauseAllocator::reloc(CRef& cr,
                             ClauseAllocator& to,
                             CVC4::TSatProof<Solver>* proof)
@@ -2028,6 +2813,12 @@ void ClauseAllocator::reloc(CRef& cr,
   // Copy extra data-fields:
   // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
   to[cr].mark(c.mark());
+  to[cr].imported(c.imported());
+  to[cr].vivified(c.vivified());
+  to[cr].lbd(c.lbd());
+  to[cr].tier(c.tier());
+  to[cr].used(c.used());
+  to[cr].lemma(c.lemma());
   if (to[cr].removable())         to[cr].activity() = c.activity();
   else if (to[cr].has_extra()) to[cr].calcAbstraction();
 }
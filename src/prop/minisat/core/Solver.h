@@ -31,6 +31,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "prop/minisat/core/SolverTypes.h"
 #include "prop/minisat/mtl/Alg.h"
 #include "prop/minisat/mtl/Heap.h"
+#include "prop/minisat/mtl/Map.h"
 #include "prop/minisat/mtl/Vec.h"
 #include "prop/minisat/utils/Options.h"
 #include "theory/theory.h"
@@ -109,6 +110,36 @@ public:
   /** True if we are currently solving. */
   bool minisat_busy;
 
+  /** The lemmas imported from the other solvers sharing clauses */
+  int lemmas_imported_begin;
+  int lemmas_imported_end;
+
+  /**
+   * Share a clause learned at user level 0 with the other solvers, given its
+   * LBD
+   */
+  void exportClause(const vec<Lit>& clause, int lbd);
+
+  /** Queue the clauses shared by the other solvers as lemmas */
+  void importClauses();
+
+  /**
+   * The removable theory lemmas of the database, by a hash of their set of
+   * literals, rebuilt on garbage collection: a removable lemma that does not
+   * propagate is not added again while an identical one is in the database.
+   */
+  Map<uint32_t, CRef> lemma_index;
+
+  /** Add the removable theory lemma c, of reference cr, to lemma_index */
+  void indexLemma(const Clause& c, CRef cr);
+
+  /**
+   * The removable theory lemma of the database with the literals of lemma,
+   * that lives at least as long as a clause of the given level, or
+   * CRef_Undef
+   */
+  CRef findLemma(const vec<Lit>& lemma, int level);
+
   // Information about registration of variables
   struct VarIntroInfo
   {
@@ -152,9 +183,17 @@ public:
         // Unassigned literals are put to front
         if (x_value == l_Undef) return true;
         if (y_value == l_Undef) return false;
-        // Literals of the same value are sorted by decreasing levels
+        // Literals of the same value are sorted by decreasing levels, and
+        // decreasing trail indices in a level: with chronological
+        // backtracking, the trail is not sorted by levels
         if (x_value == y_value)
         {
+          int x_level = d_solver.level(var(x));
+          int y_level = d_solver.level(var(y));
+          if (x_level != y_level)
+          {
+            return x_level > y_level;
+          }
           return d_solver.trail_index(var(x)) > d_solver.trail_index(var(y));
         }
         else
@@ -232,6 +271,7 @@ public:
     int     nVars      ()      const;       // The current number of variables.
     int     nFreeVars  ()      const;
     bool    isDecision (Var x) const;       // is the given var a decision?
+    double  getActivity(Var x) const;       // The VSIDS activity of a variable.
 
     // Debugging SMT explanations
     //
@@ -280,10 +320,34 @@ public:
     int       learntsize_adjust_start_confl;
     double    learntsize_adjust_inc;
 
+    bool      chrono_backtrack;   // Backtrack chronologically on long backjumps.
+    int       chrono_distance;    // The backjumps over more than this many levels are long.                                   (default 100)
+    uint64_t  chrono_conflicts;   // Do not backtrack chronologically before this many conflicts.                              (default 4000)
+
+    int       tier_core_lbd;      // The learnt clauses of LBD at most this are kept for good.                                  (default 2)
+    int       tier_mid_lbd;       // The learnt clauses of LBD at most this are kept while they are used.                      (default 6)
+
+    bool      inprocessing;       // Simplify the clauses at level 0 every so many conflicts (see 'inprocess()').
+    uint64_t  inprocess_interval; // The k-th inprocessing happens k times this many conflicts after the previous one.         (default 10000)
+    double    inprocess_effort;   // The propagations of an inprocessing, relative to those of the search since the last one. (default 0.1)
+
+    bool      lemma_dedup;        // Do not add a removable theory lemma identical to one in the database.
+    uint64_t  lemma_limit;        // Evict local removable theory lemmas at restarts beyond this many (0 for no limit).       (default 0)
+
+    bool      target_phases;      // Decide the polarities of the largest conflict-free assignment (see 'updatePhases()').
+    bool      rephasing;          // Reset the saved polarities every so many conflicts (see 'rephase()').
+    uint64_t  rephase_interval;   // The k-th rephasing happens k times this many conflicts after the previous one.           (default 1000)
+
     // Statistics: (read-only member variable)
     //
     uint64_t solves, starts, decisions, rnd_decisions, propagations, conflicts, resources_consumed;
     uint64_t dec_vars, clauses_literals, learnts_literals, max_literals, tot_literals;
+    uint64_t learnts_core, learnts_mid, learnts_local;    // The number of removable clauses of each tier.
+    uint64_t reductions, tier_promotions, tier_demotions;
+    uint64_t chrono_backtracks, nonchrono_backtracks;
+    uint64_t inprocessings, failed_literals, subsumed_clauses, strengthened_clauses, vivified_clauses, vivified_literals;
+    uint64_t theory_lemmas, duplicate_lemmas, evicted_lemmas;   // The removable theory lemmas in the database, and those not added or evicted.
+    uint64_t rephases, rephases_best, rephases_flipped, rephases_random;
 
 protected:
 
@@ -348,6 +412,8 @@ protected:
     vec<lbool>          assigns;            // The current assignments.
     vec<int>            assigns_lim;        // The size by levels of the current assignment
     vec<char>           polarity;           // The preferred polarity of each variable (bit 0) and whether it's locked (bit 1).
+    vec<char>           target_phase;       // The polarity of each variable in the largest conflict-free assignment since the last rephasing (2 if unassigned there).
+    vec<char>           best_phase;         // The polarity of each variable in the largest conflict-free assignment since the last rephasing to it (2 if unassigned there).
     vec<char>           decision;           // Declares if a variable is eligible for selection in the decision heuristic.
     vec<int>            flipped;            // Which trail_lim decisions have been flipped in this context.
     vec<Lit>            trail;              // Assignment stack; stores all assigments made in the order they were made.
@@ -385,10 +451,19 @@ protected:
     vec<Lit>            analyze_stack;
     vec<Lit>            analyze_toclear;
     vec<Lit>            add_tmp;
+    vec<uint64_t>       lbd_stamp;          // 'computeLBD()': the last computation that met each decision level.
+    uint64_t            lbd_stamp_counter;
+    vec<Lit>            cancel_kept;        // 'cancelUntil()': the literals assigned out of order below the target level.
 
     double              max_learnts;
     double              learntsize_adjust_confl;
     int                 learntsize_adjust_cnt;
+    uint64_t            next_inprocess;     // The number of conflicts at which to inprocess next.
+    uint64_t            inprocess_props;    // The number of propagations at the end of the last inprocessing.
+    int                 probe_next;         // The variable to probe first in the next inprocessing.
+    int                 target_assigned;    // The size of the assignment of 'target_phase'.
+    int                 best_assigned;      // The size of the assignment of 'best_phase'.
+    uint64_t            next_rephase;       // The number of conflicts at which to rephase next.
 
     // Resource contraints:
     //
@@ -402,6 +477,7 @@ protected:
     Lit      pickBranchLit    ();                                                      // Return the next decision variable.
     void     newDecisionLevel ();                                                      // Begins a new decision level.
     void     uncheckedEnqueue (Lit p, CRef from = CRef_Undef);                         // Enqueue a literal. Assumes value of literal is undefined.
+    void     uncheckedEnqueue (Lit p, CRef from, int level);                           // Enqueue a literal at a level at most the current one.
     bool     enqueue          (Lit p, CRef from = CRef_Undef);                         // Test if fact 'p' contradicts current state, enqueue otherwise.
     bool     theoryConflict;                                                           // Was the last conflict a theory conflict
     CRef     propagate        (TheoryCheckType type);                                  // Perform Boolean and Theory. Returns possibly conflicting clause.
@@ -411,13 +487,28 @@ protected:
     CRef     updateLemmas     ();                                                      // Add the lemmas, backtraking if necessary and return a conflict if there is one
     void     cancelUntil      (int level);                                             // Backtrack until a certain level.
     int      analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
+    int      conflictLevel    (CRef confl, bool& single);                              // Watch the two highest literals of a conflict, return the highest level.
     void     analyzeFinal     (Lit p, vec<Lit>& out_conflict);                         // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()') - true if p is redundant
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
+    void     countTiers       ();                                                      // Count the removable clauses of each tier.
+    bool     tiersCounted     () const;                                                // Check the counts of the tiers (for assertions).
+    void     reduceLemmas     ();                                                      // Evict the least active half of the local removable theory lemmas.
+    void     setTier          (Clause& c, int tier);                                   // Move a removable clause to a tier, and count it.
+    void     updateLBD        (Clause& c);                                             // Update the LBD of a removable clause met in a conflict, promoting it.
+    template<class Lits>
+    int      computeLBD       (const Lits& lits);                                      // The number of decision levels of the literals.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
+    virtual bool inprocess    ();                                                      // Simplify the clauses at level 0. Returns FALSE if they are found unsatisfiable.
+    bool     probe            (uint64_t limit);                                        // Assert the negation of the failed literals, until 'limit' propagations.
+    bool     subsumeRemovable (uint64_t limit);                                        // Remove or strengthen the subsumed removable clauses, in at most 'limit' steps.
+    bool     vivify           (uint64_t limit);                                        // Shorten the core and mid-tier removable clauses, until 'limit' propagations.
+    bool     replaceRemovable (CRef& cr, const vec<Lit>& lits, int level);             // Replace a detached removable clause by a shorter one.
     void     rebuildOrderHeap ();
+    void     updatePhases     (int consistent);                                        // Record the phases of the first 'consistent' literals of the trail if it is the largest conflict-free assignment.
+    void     rephase          ();                                                      // Reset the saved polarities to the best, flipped or random ones.
 
     // Maintaining Variable/Clause activity:
     //
@@ -493,6 +584,8 @@ inline bool Solver::isPropagatedBy(Var x, const Clause& c) const
          && ca.lea(vardata[var(c[0])].d_reason) == &c;
 }
 
+inline double Solver::getActivity(Var x) const { return activity[x]; }
+
 inline bool Solver::isDecision(Var x) const
 {
   Debug("minisat") << "var " << x << " is a decision iff "
@@ -557,6 +650,7 @@ inline void Solver::checkGarbage(double gf){
 
 // NOTE: enqueue does not set the ok flag! (only public methods do)
 inline bool     Solver::enqueue         (Lit p, CRef from)      { return value(p) != l_Undef ? value(p) != l_False : (uncheckedEnqueue(p, from), true); }
+inline void     Solver::uncheckedEnqueue(Lit p, CRef from)      { uncheckedEnqueue(p, from, decisionLevel()); }
 inline bool     Solver::addClause       (const vec<Lit>& ps, bool removable, ClauseId& id)
                                                                 { ps.copyTo(add_tmp); return addClause_(add_tmp, removable, id); }
 inline bool     Solver::addEmptyClause  (bool removable)        { add_tmp.clear(); ClauseId tmp; return addClause_(add_tmp, removable, tmp); }
@@ -567,6 +661,21 @@ inline bool     Solver::addClause       (Lit p, Lit q, bool removable, ClauseId&
 inline bool     Solver::addClause       (Lit p, Lit q, Lit r, bool removable, ClauseId& id)
                                                                 { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addClause_(add_tmp, removable, id); }
 inline bool     Solver::locked          (const Clause& c) const { return value(c[0]) == l_True && isPropagatedBy(var(c[0]), c); }
+
+template<class Lits>
+inline int Solver::computeLBD(const Lits& lits)
+{
+    if (lbd_stamp.size() <= decisionLevel())
+        lbd_stamp.growTo(decisionLevel() + 1, 0);
+    lbd_stamp_counter++;
+    int lbd = 0;
+    for (int i = 0; i < lits.size(); i++){
+        int l = level(var(lits[i]));
+        if (lbd_stamp[l] != lbd_stamp_counter){
+            lbd_stamp[l] = lbd_stamp_counter;
+            lbd++; } }
+    return lbd;
+}
 inline void Solver::newDecisionLevel()
 {
   trail_lim.push(trail.size());
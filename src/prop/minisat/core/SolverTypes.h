@@ -192,8 +192,14 @@ class Clause {
         unsigned removable : 1;
         unsigned has_extra : 1;
         unsigned reloced   : 1;
-        unsigned size      : 27;
-        unsigned level     : 32; }                            header;
+        unsigned imported  : 1;
+        unsigned vivified  : 1;
+        unsigned size      : 25;
+        unsigned level     : 22;
+        unsigned lbd       : 6;
+        unsigned tier      : 2;
+        unsigned used      : 1;
+        unsigned lemma     : 1; }                             header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -205,8 +211,15 @@ class Clause {
         header.removable = removable;
         header.has_extra = use_extra;
         header.reloced   = 0;
+        header.imported  = 0;
+        header.vivified  = 0;
         header.size      = ps.size();
         header.level     = level;
+        header.lbd       = MAX_LBD;
+        header.tier      = TIER_LOCAL;
+        header.used      = 0;
+        header.lemma     = 0;
+        assert(header.level == (unsigned)level);
 
         for (int i = 0; i < ps.size(); i++) 
             data[i].lit = ps[i];
@@ -219,6 +232,13 @@ class Clause {
     }
 
 public:
+    // The tiers of the removable clauses: the core clauses are kept, the
+    // mid-tier ones as long as they are used, and the local ones compete on
+    // their activity (see Solver::reduceDB())
+    enum { TIER_CORE = 0, TIER_MID = 1, TIER_LOCAL = 2 };
+    // The largest LBD recorded, that of the clauses whose LBD is unknown
+    enum { MAX_LBD = 63 };
+
     void calcAbstraction() {
         assert(header.has_extra);
         uint32_t abstraction = 0;
@@ -235,7 +255,25 @@ public:
     bool         has_extra   ()      const   { return header.has_extra; }
     uint32_t     mark        ()      const   { return header.mark; }
     void         mark        (uint32_t m)    { header.mark = m; }
+    // Imported from another solver, and not used in a conflict yet
+    bool         imported    ()      const   { return header.imported; }
+    void         imported    (bool b)        { header.imported = b; }
+    // Vivified already (see Solver::vivify())
+    bool         vivified    ()      const   { return header.vivified; }
+    void         vivified    (bool b)        { header.vivified = b; }
     const Lit&   last        ()      const   { return data[header.size-1].lit; }
+    // Literal block distance: the number of decision levels of the literals
+    // when the clause was learned, or last met in a conflict
+    int          lbd         ()      const   { return header.lbd; }
+    void         lbd         (int l)         { header.lbd = l < MAX_LBD ? l : MAX_LBD; }
+    int          tier        ()      const   { return header.tier; }
+    void         tier        (int t)         { header.tier = t; }
+    // Met in a conflict since the last reduction of the clause database
+    bool         used        ()      const   { return header.used; }
+    void         used        (bool b)        { header.used = b; }
+    // A removable theory lemma (see Solver::updateLemmas())
+    bool         lemma       ()      const   { return header.lemma; }
+    void         lemma       (bool b)        { header.lemma = b; }
 
     bool         reloced     ()      const   { return header.reloced; }
     CRef         relocation  ()      const   { return data[0].rel; }
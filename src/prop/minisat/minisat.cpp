@@ -142,6 +142,19 @@ void MinisatSatSolver::setupOptions() {
   d_minisat->clause_decay = options::satClauseDecay();
   d_minisat->restart_first = options::satRestartFirst();
   d_minisat->restart_inc = options::satRestartInc();
+  d_minisat->tier_core_lbd = options::satTierCoreLbd();
+  d_minisat->tier_mid_lbd = options::satTierMidLbd();
+  d_minisat->chrono_backtrack = options::satChronoBacktrack();
+  d_minisat->chrono_distance = options::satChronoDistance();
+  d_minisat->chrono_conflicts = options::satChronoConflicts();
+  d_minisat->inprocessing = options::satInprocess();
+  d_minisat->inprocess_interval = options::satInprocessInterval();
+  d_minisat->inprocess_effort = options::satInprocessEffort();
+  d_minisat->target_phases = options::satTargetPhase();
+  d_minisat->rephasing = options::satRephase();
+  d_minisat->rephase_interval = options::satRephaseInterval();
+  d_minisat->lemma_dedup = options::lemmaDedup();
+  d_minisat->lemma_limit = options::lemmaDbLimit();
 }
 
 ClauseId MinisatSatSolver::addClause(SatClause& clause, bool removable) {
@@ -172,7 +185,12 @@ SatValue MinisatSatSolver::solve(unsigned long& resource) {
   }
   Minisat::vec<Minisat::Lit> empty;
   unsigned long conflictsBefore = d_minisat->conflicts + d_minisat->resources_consumed;
-  SatValue result = toSatLiteralValue(d_minisat->solveLimited(empty));
+  SatValue result;
+  {
+    TimerStat::CodeTimer codeTimer(d_statistics.d_statSearchTime);
+    result = toSatLiteralValue(d_minisat->solveLimited(empty));
+  }
+  d_statistics.updatePropagationRate(d_minisat->propagations);
   d_minisat->clearInterrupt();
   resource = d_minisat->conflicts + d_minisat->resources_consumed - conflictsBefore;
   Trace("limit") << "SatSolver::solve(): it took " << resource << " conflicts" << std::endl;
@@ -182,7 +200,16 @@ SatValue MinisatSatSolver::solve(unsigned long& resource) {
 SatValue MinisatSatSolver::solve() {
   setupOptions();
   d_minisat->budgetOff();
-  return toSatLiteralValue(d_minisat->solve());
+  // an interrupt of an earlier call (e.g. the probe of cube and conquer, or
+  // a portfolio loser) must not stop this one
+  d_minisat->clearInterrupt();
+  SatValue result;
+  {
+    TimerStat::CodeTimer codeTimer(d_statistics.d_statSearchTime);
+    result = toSatLiteralValue(d_minisat->solve());
+  }
+  d_statistics.updatePropagationRate(d_minisat->propagations);
+  return result;
 }
 
 bool MinisatSatSolver::ok() const {
@@ -202,7 +229,7 @@ SatValue MinisatSatSolver::modelValue(SatLiteral l){
 }
 
 bool MinisatSatSolver::properExplanation(SatLiteral lit, SatLiteral expl) const {
-  return true;
+  return d_minisat->properExplanation(toMinisatLit(lit), toMinisatLit(expl));
 }
 
 void MinisatSatSolver::requirePhase(SatLiteral lit) {
@@ -216,6 +243,11 @@ bool MinisatSatSolver::isDecision(SatVariable decn) const {
   return d_minisat->isDecision( decn );
 }
 
+double MinisatSatSolver::getActivity(SatVariable var) const
+{
+  return d_minisat->getActivity(var);
+}
+
 /** Incremental interface */
 
 unsigned MinisatSatSolver::getAssertionLevel() const {
@@ -244,7 +276,30 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
     d_statClausesLiterals("sat::clauses_literals"),
     d_statLearntsLiterals("sat::learnts_literals"),
     d_statMaxLiterals("sat::max_literals"),
-    d_statTotLiterals("sat::tot_literals")
+    d_statTotLiterals("sat::tot_literals"),
+    d_statLearntsCore("sat::learnts_core"),
+    d_statLearntsMid("sat::learnts_mid"),
+    d_statLearntsLocal("sat::learnts_local"),
+    d_statReductions("sat::reductions"),
+    d_statTierPromotions("sat::tier_promotions"),
+    d_statTierDemotions("sat::tier_demotions"),
+    d_statChronoBacktracks("sat::chrono_backtracks"),
+    d_statNonChronoBacktracks("sat::nonchrono_backtracks"),
+    d_statInprocessings("sat::inprocessings"),
+    d_statFailedLiterals("sat::failed_literals"),
+    d_statSubsumedClauses("sat::subsumed_clauses"),
+    d_statStrengthenedClauses("sat::strengthened_clauses"),
+    d_statVivifiedClauses("sat::vivified_clauses"),
+    d_statVivifiedLiterals("sat::vivified_literals"),
+    d_statTheoryLemmas("sat::theory_lemmas"),
+    d_statDuplicateLemmas("sat::duplicate_lemmas"),
+    d_statEvictedLemmas("sat::evicted_lemmas"),
+    d_statRephases("sat::rephases"),
+    d_statRephasesBest("sat::rephases_best"),
+    d_statRephasesFlipped("sat::rephases_flipped"),
+    d_statRephasesRandom("sat::rephases_random"),
+    d_statPropagationRate("sat::propagations_per_second", 0),
+    d_statSearchTime("sat::search_time")
 {
   d_registry->registerStat(&d_statStarts);
   d_registry->registerStat(&d_statDecisions);
@@ -255,6 +310,29 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
   d_registry->registerStat(&d_statLearntsLiterals);
   d_registry->registerStat(&d_statMaxLiterals);
   d_registry->registerStat(&d_statTotLiterals);
+  d_registry->registerStat(&d_statLearntsCore);
+  d_registry->registerStat(&d_statLearntsMid);
+  d_registry->registerStat(&d_statLearntsLocal);
+  d_registry->registerStat(&d_statReductions);
+  d_registry->registerStat(&d_statTierPromotions);
+  d_registry->registerStat(&d_statTierDemotions);
+  d_registry->registerStat(&d_statChronoBacktracks);
+  d_registry->registerStat(&d_statNonChronoBacktracks);
+  d_registry->registerStat(&d_statInprocessings);
+  d_registry->registerStat(&d_statFailedLiterals);
+  d_registry->registerStat(&d_statSubsumedClauses);
+  d_registry->registerStat(&d_statStrengthenedClauses);
+  d_registry->registerStat(&d_statVivifiedClauses);
+  d_registry->registerStat(&d_statVivifiedLiterals);
+  d_registry->registerStat(&d_statTheoryLemmas);
+  d_registry->registerStat(&d_statDuplicateLemmas);
+  d_registry->registerStat(&d_statEvictedLemmas);
+  d_registry->registerStat(&d_statRephases);
+  d_registry->registerStat(&d_statRephasesBest);
+  d_registry->registerStat(&d_statRephasesFlipped);
+  d_registry->registerStat(&d_statRephasesRandom);
+  d_registry->registerStat(&d_statPropagationRate);
+  d_registry->registerStat(&d_statSearchTime);
 }
 
 MinisatSatSolver::Statistics::~Statistics() {
@@ -267,6 +345,29 @@ MinisatSatSolver::Statistics::~Statistics() {
   d_registry->unregisterStat(&d_statLearntsLiterals);
   d_registry->unregisterStat(&d_statMaxLiterals);
   d_registry->unregisterStat(&d_statTotLiterals);
+  d_registry->unregisterStat(&d_statLearntsCore);
+  d_registry->unregisterStat(&d_statLearntsMid);
+  d_registry->unregisterStat(&d_statLearntsLocal);
+  d_registry->unregisterStat(&d_statReductions);
+  d_registry->unregisterStat(&d_statTierPromotions);
+  d_registry->unregisterStat(&d_statTierDemotions);
+  d_registry->unregisterStat(&d_statChronoBacktracks);
+  d_registry->unregisterStat(&d_statNonChronoBacktracks);
+  d_registry->unregisterStat(&d_statInprocessings);
+  d_registry->unregisterStat(&d_statFailedLiterals);
+  d_registry->unregisterStat(&d_statSubsumedClauses);
+  d_registry->unregisterStat(&d_statStrengthenedClauses);
+  d_registry->unregisterStat(&d_statVivifiedClauses);
+  d_registry->unregisterStat(&d_statVivifiedLiterals);
+  d_registry->unregisterStat(&d_statTheoryLemmas);
+  d_registry->unregisterStat(&d_statDuplicateLemmas);
+  d_registry->unregisterStat(&d_statEvictedLemmas);
+  d_registry->unregisterStat(&d_statRephases);
+  d_registry->unregisterStat(&d_statRephasesBest);
+  d_registry->unregisterStat(&d_statRephasesFlipped);
+  d_registry->unregisterStat(&d_statRephasesRandom);
+  d_registry->unregisterStat(&d_statPropagationRate);
+  d_registry->unregisterStat(&d_statSearchTime);
 }
 
 void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
@@ -279,6 +380,37 @@ void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
   d_statLearntsLiterals.setData(d_minisat->learnts_literals);
   d_statMaxLiterals.setData(d_minisat->max_literals);
   d_statTotLiterals.setData(d_minisat->tot_literals);
+  d_statLearntsCore.setData(d_minisat->learnts_core);
+  d_statLearntsMid.setData(d_minisat->learnts_mid);
+  d_statLearntsLocal.setData(d_minisat->learnts_local);
+  d_statReductions.setData(d_minisat->reductions);
+  d_statTierPromotions.setData(d_minisat->tier_promotions);
+  d_statTierDemotions.setData(d_minisat->tier_demotions);
+  d_statChronoBacktracks.setData(d_minisat->chrono_backtracks);
+  d_statNonChronoBacktracks.setData(d_minisat->nonchrono_backtracks);
+  d_statInprocessings.setData(d_minisat->inprocessings);
+  d_statFailedLiterals.setData(d_minisat->failed_literals);
+  d_statSubsumedClauses.setData(d_minisat->subsumed_clauses);
+  d_statStrengthenedClauses.setData(d_minisat->strengthened_clauses);
+  d_statVivifiedClauses.setData(d_minisat->vivified_clauses);
+  d_statVivifiedLiterals.setData(d_minisat->vivified_literals);
+  d_statTheoryLemmas.setData(d_minisat->theory_lemmas);
+  d_statDuplicateLemmas.setData(d_minisat->duplicate_lemmas);
+  d_statEvictedLemmas.setData(d_minisat->evicted_lemmas);
+  d_statRephases.setData(d_minisat->rephases);
+  d_statRephasesBest.setData(d_minisat->rephases_best);
+  d_statRephasesFlipped.setData(d_minisat->rephases_flipped);
+  d_statRephasesRandom.setData(d_minisat->rephases_random);
+}
+
+void MinisatSatSolver::Statistics::updatePropagationRate(uint64_t propagations)
+{
+  timespec time = d_statSearchTime.getData();
+  double seconds = time.tv_sec + time.tv_nsec / 1e9;
+  if (seconds > 0)
+  {
+    d_statPropagationRate.setData(propagations / seconds);
+  }
 }
 
 } /* namespace CVC4::prop */
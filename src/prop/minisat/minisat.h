@@ -79,6 +79,8 @@ public:
 
   bool isDecision(SatVariable decn) const override;
 
+  double getActivity(SatVariable var) const override;
+
  private:
 
   /** The SatSolver used */
@@ -97,10 +99,26 @@ public:
     ReferenceStat<uint64_t> d_statConflicts, d_statClausesLiterals;
     ReferenceStat<uint64_t> d_statLearntsLiterals,  d_statMaxLiterals;
     ReferenceStat<uint64_t> d_statTotLiterals;
+    ReferenceStat<uint64_t> d_statLearntsCore, d_statLearntsMid;
+    ReferenceStat<uint64_t> d_statLearntsLocal, d_statReductions;
+    ReferenceStat<uint64_t> d_statTierPromotions, d_statTierDemotions;
+    ReferenceStat<uint64_t> d_statChronoBacktracks, d_statNonChronoBacktracks;
+    ReferenceStat<uint64_t> d_statInprocessings, d_statFailedLiterals;
+    ReferenceStat<uint64_t> d_statSubsumedClauses, d_statStrengthenedClauses;
+    ReferenceStat<uint64_t> d_statVivifiedClauses, d_statVivifiedLiterals;
+    ReferenceStat<uint64_t> d_statTheoryLemmas, d_statDuplicateLemmas;
+    ReferenceStat<uint64_t> d_statEvictedLemmas, d_statRephases;
+    ReferenceStat<uint64_t> d_statRephasesBest, d_statRephasesFlipped;
+    ReferenceStat<uint64_t> d_statRephasesRandom;
+    BackedStat<double> d_statPropagationRate;
   public:
+    /** The time spent in the searches */
+    TimerStat d_statSearchTime;
     Statistics(StatisticsRegistry* registry);
     ~Statistics();
     void init(Minisat::SimpSolver* d_minisat);
+    /** Update the number of propagations per second of search */
+    void updatePropagationRate(uint64_t propagations);
   };/* class MinisatSatSolver::Statistics */
   Statistics d_statistics;
 
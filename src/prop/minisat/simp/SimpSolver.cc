@@ -64,6 +64,7 @@ SimpSolver::SimpSolver(CVC4::prop::TheoryProxy* proxy, CVC4::context::Context* c
   , use_simplification (!enableIncremental && !PROOF_ON()) // TODO: turn off simplifications if proofs are on initially
   , occurs             (ClauseDeleted(ca))
   , elim_heap          (ElimLt(n_occ))
+  , elim_seen          (0)
   , bwdsub_assigns     (0)
   , n_touched          (0)
 {
@@ -82,6 +83,7 @@ SimpSolver::SimpSolver(CVC4::prop::TheoryProxy* proxy, CVC4::context::Context* c
     for (int i = frozen.size(); i < vardata.size(); ++ i) {
       frozen    .push(1);
       eliminated.push(0);
+      elimstore_start.push(-1);
       if (use_simplification){
           n_occ     .push(0);
           n_occ     .push(0);
@@ -104,6 +106,7 @@ Var SimpSolver::newVar(bool sign, bool dvar, bool isTheoryAtom, bool preRegister
     if (use_simplification){
         frozen    .push((char)(!canErase));
         eliminated.push((char)false);
+        elimstore_start.push(-1);
         n_occ     .push(0);
         n_occ     .push(0);
         occurs    .init(v);
@@ -164,12 +167,12 @@ lbool SimpSolver::solve_(bool do_simp, bool turn_off_simp)
 
 bool SimpSolver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
 {
-#ifndef NDEBUG
+    // A lemma can mention a variable eliminated since it was introduced:
     if (use_simplification) {
       for (int i = 0; i < ps.size(); i++)
-        assert(!isEliminated(var(ps[i])));
+        if (isEliminated(var(ps[i])) && !reintroduce(var(ps[i])))
+          return false;
     }
-#endif
 
     int nclauses = clauses_persistent.size();
 
@@ -542,6 +545,15 @@ bool SimpSolver::eliminateVar(Var v)
     setDecisionVar(v, false);
     eliminated_vars++;
 
+    elimstore_start[v] = elimstore.size();
+    elimstore.push(cls.size());
+    for (int i = 0; i < cls.size(); i++){
+        const Clause& c = ca[cls[i]];
+        elimstore.push(c.size());
+        for (int j = 0; j < c.size(); j++)
+            elimstore.push(toInt(c[j]));
+    }
+
     if (pos.size() > neg.size()){
         for (int i = 0; i < neg.size(); i++)
             mkElimClause(elimclauses, v, ca[neg[i]]);
@@ -578,6 +590,31 @@ bool SimpSolver::eliminateVar(Var v)
 }
 
 
+// Bring back an eliminated variable, with the clauses it was eliminated from. The resolvents stay,
+// and the variable is frozen from then on, so that 'extendModel()' can skip its clauses.
+bool SimpSolver::reintroduce(Var v)
+{
+    assert(isEliminated(v));
+    eliminated[v] = false;
+    frozen[v]     = true;
+    setDecisionVar(v, true);
+
+    int i = elimstore_start[v];
+    if (i < 0)
+        return true;
+    vec<Lit> clause;
+    for (int n = elimstore[i++]; n > 0; n--){
+        clause.clear();
+        for (int size = elimstore[i++]; size > 0; size--)
+            clause.push(toLit(elimstore[i++]));
+        ClauseId id = ClauseIdUndef;
+        if (!addClause_(clause, false, id))
+            return false;
+    }
+    return true;
+}
+
+
 bool SimpSolver::substitute(Var v, Lit x)
 {
     assert(!frozen[v]);
@@ -617,6 +654,11 @@ void SimpSolver::extendModel()
     Lit x;
 
     for (i = elimclauses.size()-1; i > 0; i -= j){
+        // Skip the clauses of the variables brought back:
+        if (!isEliminated(var(toLit(elimclauses[i - elimclauses[i]])))){
+            j = elimclauses[i] + 1;
+            continue; }
+
         for (j = elimclauses[i--]; j > 1; j--, i--)
             if (modelValue(toLit(elimclauses[i])) != l_False)
                 goto next;
@@ -703,6 +745,7 @@ bool SimpSolver::eliminate(bool turn_off_elim)
         // Cheaper cleanup:
         cleanUpClauses(); // TODO: can we make 'cleanUpClauses()' not be linear in the problem size somehow?
         checkGarbage();
+        elim_seen = clauses_persistent.size();
     }
 
     if (verbosity >= 1 && elimclauses.size() > 0)
@@ -713,6 +756,57 @@ bool SimpSolver::eliminate(bool turn_off_elim)
 }
 
 
+// Besides the simplifications of 'Solver::inprocess()', eliminate the variables again, in the
+// persistent clauses (the theory atoms are frozen, see 'newVar()'). This only happens when the
+// elimination is on, that is in non-incremental mode with --minisat-elimination; otherwise, the
+// persistent clauses are not simplified. The occurrence lists miss the lemmas of the search: they
+// are rebuilt, and the variables of the clauses added since the last elimination are the
+// candidates.
+bool SimpSolver::inprocess()
+{
+    if (!Solver::inprocess())
+        return false;
+    if (!use_simplification || !use_elim)
+        return true;
+
+    occurs.cleanAll();
+    elim_heap.clear();
+    subsumption_queue.clear();
+    for (Var v = 0; v < nVars(); v++){
+        occurs[v].clear();
+        n_occ[toInt(mkLit(v))]  = 0;
+        n_occ[toInt(~mkLit(v))] = 0;
+        touched[v] = 0;
+    }
+    n_touched = 0;
+    for (int i = 0; i < clauses_persistent.size(); i++){
+        CRef          cr = clauses_persistent[i];
+        const Clause& c  = ca[cr];
+        if (c.mark() != 0)
+            continue;
+        if (i >= elim_seen)
+            subsumption_queue.insert(cr);
+        for (int k = 0; k < c.size(); k++){
+            occurs[var(c[k])].push(cr);
+            n_occ[toInt(c[k])]++;
+            if (i >= elim_seen && !touched[var(c[k])]){
+                touched[var(c[k])] = 1;
+                n_touched++; }
+        }
+    }
+    for (Var v = 0; v < nVars(); v++)
+        if (touched[v])
+            updateElimHeap(v);
+
+    // The resolvents are added at level 0 directly, not as lemmas:
+    bool busy    = minisat_busy;
+    minisat_busy = false;
+    bool result  = eliminate(false);
+    minisat_busy = busy;
+    return result;
+}
+
+
 void SimpSolver::cleanUpClauses()
 {
     occurs.cleanAll();
@@ -143,6 +143,9 @@ class SimpSolver : public Solver {
     Queue<CRef>         subsumption_queue;
     vec<char>           frozen;
     vec<char>           eliminated;
+    vec<uint32_t>       elimstore;          // All the clauses of the eliminated variables (see 'reintroduce()').
+    vec<int>            elimstore_start;    // Where the clauses of each eliminated variable start in 'elimstore'.
+    int                 elim_seen;          // The persistent clauses before this index went through an elimination.
     int                 bwdsub_assigns;
     int                 n_touched;
 
@@ -161,6 +164,8 @@ class SimpSolver : public Solver {
     bool          merge                    (const Clause& _ps, const Clause& _qs, Var v, int& size);
     bool          backwardSubsumptionCheck (bool verbose = false);
     bool          eliminateVar             (Var v);
+    bool          reintroduce              (Var v);
+    bool          inprocess                () override;
     void          extendModel              ();
 
     void          removeClause             (CRef cr);
@@ -16,6 +16,7 @@
 
 #include "prop/prop_engine.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <map>
 #include <utility>
@@ -24,10 +25,12 @@
 #include "base/output.h"
 #include "decision/decision_engine.h"
 #include "expr/expr.h"
+#include "expr/node_algorithm.h"
 #include "options/base_options.h"
 #include "options/decision_options.h"
 #include "options/main_options.h"
 #include "options/options.h"
+#include "options/prop_options.h"
 #include "options/smt_options.h"
 #include "proof/proof_manager.h"
 #include "prop/cnf_stream.h"
@@ -60,11 +63,11 @@ class ScopedBool {
 private:
 
   bool d_original;
-  bool& d_reference;
+  std::atomic<bool>& d_reference;
 
 public:
 
-  ScopedBool(bool& reference) :
+  ScopedBool(std::atomic<bool>& reference) :
     d_reference(reference) {
     d_original = reference;
   }
@@ -74,6 +77,23 @@ public:
   }
 };
 
+/** Is n built by a Boolean connective, rather than an atom? */
+static bool isBooleanConnective(TNode n)
+{
+  switch (n.getKind())
+  {
+    case kind::NOT:
+    case kind::AND:
+    case kind::OR:
+    case kind::XOR:
+    case kind::IMPLIES:
+    case kind::CONST_BOOLEAN: return true;
+    case kind::ITE:
+    case kind::EQUAL: return n[0].getType().isBoolean();
+    default: return false;
+  }
+}
+
 PropEngine::PropEngine(TheoryEngine* te,
                        Context* satContext,
                        UserContext* userContext,
@@ -95,16 +115,30 @@ PropEngine::PropEngine(TheoryEngine* te,
   d_decisionEngine.reset(new DecisionEngine(satContext, userContext));
   d_decisionEngine->init();  // enable appropriate strategies
 
-  d_satSolver = SatSolverFactory::createDPLLMinisat(smtStatisticsRegistry());
+  if (options::satSolver() == options::MainSatSolverMode::CADICAL)
+  {
+    d_satSolver = SatSolverFactory::createDPLLCadical(smtStatisticsRegistry());
+  }
+  else
+  {
+    d_satSolver = SatSolverFactory::createDPLLMinisat(smtStatisticsRegistry());
+  }
 
   d_registrar = new theory::TheoryRegistrar(d_theoryEngine);
-  d_cnfStream = new CVC4::prop::TseitinCnfStream(
-      d_satSolver, d_registrar, userContext, true);
+  d_cnfStream = new CVC4::prop::TseitinCnfStream(d_satSolver,
+                                                 d_registrar,
+                                                 userContext,
+                                                 true,
+                                                 "",
+                                                 smtStatisticsRegistry(),
+                                                 options::cnfPolarity(),
+                                                 options::cnfGateHashing());
 
   d_theoryProxy = new TheoryProxy(this,
                                   d_theoryEngine,
                                   d_decisionEngine.get(),
                                   d_context,
+                                  userContext,
                                   d_cnfStream,
                                   replayLog,
                                   replayStream);
@@ -271,6 +305,50 @@ void PropEngine::getBooleanVariables(std::vector<TNode>& outputVariables) const
   d_cnfStream->getBooleanVariables(outputVariables);
 }
 
+void PropEngine::getActiveAtoms(size_t n, std::vector<Node>& atoms) const
+{
+  std::vector<std::pair<double, Node>> candidates;
+  for (const CnfStream::NodeToLiteralMap::value_type& t :
+       d_cnfStream->getTranslationCache())
+  {
+    if (isBooleanConnective(t.first) || t.second.isNegated()
+        || d_satSolver->value(t.second) != SAT_VALUE_UNKNOWN)
+    {
+      continue;
+    }
+    candidates.emplace_back(
+        d_satSolver->getActivity(t.second.getSatVariable()), t.first);
+  }
+  // break the ties by node id, the translation cache is unordered
+  std::sort(candidates.begin(),
+            candidates.end(),
+            [](const std::pair<double, Node>& a,
+               const std::pair<double, Node>& b) {
+              return a.first > b.first
+                     || (a.first == b.first
+                         && a.second.getId() < b.second.getId());
+            });
+  for (const std::pair<double, Node>& c : candidates)
+  {
+    if (atoms.size() == n)
+    {
+      break;
+    }
+    if (!expr::hasSubtermKind(kind::SKOLEM, c.second))
+    {
+      atoms.push_back(c.second);
+    }
+  }
+}
+
+void PropEngine::shareClauses(ClauseExchange* exchange,
+                              size_t instance,
+                              const std::vector<Node>& symbols)
+{
+  Assert(!d_inCheckSat) << "Sat solver in solve()!";
+  d_theoryProxy->shareClauses(exchange, instance, symbols);
+}
+
 void PropEngine::ensureLiteral(TNode n) {
   d_cnfStream->ensureLiteral(n);
 }
@@ -22,6 +22,7 @@
 #define CVC4__PROP_ENGINE_H
 
 #include <sys/time.h>
+#include <atomic>
 
 #include "base/modal_exception.h"
 #include "expr/expr_stream.h"
@@ -45,6 +46,7 @@ namespace theory {
 
 namespace prop {
 
+class ClauseExchange;
 class CnfStream;
 class DPLLSatSolverInterface;
 
@@ -157,6 +159,23 @@ class PropEngine
    */
   void getBooleanVariables(std::vector<TNode>& outputVariables) const;
 
+  /**
+   * Get the (at most) n theory atoms and Boolean variables of highest
+   * activity in the SAT solver, most active first.  Atoms that are assigned
+   * at the current level or contain skolems are skipped.  Used to pick the
+   * splitting atoms of cube-and-conquer.
+   */
+  void getActiveAtoms(size_t n, std::vector<Node>& atoms) const;
+
+  /**
+   * Share the short learned clauses of the SAT solver with the other
+   * instances of exchange, as the given instance, or stop sharing if
+   * exchange is null.  See TheoryProxy::shareClauses().
+   */
+  void shareClauses(ClauseExchange* exchange,
+                    size_t instance,
+                    const std::vector<Node>& symbols);
+
   /**
    * Ensure that the given node will have a designated SAT literal
    * that is definitionally equal to it.  The result of this function
@@ -221,9 +240,9 @@ class PropEngine
   void printSatisfyingAssignment();
   /**
    * Indicates that the SAT solver is currently solving something and we should
-   * not mess with it's internal state.
+   * not mess with it's internal state.  Read by interrupt(), from any thread.
    */
-  bool d_inCheckSat;
+  std::atomic<bool> d_inCheckSat;
 
   /** The theory engine we will be using */
   TheoryEngine* d_theoryEngine;
@@ -249,8 +268,8 @@ class PropEngine
   /** The CNF converter in use */
   CnfStream* d_cnfStream;
 
-  /** Whether we were just interrupted (or not) */
-  bool d_interrupted;
+  /** Whether we were just interrupted (or not), set from any thread */
+  std::atomic<bool> d_interrupted;
   /** Pointer to resource manager for associated SmtEngine */
   ResourceManager* d_resourceManager;
 
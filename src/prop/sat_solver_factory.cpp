@@ -18,6 +18,7 @@
 
 #include "prop/bvminisat/bvminisat.h"
 #include "prop/cadical.h"
+#include "prop/cadical_dpll.h"
 #include "prop/cryptominisat.h"
 #include "prop/minisat/minisat.h"
 
@@ -38,6 +39,16 @@ DPLLSatSolverInterface* SatSolverFactory::createDPLLMinisat(
   return new MinisatSatSolver(registry);
 }
 
+DPLLSatSolverInterface* SatSolverFactory::createDPLLCadical(
+    StatisticsRegistry* registry)
+{
+#ifdef CVC4_USE_CADICAL_DPLL
+  return new CadicalDPLLSatSolver(registry);
+#else
+  Unreachable() << "CVC4 was not compiled with the CaDiCaL DPLL(T) backend.";
+#endif
+}
+
 SatSolver* SatSolverFactory::createCryptoMinisat(StatisticsRegistry* registry,
                                                  const std::string& name)
 {
@@ -16,10 +16,14 @@
  **/
 #include "prop/theory_proxy.h"
 
+#include <sstream>
+
 #include "context/context.h"
 #include "decision/decision_engine.h"
 #include "expr/expr_stream.h"
 #include "options/decision_options.h"
+#include "options/prop_options.h"
+#include "prop/clause_exchange.h"
 #include "prop/cnf_stream.h"
 #include "prop/prop_engine.h"
 #include "proof/cnf_proof.h"
@@ -29,14 +33,24 @@
 #include "theory/theory_engine.h"
 #include "util/statistics_registry.h"
 
-
 namespace CVC4 {
 namespace prop {
 
+namespace {
+
+/**
+ * The length of the longest atom key: the keys do not share subterms, so
+ * large atoms are not shared.
+ */
+const std::streamoff kMaxKeyLength = 1 << 12;
+
+}  // namespace
+
 TheoryProxy::TheoryProxy(PropEngine* propEngine,
                          TheoryEngine* theoryEngine,
                          DecisionEngine* decisionEngine,
                          context::Context* context,
+                         context::UserContext* userContext,
                          CnfStream* cnfStream,
                          std::ostream* replayLog,
                          ExprStream* replayStream)
@@ -47,14 +61,38 @@ TheoryProxy::TheoryProxy(PropEngine* propEngine,
       d_replayLog(replayLog),
       d_replayStream(replayStream),
       d_queue(context),
-      d_replayedDecisions("prop::theoryproxy::replayedDecisions", 0)
+      d_explanations(userContext),
+      d_exchange(nullptr),
+      d_instance(0),
+      d_numRegistered(userContext, 0),
+      d_replayedDecisions("prop::theoryproxy::replayedDecisions", 0),
+      d_theoryCheckTime("prop::theoryproxy::theoryCheckTime"),
+      d_explanationCacheHits("prop::theoryproxy::explanationCacheHits", 0),
+      d_explanationCacheMisses("prop::theoryproxy::explanationCacheMisses",
+                               0),
+      d_explanationCacheHitRate("prop::theoryproxy::explanationCacheHitRate",
+                                0),
+      d_explanationTime("prop::theoryproxy::explanationTime"),
+      d_explanationTimeSaved("prop::theoryproxy::explanationTimeSaved", 0)
 {
   smtStatisticsRegistry()->registerStat(&d_replayedDecisions);
+  smtStatisticsRegistry()->registerStat(&d_theoryCheckTime);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheHits);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheMisses);
+  smtStatisticsRegistry()->registerStat(&d_explanationCacheHitRate);
+  smtStatisticsRegistry()->registerStat(&d_explanationTime);
+  smtStatisticsRegistry()->registerStat(&d_explanationTimeSaved);
 }
 
 TheoryProxy::~TheoryProxy() {
   /* nothing to do for now */
   smtStatisticsRegistry()->unregisterStat(&d_replayedDecisions);
+  smtStatisticsRegistry()->unregisterStat(&d_theoryCheckTime);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheHits);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheMisses);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationCacheHitRate);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationTime);
+  smtStatisticsRegistry()->unregisterStat(&d_explanationTimeSaved);
 }
 
 void TheoryProxy::variableNotify(SatVariable var) {
@@ -62,6 +100,7 @@ void TheoryProxy::variableNotify(SatVariable var) {
 }
 
 void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
+  TimerStat::CodeTimer codeTimer(d_theoryCheckTime);
   while (!d_queue.empty()) {
     TNode assertion = d_queue.front();
     d_queue.pop();
@@ -74,6 +113,7 @@ void TheoryProxy::theoryPropagate(std::vector<SatLiteral>& output) {
   // Get the propagated literals
   std::vector<TNode> outputNodes;
   d_theoryEngine->getPropagatedLiterals(outputNodes);
+  output.reserve(output.size() + outputNodes.size());
   for (unsigned i = 0, i_end = outputNodes.size(); i < i_end; ++ i) {
     Debug("prop-explain") << "theoryPropagate() => " << outputNodes[i] << std::endl;
     output.push_back(d_cnfStream->getLiteral(outputNodes[i]));
@@ -84,23 +124,55 @@ void TheoryProxy::explainPropagation(SatLiteral l, SatClause& explanation) {
   TNode lNode = d_cnfStream->getNode(l);
   Debug("prop-explain") << "explainPropagation(" << lNode << ")" << std::endl;
 
-  LemmaProofRecipe* proofRecipe = NULL;
-  PROOF(proofRecipe = new LemmaProofRecipe;);
+  Node theoryExplanation;
+  bool useCache = options::explanationCache() && !PROOF_ON();
+  if (useCache)
+  {
+    context::CDHashMap<SatLiteral, Node, SatLiteralHashFunction>::
+        const_iterator it = d_explanations.find(l);
+    if (it != d_explanations.end()
+        && d_propEngine->properExplanation(lNode, (*it).second))
+    {
+      theoryExplanation = (*it).second;
+      ++d_explanationCacheHits;
+    }
+  }
+
+  if (theoryExplanation.isNull())
+  {
+    LemmaProofRecipe* proofRecipe = NULL;
+    PROOF(proofRecipe = new LemmaProofRecipe;);
 
-  Node theoryExplanation = d_theoryEngine->getExplanationAndRecipe(lNode, proofRecipe);
+    {
+      TimerStat::CodeTimer codeTimer(d_explanationTime);
+      theoryExplanation =
+          d_theoryEngine->getExplanationAndRecipe(lNode, proofRecipe);
+    }
 
-  PROOF({
+    PROOF({
       ProofManager::getCnfProof()->pushCurrentAssertion(theoryExplanation);
       ProofManager::getCnfProof()->setProofRecipe(proofRecipe);
 
-      Debug("pf::sat") << "TheoryProxy::explainPropagation: setting lemma recipe to: "
-                       << std::endl;
+      Debug("pf::sat")
+          << "TheoryProxy::explainPropagation: setting lemma recipe to: "
+          << std::endl;
       proofRecipe->dump("pf::sat");
 
       delete proofRecipe;
       proofRecipe = NULL;
     });
 
+    if (useCache)
+    {
+      d_explanations.insert(l, theoryExplanation);
+      ++d_explanationCacheMisses;
+    }
+  }
+  if (useCache)
+  {
+    updateExplanationStats();
+  }
+
   Debug("prop-explain") << "explainPropagation() => " << theoryExplanation << std::endl;
   if (theoryExplanation.getKind() == kind::AND) {
     Node::const_iterator it = theoryExplanation.begin();
@@ -115,6 +187,20 @@ void TheoryProxy::explainPropagation(SatLiteral l, SatClause& explanation) {
   }
 }
 
+void TheoryProxy::updateExplanationStats()
+{
+  int64_t hits = d_explanationCacheHits.getData();
+  int64_t misses = d_explanationCacheMisses.getData();
+  d_explanationCacheHitRate.setData(static_cast<double>(hits)
+                                    / (hits + misses));
+  if (misses > 0)
+  {
+    timespec t = d_explanationTime.getData();
+    double seconds = t.tv_sec + t.tv_nsec / 1e9;
+    d_explanationTimeSaved.setData(seconds * hits / misses);
+  }
+}
+
 void TheoryProxy::enqueueTheoryLiteral(const SatLiteral& l) {
   Node literalNode = d_cnfStream->getNode(l);
   Debug("prop") << "enqueueing theory literal " << l << " " << literalNode << std::endl;
@@ -196,5 +282,179 @@ void TheoryProxy::dumpStatePop() {
   }
 }
 
+void TheoryProxy::shareClauses(ClauseExchange* exchange,
+                               size_t instance,
+                               const std::vector<Node>& symbols)
+{
+  Assert(exchange == nullptr || instance < exchange->getNumInstances());
+  d_exchange = exchange;
+  d_instance = instance;
+  d_symbols.clear();
+  d_atomIds.clear();
+  d_atoms.clear();
+  d_numRegistered = 0;
+  for (size_t i = 0; i < symbols.size(); ++i)
+  {
+    d_symbols[symbols[i]] = i;
+  }
+}
+
+void TheoryProxy::exportClause(const SatClause& clause)
+{
+  Assert(d_exchange != nullptr);
+  if (clause.size() > ClauseExchange::kMaxSize)
+  {
+    return;
+  }
+  ClauseExchange::Clause shared;
+  for (const SatLiteral& lit : clause)
+  {
+    uint32_t id = getAtomId(lit.getSatVariable());
+    if (id == kNoAtom)
+    {
+      return;
+    }
+    shared.push_back(2 * id + (lit.isNegated() ? 1 : 0));
+  }
+  d_exchange->publish(d_instance, shared);
+}
+
+void TheoryProxy::importClauses(std::vector<SatClause>& clauses)
+{
+  Assert(d_exchange != nullptr);
+  std::vector<ClauseExchange::Clause> shared;
+  d_exchange->collect(d_instance, shared);
+  if (shared.empty())
+  {
+    return;
+  }
+  registerAtoms();
+  for (const ClauseExchange::Clause& c : shared)
+  {
+    SatClause clause;
+    for (uint32_t lit : c)
+    {
+      uint32_t id = lit / 2;
+      // the atom may be unknown here, or known but not translated in the
+      // current context
+      if (id >= d_atoms.size() || d_atoms[id].isNull()
+          || !d_cnfStream->hasLiteral(d_atoms[id]))
+      {
+        break;
+      }
+      SatLiteral l = d_cnfStream->getLiteral(d_atoms[id]);
+      clause.push_back(lit % 2 == 0 ? l : ~l);
+    }
+    if (clause.size() == c.size())
+    {
+      Debug("prop::sharing") << "TheoryProxy: importing " << clause
+                             << std::endl;
+      clauses.push_back(clause);
+      d_exchange->notifyImported();
+    }
+  }
+}
+
+void TheoryProxy::notifyImportedClauseUseful()
+{
+  Assert(d_exchange != nullptr);
+  d_exchange->notifyUseful();
+}
+
+uint32_t TheoryProxy::getAtomId(SatVariable var)
+{
+  // only the theory atoms are in the node cache, unless all the literals are
+  const CnfStream::LiteralToNodeMap& nodes = d_cnfStream->getNodeCache();
+  SatLiteral lit(var);
+  return nodes.contains(lit) ? getAtomId(nodes[lit]) : kNoAtom;
+}
+
+uint32_t TheoryProxy::getAtomId(TNode atom)
+{
+  std::unordered_map<Node, uint32_t, NodeHashFunction>::const_iterator it =
+      d_atomIds.find(atom);
+  if (it != d_atomIds.end())
+  {
+    return it->second;
+  }
+  uint32_t id = kNoAtom;
+  std::ostringstream key;
+  if (getAtomKey(atom, key))
+  {
+    id = d_exchange->getAtomId(key.str());
+    if (id >= d_atoms.size())
+    {
+      d_atoms.resize(id + 1);
+    }
+    d_atoms[id] = atom;
+  }
+  d_atomIds[atom] = id;
+  return id;
+}
+
+bool TheoryProxy::getAtomKey(TNode atom, std::ostream& key) const
+{
+  if (atom.isVar())
+  {
+    std::unordered_map<Node, uint32_t, NodeHashFunction>::const_iterator it =
+        d_symbols.find(atom);
+    if (it == d_symbols.end())
+    {
+      return false;
+    }
+    key << 's' << it->second;
+    return true;
+  }
+  key << '(' << static_cast<int>(atom.getKind());
+  if (atom.isConst())
+  {
+    key << ' ' << atom;
+  }
+  else if (atom.getNumChildren() == 0)
+  {
+    key << ' ' << atom.getType();
+  }
+  else if (atom.getMetaKind() == kind::metakind::PARAMETERIZED)
+  {
+    key << ' ';
+    if (!getAtomKey(atom.getOperator(), key))
+    {
+      return false;
+    }
+  }
+  for (TNode child : atom)
+  {
+    key << ' ';
+    if (!getAtomKey(child, key) || key.tellp() > kMaxKeyLength)
+    {
+      return false;
+    }
+  }
+  key << ')';
+  return true;
+}
+
+void TheoryProxy::registerAtoms()
+{
+  const CnfStream::NodeToLiteralMap& cache = d_cnfStream->getTranslationCache();
+  const CnfStream::LiteralToNodeMap& nodes = d_cnfStream->getNodeCache();
+  if (d_numRegistered >= cache.size())
+  {
+    return;
+  }
+  // As in exports, only the atoms in the node cache are shared
+  CnfStream::NodeToLiteralMap::key_iterator it = cache.key_begin();
+  std::advance(it, d_numRegistered.get());
+  for (; it != cache.key_end(); ++it)
+  {
+    TNode atom = *it;
+    if (atom.getKind() != kind::NOT && nodes.contains(cache[atom]))
+    {
+      getAtomId(atom);
+    }
+  }
+  d_numRegistered = cache.size();
+}
+
 }/* CVC4::prop namespace */
 }/* CVC4 namespace */
@@ -24,8 +24,12 @@
 #define CVC4_USE_MINISAT
 
 #include <iosfwd>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "context/cdhashmap.h"
+#include "context/cdo.h"
 #include "context/cdqueue.h"
 #include "expr/expr_stream.h"
 #include "expr/node.h"
@@ -43,6 +47,7 @@ namespace prop {
 
 class PropEngine;
 class CnfStream;
+class ClauseExchange;
 
 /**
  * The proxy class that allows the SatSolver to communicate with the theories
@@ -54,6 +59,7 @@ class TheoryProxy
               TheoryEngine* theoryEngine,
               DecisionEngine* decisionEngine,
               context::Context* context,
+              context::UserContext* userContext,
               CnfStream* cnfStream,
               std::ostream* replayLog,
               ExprStream* replayStream);
@@ -98,7 +104,60 @@ class TheoryProxy
   /** Shorthand for Dump("state") << PopCommand() */
   void dumpStatePop();
 
+  /**
+   * Share the learned clauses with the other instances of exchange, as the
+   * given instance.  The instances must solve the same problem, with the
+   * same options; symbols[i] is the i-th symbol of the problem, which has
+   * the same position in the symbols of every instance.  The clauses with
+   * an atom over other symbols, e.g. skolems, are not shared.
+   */
+  void shareClauses(ClauseExchange* exchange,
+                    size_t instance,
+                    const std::vector<Node>& symbols);
+
+  /** Are the learned clauses shared? */
+  bool isSharingClauses() const { return d_exchange != nullptr; }
+
+  /**
+   * Share a clause learned at user level 0, if all its atoms are shared by
+   * the instances.
+   */
+  void exportClause(const SatClause& clause);
+
+  /**
+   * Get the clauses shared by the other instances since the last call, over
+   * the atoms known to this instance.
+   */
+  void importClauses(std::vector<SatClause>& clauses);
+
+  /** Notify that an imported clause took part in a conflict. */
+  void notifyImportedClauseUseful();
+
  private:
+  /**
+   * The id in d_exchange of the atom of var, or kNoAtom if it is not
+   * shared.
+   */
+  uint32_t getAtomId(SatVariable var);
+  uint32_t getAtomId(TNode atom);
+
+  /**
+   * Write a description of atom to key, that is the same for the copies of
+   * atom in every instance.  Returns false if the atom has a symbol that is
+   * not shared.
+   */
+  bool getAtomKey(TNode atom, std::ostream& key) const;
+
+  /** Register the atoms translated since the last call. */
+  void registerAtoms();
+
+  /** The id of an atom that is not shared */
+  static const uint32_t kNoAtom = static_cast<uint32_t>(-1);
+
+  /** Update the hit rate and the time saved by the explanation cache. */
+  void updateExplanationStats();
+
+
   /** The prop engine we are using. */
   PropEngine* d_propEngine;
 
@@ -120,17 +179,65 @@ class TheoryProxy
   /** Queue of asserted facts */
   context::CDQueue<TNode> d_queue;
 
+  /**
+   * The last explanation of the propagation of each literal, forgotten on
+   * pops of the user context.  It is reused when the literal is propagated
+   * again while its literals are still true, and assigned before it.
+   */
+  context::CDHashMap<SatLiteral, Node, SatLiteralHashFunction> d_explanations;
+
   /**
    * Set of all lemmas that have been "shared" in the portfolio---i.e.,
    * all imported and exported lemmas.
    */
   std::unordered_set<Node, NodeHashFunction> d_shared;
 
+  /** The exchange of learned clauses, if any, and our instance in it */
+  ClauseExchange* d_exchange;
+  size_t d_instance;
+
+  /** The position of each shared symbol */
+  std::unordered_map<Node, uint32_t, NodeHashFunction> d_symbols;
+
+  /** The ids of the atoms seen so far, kNoAtom if not shared */
+  std::unordered_map<Node, uint32_t, NodeHashFunction> d_atomIds;
+
+  /** The atom of each id seen so far, null if unknown */
+  std::vector<Node> d_atoms;
+
+  /**
+   * The number of entries of the translation cache that are registered in
+   * d_atomIds, restored on pops as the cache is.
+   */
+  context::CDO<size_t> d_numRegistered;
+
   /**
    * Statistic: the number of replayed decisions (via --replay).
    */
   IntStat d_replayedDecisions;
 
+  /**
+   * Statistic: the time spent asserting the literals to the theories and
+   * checking them.
+   */
+  TimerStat d_theoryCheckTime;
+
+  /**
+   * Statistics: the propagations explained from the cache, and by the
+   * theories, and the hit rate of the cache.
+   */
+  IntStat d_explanationCacheHits;
+  IntStat d_explanationCacheMisses;
+  BackedStat<double> d_explanationCacheHitRate;
+
+  /**
+   * Statistics: the time spent by the theories explaining propagations, and
+   * an estimate of the time saved by the cache, at the average cost of an
+   * explanation.
+   */
+  TimerStat d_explanationTime;
+  BackedStat<double> d_explanationTimeSaved;
+
 }; /* class SatSolver */
 
 }/* CVC4::prop namespace */
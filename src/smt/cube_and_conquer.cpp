@@ -0,0 +1,531 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Parallel check-sat by cube-and-conquer
+ **
+ ** Parallel check-sat by cube-and-conquer.
+ **/
+
+#include "smt/cube_and_conquer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "base/output.h"
+#include "context/cdlist.h"
+#include "expr/expr_manager.h"
+#include "expr/expr_manager_scope.h"
+#include "expr/kind.h"
+#include "expr/node_algorithm.h"
+#include "expr/variable_type_map.h"
+#include "options/options.h"
+#include "options/prop_options.h"
+#include "options/smt_options.h"
+#include "prop/clause_exchange.h"
+#include "prop/prop_engine.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_statistics_registry.h"
+
+namespace CVC4 {
+
+namespace {
+
+/** The number of atoms beyond --cube-depth kept for splitting cubes again */
+const size_t kSplitAtoms = 16;
+
+/**
+ * How often a solver that must stop is interrupted: a solver that is not in
+ * its SAT search yet ignores an interrupt.
+ */
+const std::chrono::milliseconds kInterruptPeriod(10);
+
+/**
+ * Interrupts a prop engine after the given time, until the timer is
+ * destroyed.
+ */
+class ProbeTimer
+{
+ public:
+  ProbeTimer(prop::PropEngine* propEngine, std::chrono::milliseconds time)
+      : d_done(false), d_thread([this, propEngine, time]() {
+          std::unique_lock<std::mutex> lock(d_mutex);
+          auto done = [this]() { return d_done; };
+          if (d_cond.wait_for(lock, time, done))
+          {
+            return;
+          }
+          do
+          {
+            propEngine->interrupt();
+          } while (!d_cond.wait_for(lock, kInterruptPeriod, done));
+        })
+  {
+  }
+
+  ~ProbeTimer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      d_done = true;
+    }
+    d_cond.notify_one();
+    d_thread.join();
+  }
+
+ private:
+  std::mutex d_mutex;
+  std::condition_variable d_cond;
+  bool d_done;
+  /** Declared last, to start once the other members are constructed */
+  std::thread d_thread;
+}; /* class ProbeTimer */
+
+}  // namespace
+
+struct CubeAndConquer::Worker
+{
+  /**
+   * Fork smt into a new expression manager, and export the atoms there.
+   * Throws an Exception if the assertions or the atoms cannot be exported.
+   */
+  Worker(SmtEngine& smt, const std::vector<Node>& atoms)
+      : d_busy(false), d_split(false)
+  {
+    Options opts;
+    opts.copyValues(smt.getExprManager()->getOptions());
+    {
+      // The workers solve the cubes as assumptions, and must not write to
+      // the files of the SmtEngine
+      Options::OptionsScope scope(&opts);
+      opts.setOption("incremental", "true");
+      opts.setOption("cube-workers", "0");
+      opts.setOption("context-trace", "");
+      opts.setOption("write-dag", "");
+    }
+    d_em.reset(new ExprManager(opts));
+    d_map.reset(new ExprManagerMapCollection());
+    d_smt.reset(smt.fork(d_em.get(), *d_map));
+    std::vector<Expr> exprs;
+    for (const Node& atom : atoms)
+    {
+      // the bit-vector atoms of the eager bit-blaster are wrapped
+      exprs.push_back(atom.getKind() == kind::BITVECTOR_EAGER_ATOM
+                          ? atom[0].toExpr()
+                          : atom.toExpr());
+    }
+    d_atoms = Expr::exportTo(exprs, d_em.get(), *d_map);
+  }
+
+  /** The expression manager of the worker, and the map to it */
+  std::unique_ptr<ExprManager> d_em;
+  std::unique_ptr<ExprManagerMapCollection> d_map;
+  /** The worker */
+  std::unique_ptr<SmtEngine> d_smt;
+  /** The splitting atoms, in d_em */
+  std::vector<Expr> d_atoms;
+
+  /*
+   * The state of the worker, guarded by the mutex of conquer(): whether it
+   * is solving a cube, which one, since when, and whether it is interrupted
+   * to split the cube.
+   */
+  bool d_busy;
+  Cube d_cube;
+  std::chrono::steady_clock::time_point d_start;
+  bool d_split;
+}; /* struct CubeAndConquer::Worker */
+
+CubeAndConquer::CubeAndConquer(SmtEngine& smt)
+    : d_smt(smt),
+      d_interrupted(false),
+      d_cubes("smt::CubeAndConquer::cubes", 0),
+      d_splits("smt::CubeAndConquer::splits", 0),
+      d_workerCubes("smt::CubeAndConquer::workerCubes"),
+      d_cubeTime("smt::CubeAndConquer::cubeTime"),
+      d_minCubeTime("smt::CubeAndConquer::minCubeTime", 0),
+      d_maxCubeTime("smt::CubeAndConquer::maxCubeTime", 0),
+      d_probeTime("smt::CubeAndConquer::probeTime"),
+      d_exportedClauses("smt::CubeAndConquer::exportedClauses", 0),
+      d_importedClauses("smt::CubeAndConquer::importedClauses", 0),
+      d_usefulClauses("smt::CubeAndConquer::usefulClauses", 0)
+{
+  smtStatisticsRegistry()->registerStat(&d_cubes);
+  smtStatisticsRegistry()->registerStat(&d_splits);
+  smtStatisticsRegistry()->registerStat(&d_workerCubes);
+  smtStatisticsRegistry()->registerStat(&d_cubeTime);
+  smtStatisticsRegistry()->registerStat(&d_minCubeTime);
+  smtStatisticsRegistry()->registerStat(&d_maxCubeTime);
+  smtStatisticsRegistry()->registerStat(&d_probeTime);
+  smtStatisticsRegistry()->registerStat(&d_exportedClauses);
+  smtStatisticsRegistry()->registerStat(&d_importedClauses);
+  smtStatisticsRegistry()->registerStat(&d_usefulClauses);
+}
+
+CubeAndConquer::~CubeAndConquer()
+{
+  smtStatisticsRegistry()->unregisterStat(&d_cubes);
+  smtStatisticsRegistry()->unregisterStat(&d_splits);
+  smtStatisticsRegistry()->unregisterStat(&d_workerCubes);
+  smtStatisticsRegistry()->unregisterStat(&d_cubeTime);
+  smtStatisticsRegistry()->unregisterStat(&d_minCubeTime);
+  smtStatisticsRegistry()->unregisterStat(&d_maxCubeTime);
+  smtStatisticsRegistry()->unregisterStat(&d_probeTime);
+  smtStatisticsRegistry()->unregisterStat(&d_exportedClauses);
+  smtStatisticsRegistry()->unregisterStat(&d_importedClauses);
+  smtStatisticsRegistry()->unregisterStat(&d_usefulClauses);
+}
+
+void CubeAndConquer::interrupt() { d_interrupted = true; }
+
+Result CubeAndConquer::check()
+{
+  d_interrupted = false;
+  prop::PropEngine* propEngine = d_smt.getPropEngine();
+  Result r = probe();
+  if (r.asSatisfiabilityResult().isSat() != Result::SAT_UNKNOWN
+      || r.whyUnknown() != Result::INTERRUPTED || d_interrupted)
+  {
+    return r;
+  }
+
+  std::vector<Node> atoms;
+  propEngine->getActiveAtoms(options::cubeDepth() + kSplitAtoms, atoms);
+  Trace("cube") << "CubeAndConquer: splitting on " << atoms << std::endl;
+  if (atoms.empty())
+  {
+    return propEngine->checkSat();
+  }
+  // Declared before the workers, which refer to it
+  std::unique_ptr<prop::ClauseExchange> exchange;
+  std::vector<std::unique_ptr<Worker>> workers;
+  try
+  {
+    for (unsigned i = 0; i < options::cubeWorkers(); ++i)
+    {
+      workers.emplace_back(new Worker(d_smt, atoms));
+    }
+    if (options::satShareClauses())
+    {
+      std::vector<Expr> symbols;
+      getSymbols(symbols);
+      exchange.reset(new prop::ClauseExchange(workers.size()));
+      shareClauses(workers, *exchange, symbols);
+    }
+  }
+  catch (const Exception& e)
+  {
+    Notice() << "CubeAndConquer: cannot fork the SmtEngine, solving without "
+             << "cubes: " << e.getMessage() << std::endl;
+    return propEngine->checkSat();
+  }
+
+  Cube satCube;
+  r = conquer(workers, atoms.size(), satCube);
+  if (exchange)
+  {
+    d_exportedClauses += exchange->getExported();
+    d_importedClauses += exchange->getImported();
+    d_usefulClauses += exchange->getUseful();
+  }
+  if (r.asSatisfiabilityResult().isSat() == Result::SAT)
+  {
+    // The model is in the worker: solve again under the sat cube for it
+    for (const std::pair<size_t, bool>& lit : satCube)
+    {
+      const Node& atom = atoms[lit.first];
+      propEngine->assertFormula(lit.second ? atom : atom.notNode());
+    }
+    Result again = propEngine->checkSat();
+    Trace("cube") << "CubeAndConquer: solved again under the sat cube: "
+                  << again << std::endl;
+    // Never answer sat without a model in the parent: if the parent gives up
+    // under the cube its result stands, and if it disagrees with the worker
+    // we cannot trust either answer.
+    if (again.asSatisfiabilityResult().isSat() == Result::UNSAT)
+    {
+      return Result(Result::SAT_UNKNOWN, Result::INCOMPLETE);
+    }
+    return again;
+  }
+  return r;
+}
+
+Result CubeAndConquer::probe()
+{
+  TimerStat::CodeTimer probeTimer(d_probeTime);
+  ProbeTimer timer(d_smt.getPropEngine(),
+                   std::chrono::milliseconds(options::cubeProbeTime()));
+  return d_smt.getPropEngine()->checkSat();
+}
+
+Result CubeAndConquer::conquer(std::vector<std::unique_ptr<Worker>>& workers,
+                               size_t numAtoms,
+                               Cube& satCube)
+{
+  std::mutex mutex;
+  std::condition_variable cond;
+  // The cubes to solve
+  std::deque<Cube> cubes;
+  // The number of cubes queued or being solved
+  size_t open = 0;
+  bool done = false;
+  Result result(Result::UNSAT);
+  std::exception_ptr error;
+
+  size_t depth = std::min<size_t>(options::cubeDepth(), numAtoms);
+  for (size_t i = 0; i < (size_t(1) << depth); ++i)
+  {
+    Cube cube;
+    for (size_t j = 0; j < depth; ++j)
+    {
+      cube.emplace_back(j, ((i >> j) & 1) == 0);
+    }
+    cubes.push_back(cube);
+  }
+  open = cubes.size();
+
+  auto solve = [&](size_t w) {
+    Worker& worker = *workers[w];
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      cond.wait(lock, [&]() { return done || !cubes.empty(); });
+      if (done)
+      {
+        return;
+      }
+      worker.d_cube = cubes.front();
+      cubes.pop_front();
+      worker.d_busy = true;
+      worker.d_split = false;
+      worker.d_start = std::chrono::steady_clock::now();
+      Cube cube = worker.d_cube;
+      lock.unlock();
+
+      Result r;
+      try
+      {
+        std::vector<Expr> assumptions;
+        for (const std::pair<size_t, bool>& lit : cube)
+        {
+          const Expr& atom = worker.d_atoms[lit.first];
+          assumptions.push_back(lit.second ? atom : atom.notExpr());
+        }
+        r = worker.d_smt->checkSat(assumptions);
+      }
+      catch (...)
+      {
+        lock.lock();
+        worker.d_busy = false;
+        if (!done)
+        {
+          error = std::current_exception();
+          done = true;
+        }
+        cond.notify_all();
+        return;
+      }
+
+      lock.lock();
+      worker.d_busy = false;
+      std::chrono::duration<double> time =
+          std::chrono::steady_clock::now() - worker.d_start;
+      if (done)
+      {
+        cond.notify_all();
+        continue;
+      }
+      Result::Sat sat = r.asSatisfiabilityResult().isSat();
+      if (sat == Result::UNSAT)
+      {
+        recordCube(w, time.count());
+        if (--open == 0)
+        {
+          done = true;
+        }
+      }
+      else if (sat == Result::SAT)
+      {
+        recordCube(w, time.count());
+        satCube = cube;
+        result = r;
+        done = true;
+      }
+      else if (worker.d_split && cube.size() < numAtoms)
+      {
+        // Interrupted for an idle worker: split the cube on the next atom
+        cube.emplace_back(cube.size(), true);
+        cubes.push_back(cube);
+        cube.back().second = false;
+        cubes.push_back(cube);
+        ++open;
+        ++d_splits;
+      }
+      else
+      {
+        result = r;
+        done = true;
+      }
+      cond.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t w = 0; w < workers.size(); ++w)
+  {
+    threads.emplace_back(solve, w);
+  }
+  {
+    std::chrono::milliseconds splitTime(options::cubeSplitTime());
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!done)
+    {
+      cond.wait_for(lock, kInterruptPeriod);
+      if (d_interrupted && !done)
+      {
+        result = Result(Result::SAT_UNKNOWN, Result::INTERRUPTED);
+        done = true;
+        cond.notify_all();
+      }
+      if (done)
+      {
+        break;
+      }
+      // Work stealing: when a worker is idle and no cube is left, split the
+      // cubes solved for the longest time, one per idle worker
+      size_t idle = 0;
+      std::vector<Worker*> candidates;
+      auto now = std::chrono::steady_clock::now();
+      for (std::unique_ptr<Worker>& worker : workers)
+      {
+        if (!worker->d_busy)
+        {
+          ++idle;
+        }
+        else if (worker->d_split)
+        {
+          idle = idle > 0 ? idle - 1 : 0;
+        }
+        else if (worker->d_cube.size() < numAtoms
+                 && now - worker->d_start >= splitTime)
+        {
+          candidates.push_back(worker.get());
+        }
+      }
+      if (cubes.empty() && idle > 0)
+      {
+        std::sort(candidates.begin(),
+                  candidates.end(),
+                  [](const Worker* a, const Worker* b) {
+                    return a->d_start < b->d_start;
+                  });
+        for (size_t i = 0; i < candidates.size() && i < idle; ++i)
+        {
+          candidates[i]->d_split = true;
+        }
+      }
+      for (std::unique_ptr<Worker>& worker : workers)
+      {
+        if (worker->d_busy && worker->d_split)
+        {
+          worker->d_smt->interrupt();
+        }
+      }
+    }
+    // Stop the workers that are still solving a cube
+    auto busy = [&]() {
+      return std::any_of(workers.begin(),
+                         workers.end(),
+                         [](const std::unique_ptr<Worker>& worker) {
+                           return worker->d_busy;
+                         });
+    };
+    while (busy())
+    {
+      for (std::unique_ptr<Worker>& worker : workers)
+      {
+        if (worker->d_busy)
+        {
+          worker->d_smt->interrupt();
+        }
+      }
+      cond.wait_for(lock, kInterruptPeriod);
+    }
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+  return result;
+}
+
+void CubeAndConquer::getSymbols(std::vector<Expr>& symbols) const
+{
+  // The symbols that only occur in the definitions of functions are not
+  // shared, neither are the atoms over them
+  std::vector<Node> formulas;
+  for (const Expr& assertion : *d_smt.d_assertionList)
+  {
+    formulas.push_back(Node::fromExpr(assertion));
+  }
+  std::unordered_set<Node, NodeHashFunction> syms;
+  expr::getSymbols(formulas, syms);
+  for (const Node& sym : syms)
+  {
+    symbols.push_back(sym.toExpr());
+  }
+}
+
+void CubeAndConquer::shareClauses(std::vector<std::unique_ptr<Worker>>& workers,
+                                  prop::ClauseExchange& exchange,
+                                  const std::vector<Expr>& symbols)
+{
+  for (size_t w = 0; w < workers.size(); ++w)
+  {
+    Worker& worker = *workers[w];
+    // the symbols are exported with the assertions, so they are the same
+    // variables as in the worker's atoms
+    std::vector<Expr> exported =
+        Expr::exportTo(symbols, worker.d_em.get(), *worker.d_map);
+    ExprManagerScope scope(*worker.d_em);
+    std::vector<Node> nodes;
+    for (const Expr& e : exported)
+    {
+      nodes.push_back(Node::fromExpr(e));
+    }
+    worker.d_smt->getPropEngine()->shareClauses(&exchange, w, nodes);
+  }
+}
+
+void CubeAndConquer::recordCube(size_t w, double seconds)
+{
+  if (d_cubes.getData() == 0 || seconds < d_minCubeTime.getData())
+  {
+    d_minCubeTime.setData(seconds);
+  }
+  if (seconds > d_maxCubeTime.getData())
+  {
+    d_maxCubeTime.setData(seconds);
+  }
+  ++d_cubes;
+  d_workerCubes << w;
+  d_cubeTime.addEntry(seconds);
+}
+
+}  // namespace CVC4
@@ -0,0 +1,129 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Parallel check-sat by cube-and-conquer
+ **
+ ** With --cube-workers=N, the SmtEngine searches for --cube-probe
+ ** milliseconds, and if this does not solve the problem, splits it on the
+ ** --cube-depth atoms of highest activity in the SAT solver.  Each of the
+ ** resulting cubes (conjunctions of these atoms or their negations) is solved
+ ** as a set of assumptions by one of N worker SmtEngines, forked from the
+ ** SmtEngine, on their own thread.  When a worker is idle and no cube is
+ ** left, the cubes that are solved for more than --cube-split milliseconds
+ ** are interrupted and split on the next atom, for the idle workers to take
+ ** the halves.
+ **
+ ** The problem is unsat if all the cubes are, and sat if one of them is.  In
+ ** the latter case, the SmtEngine solves the problem again under the cube,
+ ** for the model.
+ **
+ ** With --sat-share-clauses, the workers share the short clauses they learn
+ ** independently of their cube (see prop::ClauseExchange).
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef CVC4__SMT__CUBE_AND_CONQUER_H
+#define CVC4__SMT__CUBE_AND_CONQUER_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "expr/expr.h"
+#include "expr/node.h"
+#include "util/result.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+
+class SmtEngine;
+
+namespace prop {
+class ClauseExchange;
+}
+
+class CubeAndConquer
+{
+ public:
+  CubeAndConquer(SmtEngine& smt);
+  ~CubeAndConquer();
+
+  /**
+   * Check the satisfiability of the assertions of the SmtEngine, which must
+   * have been processed and given to its prop engine.
+   */
+  Result check();
+
+  /** Interrupt the check, from another thread. */
+  void interrupt();
+
+ private:
+  /**
+   * A cube, as a list of (atom index, polarity) pairs.  The cubes split on
+   * the atoms in order, so the atoms of a cube are the first atoms.
+   */
+  typedef std::vector<std::pair<size_t, bool>> Cube;
+
+  /** A worker SmtEngine and the cube it solves */
+  struct Worker;
+
+  /** Search for --cube-probe milliseconds. */
+  Result probe();
+
+  /**
+   * Solve the cubes over the first numAtoms atoms on the workers, returns
+   * the result and sets satCube to a sat cube if there is one.
+   */
+  Result conquer(std::vector<std::unique_ptr<Worker>>& workers,
+                 size_t numAtoms,
+                 Cube& satCube);
+
+  /** Get the symbols of the assertions of the SmtEngine. */
+  void getSymbols(std::vector<Expr>& symbols) const;
+
+  /**
+   * Share the learned clauses of the workers through exchange, the symbols
+   * of the SmtEngine naming their atoms.
+   */
+  void shareClauses(std::vector<std::unique_ptr<Worker>>& workers,
+                    prop::ClauseExchange& exchange,
+                    const std::vector<Expr>& symbols);
+
+  /** Record the time of a cube solved by worker w, with the mutex held. */
+  void recordCube(size_t w, double seconds);
+
+  /** The SmtEngine checked */
+  SmtEngine& d_smt;
+
+  /** Whether interrupt() was called during the check */
+  std::atomic<bool> d_interrupted;
+
+  /** The number of cubes solved */
+  IntStat d_cubes;
+  /** The number of cubes split for an idle worker */
+  IntStat d_splits;
+  /** The number of cubes solved by each worker */
+  HistogramStat<unsigned> d_workerCubes;
+  /** The time of the cubes, in seconds */
+  AverageStat d_cubeTime;
+  BackedStat<double> d_minCubeTime;
+  BackedStat<double> d_maxCubeTime;
+  /** The time of the search before splitting */
+  TimerStat d_probeTime;
+  /** The number of clauses shared by the workers, imported, and useful */
+  IntStat d_exportedClauses;
+  IntStat d_importedClauses;
+  IntStat d_usefulClauses;
+}; /* class CubeAndConquer */
+
+}  // namespace CVC4
+
+#endif /* CVC4__SMT__CUBE_AND_CONQUER_H */
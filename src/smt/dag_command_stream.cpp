@@ -0,0 +1,65 @@
+/*********************                                                        */
+/*! \file dag_command_stream.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Commands read from a binary DAG file
+ **
+ ** Commands read from a binary DAG file.
+ **/
+
+#include "smt/dag_command_stream.h"
+
+#include "base/check.h"
+#include "expr/dag_serializer.h"
+#include "expr/node_manager.h"
+#include "smt/command.h"
+
+namespace CVC4 {
+
+DagCommandStream::DagCommandStream(ExprManager* em,
+                                   const char* data,
+                                   size_t size)
+    : d_exprManager(em)
+{
+  NodeManager* nm = NodeManager::fromExprManager(em);
+  NodeManagerScope nms(nm);
+  d_reader.reset(new expr::DagReader(nm, data, size));
+}
+
+DagCommandStream::~DagCommandStream()
+{
+  NodeManagerScope nms(NodeManager::fromExprManager(d_exprManager));
+  d_reader.reset();
+}
+
+Command* DagCommandStream::next()
+{
+  NodeManagerScope nms(NodeManager::fromExprManager(d_exprManager));
+  expr::DagCommand cmd;
+  if (!d_reader->next(cmd))
+  {
+    return nullptr;
+  }
+  switch (cmd.d_kind)
+  {
+    case expr::DagCommand::SET_LOGIC:
+      return new SetBenchmarkLogicCommand(cmd.d_symbol);
+    case expr::DagCommand::DECLARE_SORT:
+      return new DeclareTypeCommand(cmd.d_symbol, 0, cmd.d_type.toType());
+    case expr::DagCommand::DECLARE_FUN:
+      return new DeclareFunctionCommand(
+          cmd.d_symbol, cmd.d_node.toExpr(), cmd.d_type.toType());
+    case expr::DagCommand::ASSERT: return new AssertCommand(cmd.d_node.toExpr());
+    case expr::DagCommand::PUSH: return new PushCommand();
+    case expr::DagCommand::POP: return new PopCommand();
+    case expr::DagCommand::CHECK_SAT: return new CheckSatCommand();
+  }
+  Unreachable();
+}
+
+}  // namespace CVC4
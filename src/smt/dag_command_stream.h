@@ -0,0 +1,60 @@
+/*********************                                                        */
+/*! \file dag_command_stream.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Commands read from a binary DAG file
+ **
+ ** Turns the contents of a DAG file (see expr/dag_serializer.h) into
+ ** Command objects, for use by the parser library.
+ **/
+
+#include "cvc4_public.h"
+
+#ifndef CVC4__SMT__DAG_COMMAND_STREAM_H
+#define CVC4__SMT__DAG_COMMAND_STREAM_H
+
+#include <cstddef>
+#include <memory>
+
+namespace CVC4 {
+
+class Command;
+class ExprManager;
+
+namespace expr {
+class DagReader;
+}
+
+/**
+ * A stream of commands read from a DAG file held in memory.  The nodes are
+ * rebuilt directly in the NodeManager of the given ExprManager.
+ */
+class CVC4_PUBLIC DagCommandStream
+{
+ public:
+  /**
+   * Create a stream over data[0..size), which must outlive the stream.
+   * Throws an Exception if data does not start with a DAG file header.
+   */
+  DagCommandStream(ExprManager* em, const char* data, size_t size);
+  ~DagCommandStream();
+
+  /**
+   * Get the next command, or nullptr at the end.  The caller owns the
+   * command.  Throws an Exception on malformed input.
+   */
+  Command* next();
+
+ private:
+  ExprManager* d_exprManager;
+  std::unique_ptr<expr::DagReader> d_reader;
+}; /* class DagCommandStream */
+
+}  // namespace CVC4
+
+#endif /* CVC4__SMT__DAG_COMMAND_STREAM_H */
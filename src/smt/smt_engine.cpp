@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <fstream>
 #include <iterator>
 #include <memory>
 #include <sstream>
@@ -40,8 +42,10 @@
 #include "context/cdhashset.h"
 #include "context/cdlist.h"
 #include "context/context.h"
+#include "context/context_profiler.h"
 #include "decision/decision_engine.h"
 #include "expr/attribute.h"
+#include "expr/dag_serializer.h"
 #include "expr/expr.h"
 #include "expr/kind.h"
 #include "expr/metakind.h"
@@ -82,6 +86,7 @@
 #include "prop/prop_engine.h"
 #include "smt/command.h"
 #include "smt/command_list.h"
+#include "smt/cube_and_conquer.h"
 #include "smt/logic_request.h"
 #include "smt/managed_ostreams.h"
 #include "smt/model_blocker.h"
@@ -176,6 +181,95 @@ public:
   Node getFormula() const { return d_formula; }
 };/* class DefinedFunction */
 
+/**
+ * The largest number of bytes ever allocated at each level of a context, as
+ * a list of (level : bytes) pairs.
+ */
+class ContextLevelBytesStat : public Stat
+{
+ public:
+  ContextLevelBytesStat(const std::string& name)
+      : Stat(name), d_levelBytes(nullptr)
+  {
+  }
+
+  void setData(const std::vector<uint64_t>& levelBytes)
+  {
+    d_levelBytes = &levelBytes;
+  }
+
+  void flushInformation(std::ostream& out) const override
+  {
+    out << "[";
+    for (size_t i = 0, n = size(); i < n; ++i)
+    {
+      out << (i > 0 ? ", " : "") << "(" << i << " : " << (*d_levelBytes)[i]
+          << ")";
+    }
+    out << "]";
+  }
+
+  void safeFlushInformation(int fd) const override
+  {
+    safe_print(fd, "[");
+    for (size_t i = 0, n = size(); i < n; ++i)
+    {
+      safe_print(fd, i > 0 ? ", (" : "(");
+      safe_print<uint64_t>(fd, i);
+      safe_print(fd, " : ");
+      safe_print<uint64_t>(fd, (*d_levelBytes)[i]);
+      safe_print(fd, ")");
+    }
+    safe_print(fd, "]");
+  }
+
+ private:
+  size_t size() const
+  {
+    return d_levelBytes == nullptr ? 0 : d_levelBytes->size();
+  }
+
+  const std::vector<uint64_t>* d_levelBytes;
+}; /* class ContextLevelBytesStat */
+
+/**
+ * The number of restores and the restore time of each owner of objects in
+ * a context, as given by a ContextProfiler.
+ */
+class ContextRestoreProfileStat : public Stat
+{
+ public:
+  ContextRestoreProfileStat(const std::string& name)
+      : Stat(name), d_profiler(nullptr)
+  {
+  }
+
+  void setData(const ContextProfiler* profiler) { d_profiler = profiler; }
+
+  void flushInformation(std::ostream& out) const override
+  {
+    if (d_profiler == nullptr)
+    {
+      out << "[]";
+      return;
+    }
+    d_profiler->print(out);
+  }
+
+  void safeFlushInformation(int fd) const override
+  {
+    if (d_profiler == nullptr)
+    {
+      safe_print(fd, "[]");
+      return;
+    }
+    d_profiler->safePrint(fd);
+  }
+
+ private:
+  const ContextProfiler* d_profiler;
+}; /* class ContextRestoreProfileStat */
+
 struct SmtEngineStatistics {
   /** time spent in definition-expansion */
   TimerStat d_definitionExpansionTime;
@@ -206,6 +300,14 @@ struct SmtEngineStatistics {
   IntStat d_simplifiedToFalse;
   /** Number of resource units spent. */
   ReferenceStat<uint64_t> d_resourceUnitsUsed;
+  /** Peak bytes allocated in the SAT context memory */
+  ReferenceStat<uint64_t> d_contextPeakBytes;
+  /** Peak bytes allocated in the user context memory */
+  ReferenceStat<uint64_t> d_userContextPeakBytes;
+  /** Peak bytes allocated at each SAT context level */
+  ContextLevelBytesStat d_contextLevelBytes;
+  /** Restore counts and times per owner, with --context-profile */
+  ContextRestoreProfileStat d_contextRestoreProfile;
 
   SmtEngineStatistics()
       : d_definitionExpansionTime("smt::SmtEngine::definitionExpansionTime"),
@@ -221,7 +323,11 @@ struct SmtEngineStatistics {
         d_pushPopTime("smt::SmtEngine::pushPopTime"),
         d_processAssertionsTime("smt::SmtEngine::processAssertionsTime"),
         d_simplifiedToFalse("smt::SmtEngine::simplifiedToFalse", 0),
-        d_resourceUnitsUsed("smt::SmtEngine::resourceUnitsUsed")
+        d_resourceUnitsUsed("smt::SmtEngine::resourceUnitsUsed"),
+        d_contextPeakBytes("smt::SmtEngine::contextPeakBytes"),
+        d_userContextPeakBytes("smt::SmtEngine::userContextPeakBytes"),
+        d_contextLevelBytes("smt::SmtEngine::contextLevelPeakBytes"),
+        d_contextRestoreProfile("smt::SmtEngine::contextRestoreProfile")
   {
     smtStatisticsRegistry()->registerStat(&d_definitionExpansionTime);
     smtStatisticsRegistry()->registerStat(&d_numConstantProps);
@@ -237,6 +343,10 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->registerStat(&d_processAssertionsTime);
     smtStatisticsRegistry()->registerStat(&d_simplifiedToFalse);
     smtStatisticsRegistry()->registerStat(&d_resourceUnitsUsed);
+    smtStatisticsRegistry()->registerStat(&d_contextPeakBytes);
+    smtStatisticsRegistry()->registerStat(&d_userContextPeakBytes);
+    smtStatisticsRegistry()->registerStat(&d_contextLevelBytes);
+    smtStatisticsRegistry()->registerStat(&d_contextRestoreProfile);
   }
 
   ~SmtEngineStatistics() {
@@ -254,6 +364,10 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->unregisterStat(&d_processAssertionsTime);
     smtStatisticsRegistry()->unregisterStat(&d_simplifiedToFalse);
     smtStatisticsRegistry()->unregisterStat(&d_resourceUnitsUsed);
+    smtStatisticsRegistry()->unregisterStat(&d_contextPeakBytes);
+    smtStatisticsRegistry()->unregisterStat(&d_userContextPeakBytes);
+    smtStatisticsRegistry()->unregisterStat(&d_contextLevelBytes);
+    smtStatisticsRegistry()->unregisterStat(&d_contextRestoreProfile);
   }
 };/* struct SmtEngineStatistics */
 
@@ -517,6 +631,66 @@ class SmtEnginePrivate : public NodeManagerListener {
   CDO<bool> d_sygusConjectureStale;
   /*------------------- end of sygus utils ------------------*/
 
+  /*------------------- DAG output (--write-dag) ------------------*/
+  /** The file the DAG writer writes to */
+  std::unique_ptr<std::ofstream> d_dagOut;
+  /** The DAG writer, or null if --write-dag is not given or writing failed */
+  std::unique_ptr<expr::DagWriter> d_dagWriter;
+
+  /** Open the file given by --write-dag and write the logic to it. */
+  void openDagWriter()
+  {
+    d_dagOut.reset(new std::ofstream(options::writeDag(),
+                                     std::ios::out | std::ios::binary));
+    if (!d_dagOut->good())
+    {
+      d_dagOut.reset();
+      throw OptionException("cannot open " + options::writeDag()
+                            + " for writing");
+    }
+    d_dagWriter.reset(new expr::DagWriter(*d_dagOut));
+    writeDag(
+        [&](expr::DagWriter& w) { w.setLogic(d_smt.d_logic.getLogicString()); });
+  }
+
+  /** Whether the DAG file records the preprocessed assertions. */
+  bool isWritingPreprocessedDag() const
+  {
+    return d_dagWriter != nullptr && options::writeDagPreprocessed();
+  }
+  /** Whether the DAG file records the input assertions. */
+  bool isWritingParsedDag() const
+  {
+    return d_dagWriter != nullptr && !options::writeDagPreprocessed();
+  }
+
+  /**
+   * Apply f to the DAG writer, if any.  If the problem cannot be written
+   * in the DAG format, the partial file is removed and writing stops, so
+   * an incomplete file is never mistaken for the full problem.
+   */
+  template <class F>
+  void writeDag(F f)
+  {
+    if (d_dagWriter == nullptr)
+    {
+      return;
+    }
+    try
+    {
+      f(*d_dagWriter);
+    }
+    catch (Exception& e)
+    {
+      Warning() << "cannot write " << options::writeDag() << ": "
+                << e.getMessage() << endl;
+      d_dagWriter.reset();
+      d_dagOut.reset();
+      std::remove(options::writeDag().c_str());
+    }
+  }
+  /*------------------- end of DAG output ------------------*/
+
  private:
   std::unique_ptr<PreprocessingPassContext> d_preprocessingPassContext;
 
@@ -843,16 +1017,29 @@ class SmtEnginePrivate : public NodeManagerListener {
   //------------------------------- end expression names
 };/* class SmtEnginePrivate */
 
+/** The configuration of the context memory managers given by opts */
+static ContextMemoryConfig contextMemoryConfig(const Options& opts)
+{
+  ContextMemoryConfig config;
+  config.d_chunkSizeBytes = opts[options::contextChunkSize];
+  config.d_maxFreeChunks = opts[options::contextMaxFreeChunks];
+  config.d_useHugePages = opts[options::contextHugePages];
+  return config;
+}
+
 }/* namespace CVC4::smt */
 
 SmtEngine::SmtEngine(ExprManager* em)
-    : d_context(new Context()),
-      d_userContext(new UserContext()),
+    : d_contextTrace(nullptr),
+      d_contextProfiler(nullptr),
+      d_context(new Context(contextMemoryConfig(em->getOptions()))),
+      d_userContext(new UserContext(contextMemoryConfig(em->getOptions()))),
       d_userLevels(),
       d_exprManager(em),
       d_nodeManager(d_exprManager->getNodeManager()),
       d_theoryEngine(nullptr),
       d_propEngine(nullptr),
+      d_cubeAndConquer(nullptr),
       d_proofManager(nullptr),
       d_definedFunctions(nullptr),
       d_fmfRecFunctionsDefined(nullptr),
@@ -863,6 +1050,7 @@ SmtEngine::SmtEngine(ExprManager* em)
       d_dumpCommands(),
       d_defineCommands(),
       d_logic(),
+      d_uninterpretedSortOwner(theory::THEORY_UF),
       d_originalOptions(),
       d_isInternalSubsolver(false),
       d_pendingPops(0),
@@ -886,6 +1074,30 @@ SmtEngine::SmtEngine(ExprManager* em)
   d_stats.reset(new SmtEngineStatistics());
   d_stats->d_resourceUnitsUsed.setData(
       d_private->getResourceManager()->getResourceUsage());
+  d_stats->d_contextPeakBytes.setData(d_context->getCMM()->getPeakBytes());
+  d_stats->d_userContextPeakBytes.setData(
+      d_userContext->getCMM()->getPeakBytes());
+  d_stats->d_contextLevelBytes.setData(
+      d_context->getCMM()->getPeakLevelBytes());
+
+  // Attach the profiler before the SAT context has any object to profile
+  const Options& opts = em->getOptions();
+  if (opts[options::contextProfile] || !opts[options::contextTrace].empty())
+  {
+    d_contextProfiler.reset(new ContextProfiler());
+    if (!opts[options::contextTrace].empty())
+    {
+      d_contextTrace.reset(new std::ofstream(opts[options::contextTrace]));
+      if (!d_contextTrace->good())
+      {
+        throw OptionException("cannot open " + opts[options::contextTrace]
+                              + " for writing");
+      }
+      d_contextProfiler->setTraceStream(d_contextTrace.get());
+    }
+    d_context->setProfiler(d_contextProfiler.get());
+    d_stats->d_contextRestoreProfile.setData(d_contextProfiler.get());
+  }
 
   // The ProofManager is constructed before any other proof objects such as
   // SatProof and TheoryProofs. The TheoryProofEngine and the SatProof are
@@ -909,13 +1121,21 @@ void SmtEngine::finishInit()
   Trace("smt-debug") << "SmtEngine::finishInit" << std::endl;
   // We have mutual dependency here, so we add the prop engine to the theory
   // engine later (it is non-essential there)
-  d_theoryEngine.reset(new TheoryEngine(getContext(),
-                                        getUserContext(),
-                                        d_private->d_iteRemover,
-                                        const_cast<const LogicInfo&>(d_logic)));
+  // The context objects are tagged with their owner for --context-profile
+  {
+    ContextProfiler::Tag tag(getContext(), "TheoryEngine");
+    d_theoryEngine.reset(
+        new TheoryEngine(getContext(),
+                         getUserContext(),
+                         d_private->d_iteRemover,
+                         const_cast<const LogicInfo&>(d_logic)));
+  }
 
   // Add the theories
   for(TheoryId id = theory::THEORY_FIRST; id < theory::THEORY_LAST; ++id) {
+    std::stringstream name;
+    name << id;
+    ContextProfiler::Tag tag(getContext(), name.str());
     TheoryConstructor::addTheory(getTheoryEngine(), id);
     //register with proof engine if applicable
 #ifdef CVC4_PROOF
@@ -935,16 +1155,27 @@ void SmtEngine::finishInit()
    * are unregistered by the obsolete PropEngine object before registered
    * again by the new PropEngine object */
   d_propEngine.reset(nullptr);
-  d_propEngine.reset(new PropEngine(getTheoryEngine(),
-                                    getContext(),
-                                    getUserContext(),
-                                    d_private->getReplayLog(),
-                                    d_replayStream));
+  {
+    ContextProfiler::Tag tag(getContext(), "PropEngine");
+    d_propEngine.reset(new PropEngine(getTheoryEngine(),
+                                      getContext(),
+                                      getUserContext(),
+                                      d_private->getReplayLog(),
+                                      d_replayStream));
+  }
 
   Trace("smt-debug") << "Setting up theory engine..." << std::endl;
   d_theoryEngine->setPropEngine(getPropEngine());
   Trace("smt-debug") << "Finishing init for theory engine..." << std::endl;
-  d_theoryEngine->finishInit();
+  {
+    ContextProfiler::Tag tag(getContext(), "TheoryEngine");
+    d_theoryEngine->finishInit();
+  }
+
+  if (options::cubeWorkers() > 0)
+  {
+    d_cubeAndConquer.reset(new CubeAndConquer(*this));
+  }
 
   // global push/pop around everything, to ensure proper destruction
   // of context-dependent data structures
@@ -993,6 +1224,10 @@ void SmtEngine::finishInit()
       }
     });
   d_private->finishInit();
+  if (!options::writeDag().empty())
+  {
+    d_private->openDagWriter();
+  }
   Trace("smt-debug") << "SmtEngine::finishInit done" << std::endl;
 }
 
@@ -1085,6 +1320,7 @@ SmtEngine::~SmtEngine()
     d_proofManager.reset(nullptr);
 #endif
 
+    d_cubeAndConquer.reset(nullptr);
     d_theoryEngine.reset(nullptr);
     d_propEngine.reset(nullptr);
 
@@ -1313,6 +1549,52 @@ void SmtEngine::setDefaults() {
     options::unsatCores.set(true);
   }
 
+  if (options::cubeWorkers() > 0)
+  {
+    if (options::incrementalSolving() || options::unsatCores()
+        || options::proof())
+    {
+      throw OptionException(
+          "cube-and-conquer (--cube-workers) is not supported with "
+          "incremental solving, unsat cores or proofs");
+    }
+    if (!options::produceAssertions())
+    {
+      Notice() << "SmtEngine: turning on produce-assertions to fork the "
+               << "cube-and-conquer workers." << endl;
+      setOption("produce-assertions", SExpr("true"));
+    }
+  }
+
+  if (options::satSolver() == options::MainSatSolverMode::CADICAL
+      && (options::unsatCores() || options::proof()))
+  {
+    throw OptionException(
+        "--sat-solver=cadical is not supported with unsat cores or proofs");
+  }
+
+  if (options::satSolver() == options::MainSatSolverMode::CADICAL
+      && (options::cumulativeResourceLimit.wasSetByUser()
+          || options::perCallResourceLimit.wasSetByUser()))
+  {
+    throw OptionException(
+        "--sat-solver=cadical is not supported with resource limits");
+  }
+
+  if ((options::cnfPolarity() || options::cnfGateHashing())
+      && (options::unsatCores() || options::proof()))
+  {
+    throw OptionException(
+        "--cnf-polarity and --cnf-gate-hashing are not supported with unsat "
+        "cores or proofs");
+  }
+
+  if (options::satInprocess() && (options::unsatCores() || options::proof()))
+  {
+    throw OptionException(
+        "--sat-inprocess is not supported with unsat cores or proofs");
+  }
+
   if ((options::checkModels() || options::checkSynthSol()
        || options::produceAbducts()
        || options::modelCoresMode() != options::ModelCoresMode::NONE
@@ -1609,9 +1891,9 @@ void SmtEngine::setDefaults() {
   // If in arrays, set the UF handler to arrays
   if(d_logic.isTheoryEnabled(THEORY_ARRAYS) && ( !d_logic.isQuantified() ||
      (d_logic.isQuantified() && !d_logic.isTheoryEnabled(THEORY_UF)))) {
-    Theory::setUninterpretedSortOwner(THEORY_ARRAYS);
+    d_uninterpretedSortOwner = THEORY_ARRAYS;
   } else {
-    Theory::setUninterpretedSortOwner(THEORY_UF);
+    d_uninterpretedSortOwner = THEORY_UF;
   }
 
   if(! options::simplifyWithCareEnabled.wasSetByUser() ){
@@ -3046,7 +3328,8 @@ Result SmtEngine::check() {
 
   Chat() << "solving..." << endl;
   Trace("smt") << "SmtEngine::check(): running check" << endl;
-  Result result = d_propEngine->checkSat();
+  Result result = d_cubeAndConquer != nullptr ? d_cubeAndConquer->check()
+                                              : d_propEngine->checkSat();
 
   resourceManager->endCall();
   Trace("limit") << "SmtEngine::check(): cumulative millis " << resourceManager->getTimeUsage()
@@ -3543,6 +3826,15 @@ void SmtEnginePrivate::processAssertions() {
 
   Trace("smt-proc") << "SmtEnginePrivate::processAssertions() end" << endl;
   dumpAssertions("post-everything", d_assertions);
+  if (isWritingPreprocessedDag())
+  {
+    writeDag([&](expr::DagWriter& w) {
+      for (const Node& a : d_assertions.ref())
+      {
+        w.assertFormula(a);
+      }
+    });
+  }
 
   // if incremental, compute which variables are assigned
   if (options::incrementalSolving())
@@ -3727,6 +4019,10 @@ Result SmtEngine::checkSatisfiability(const vector<Expr>& assumptions,
     {
       internalPush();
       didInternalPush = true;
+      if (d_private->isWritingParsedDag())
+      {
+        d_private->writeDag([](expr::DagWriter& w) { w.push(); });
+      }
     }
 
     Result r(Result::SAT_UNKNOWN, Result::UNKNOWN_REASON);
@@ -3744,10 +4040,25 @@ Result SmtEngine::checkSatisfiability(const vector<Expr>& assumptions,
         d_assertionList->push_back(e);
       }
       d_private->addFormula(e.getNode(), inUnsatCore, true, true);
+      if (d_private->isWritingParsedDag())
+      {
+        unordered_map<Node, Node, NodeHashFunction> cache;
+        Node n = d_private->expandDefinitions(e.getNode(), cache);
+        d_private->writeDag([&](expr::DagWriter& w) { w.assertFormula(n); });
+      }
     }
 
     r = check();
 
+    d_private->writeDag([&](expr::DagWriter& w) {
+      w.checkSat();
+      if (didInternalPush && d_private->isWritingParsedDag())
+      {
+        w.pop();
+      }
+      w.flush();
+    });
+
     if ((options::solveRealAsInt() || options::solveIntAsBV() > 0)
         && r.asSatisfiabilityResult().isSat() == Result::UNSAT)
     {
@@ -3893,6 +4204,12 @@ Result SmtEngine::assertFormula(const Expr& ex, bool inUnsatCore)
   }
   bool maybeHasFv = language::isInputLangSygus(options::inputLanguage());
   d_private->addFormula(e.getNode(), inUnsatCore, true, false, maybeHasFv);
+  if (d_private->isWritingParsedDag())
+  {
+    unordered_map<Node, Node, NodeHashFunction> cache;
+    Node n = d_private->expandDefinitions(e.getNode(), cache);
+    d_private->writeDag([&](expr::DagWriter& w) { w.assertFormula(n); });
+  }
   return quickCheck().asValidityResult();
 }/* SmtEngine::assertFormula() */
 
@@ -5379,6 +5696,73 @@ vector<Expr> SmtEngine::getAssertions() {
   return vector<Expr>(d_assertionList->begin(), d_assertionList->end());
 }
 
+SmtEngine* SmtEngine::fork(ExprManager* em, ExprManagerMapCollection& varMap)
+{
+  SmtScope smts(this);
+  finalOptionsAreSet();
+  doPendingPops();
+  Trace("smt") << "SMT fork()" << endl;
+  if (!options::produceAssertions())
+  {
+    const char* msg =
+        "Cannot fork an SmtEngine when not in produce-assertions mode.";
+    throw ModalException(msg);
+  }
+  if (em == d_exprManager)
+  {
+    throw ModalException(
+        "Cannot fork an SmtEngine into its own expression manager.");
+  }
+
+  // Collect the definitions, as function, formula and formals, followed by
+  // the assertions, to export them in one pass
+  std::vector<Expr> exprs;
+  std::vector<size_t> numFormals;
+  for (const DefinedFunctionMap::value_type& def : *d_definedFunctions)
+  {
+    const DefinedFunction& df = def.second;
+    exprs.push_back(df.getFunction().toExpr());
+    exprs.push_back(df.getFormula().toExpr());
+    std::vector<Node> formals = df.getFormals();
+    for (const Node& f : formals)
+    {
+      exprs.push_back(f.toExpr());
+    }
+    numFormals.push_back(formals.size());
+  }
+  exprs.insert(exprs.end(), d_assertionList->begin(), d_assertionList->end());
+  std::vector<Expr> exported;
+  try
+  {
+    exported = Expr::exportTo(exprs, em, varMap);
+  }
+  catch (const ExportUnsupportedException& e)
+  {
+    std::stringstream msg;
+    msg << "Cannot fork an SmtEngine: " << e.getMessage();
+    throw ModalException(msg.str());
+  }
+
+  std::unique_ptr<SmtEngine> smt(new SmtEngine(em));
+  smt->setLogic(d_logic);
+  size_t i = 0;
+  for (size_t n : numFormals)
+  {
+    Expr func = exported[i];
+    Expr formula = exported[i + 1];
+    std::vector<Expr> formals(exported.begin() + i + 2,
+                              exported.begin() + i + 2 + n);
+    smt->defineFunction(func, formals, formula);
+    i += 2 + n;
+  }
+  Assert(i == exported.size() - d_assertionList->size());
+  for (; i < exported.size(); ++i)
+  {
+    smt->assertFormula(exported[i]);
+  }
+  return smt.release();
+}
+
 void SmtEngine::push()
 {
   SmtScope smts(this);
@@ -5402,6 +5786,10 @@ void SmtEngine::push()
 
   d_userLevels.push_back(d_userContext->getLevel());
   internalPush();
+  if (d_private->isWritingParsedDag())
+  {
+    d_private->writeDag([](expr::DagWriter& w) { w.push(); });
+  }
   Trace("userpushpop") << "SmtEngine: pushed to level "
                        << d_userContext->getLevel() << endl;
 }
@@ -5434,6 +5822,10 @@ void SmtEngine::pop() {
     internalPop(true);
   }
   d_userLevels.pop_back();
+  if (d_private->isWritingParsedDag())
+  {
+    d_private->writeDag([](expr::DagWriter& w) { w.pop(); });
+  }
 
   // Clear out assertion queues etc., in case anything is still in there
   d_private->notifyPop();
@@ -5546,11 +5938,14 @@ void SmtEngine::resetAssertions()
    * statistics are unregistered by the obsolete PropEngine object before
    * registered again by the new PropEngine object */
   d_propEngine.reset(nullptr);
-  d_propEngine.reset(new PropEngine(getTheoryEngine(),
-                                    getContext(),
-                                    getUserContext(),
-                                    d_private->getReplayLog(),
-                                    d_replayStream));
+  {
+    ContextProfiler::Tag tag(getContext(), "PropEngine");
+    d_propEngine.reset(new PropEngine(getTheoryEngine(),
+                                      getContext(),
+                                      getUserContext(),
+                                      d_private->getReplayLog(),
+                                      d_replayStream));
+  }
   d_theoryEngine->setPropEngine(getPropEngine());
 }
 
@@ -5561,6 +5956,10 @@ void SmtEngine::interrupt()
   }
   d_propEngine->interrupt();
   d_theoryEngine->interrupt();
+  if (d_cubeAndConquer != nullptr)
+  {
+    d_cubeAndConquer->interrupt();
+  }
 }
 
 void SmtEngine::setResourceLimit(unsigned long units, bool cumulative) {
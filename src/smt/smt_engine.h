@@ -33,6 +33,7 @@
 #include "proof/unsat_core.h"
 #include "smt/logic_exception.h"
 #include "theory/logic_info.h"
+#include "theory/theory_id.h"
 #include "util/hash.h"
 #include "util/proof.h"
 #include "util/result.h"
@@ -62,12 +63,14 @@ class ProofManager;
 
 class Model;
 class LogicRequest;
+class CubeAndConquer;
 class StatisticsRegistry;
 
 /* -------------------------------------------------------------------------- */
 
 namespace context {
   class Context;
+  class ContextProfiler;
   class UserContext;
 }/* CVC4::context namespace */
 
@@ -100,6 +103,7 @@ namespace smt {
   class BooleanTermConverter;
 
   ProofManager* currentProofManager();
+  theory::TheoryId currentUninterpretedSortOwner();
 
   struct CommandCleanup;
   typedef context::CDList<Command*, CommandCleanup> CommandList;
@@ -132,7 +136,9 @@ class CVC4_PUBLIC SmtEngine
   friend class ::CVC4::smt::SmtScope;
   friend class ::CVC4::smt::BooleanTermConverter;
   friend ProofManager* ::CVC4::smt::currentProofManager();
+  friend theory::TheoryId(::CVC4::smt::currentUninterpretedSortOwner)();
   friend class ::CVC4::LogicRequest;
+  friend class ::CVC4::CubeAndConquer;
   friend class ::CVC4::Model;  // to access d_modelCommands
   friend class ::CVC4::theory::TheoryModel;
 
@@ -635,6 +641,23 @@ class CVC4_PUBLIC SmtEngine
    */
   std::vector<Expr> getAssertions();
 
+  /**
+   * Create a copy of this SmtEngine in the expression manager em, which
+   * must be different from the one of this SmtEngine.  The copy has the
+   * logic, the function definitions and the assertions of all the user
+   * levels of this SmtEngine, all at its own bottom user level; it takes
+   * its options from em.  Only permitted in produce-assertions mode.
+   *
+   * The expressions are exported to em with varMap, in one pass so that
+   * shared subterms stay shared.  Further expressions can be exported to
+   * the copy with the same varMap, which must outlive such uses.
+   *
+   * The copy has no link to this SmtEngine, so once created, it may be
+   * used in another thread than this one.  It is owned by the caller and
+   * must be destroyed before em.
+   */
+  SmtEngine* fork(ExprManager* em, ExprManagerMapCollection& varMap);
+
   /**
    * Push a user-level context.
    * throw@ ModalException, LogicException, UnsafeInterruptException
@@ -1069,6 +1092,13 @@ class CVC4_PUBLIC SmtEngine
 
   /* Members -------------------------------------------------------------- */
 
+  /**
+   * The file given by --context-trace and the profiler of the SAT context.
+   * They are declared before the contexts so that they outlive them.
+   */
+  std::unique_ptr<std::ostream> d_contextTrace;
+  std::unique_ptr<context::ContextProfiler> d_contextProfiler;
+
   /** Expr manager context */
   std::unique_ptr<context::Context> d_context;
   /** User level context */
@@ -1086,6 +1116,9 @@ class CVC4_PUBLIC SmtEngine
   /** The propositional engine */
   std::unique_ptr<prop::PropEngine> d_propEngine;
 
+  /** The cube-and-conquer check-sat, with --cube-workers */
+  std::unique_ptr<CubeAndConquer> d_cubeAndConquer;
+
   /** The proof manager */
   std::unique_ptr<ProofManager> d_proofManager;
 
@@ -1179,6 +1212,13 @@ class CVC4_PUBLIC SmtEngine
    */
   LogicInfo d_logic;
 
+  /**
+   * The theory that owns the uninterpreted sort in this SmtEngine, set by
+   * setDefaults() from the logic; theories see it while this SmtEngine is
+   * in scope (see SmtScope).
+   */
+  theory::TheoryId d_uninterpretedSortOwner;
+
   /**
    * Keep a copy of the original option settings (for reset()).
    */
@@ -46,6 +46,15 @@ ProofManager* currentProofManager() {
 #endif /* IS_PROOFS_BUILD */
 }
 
+theory::TheoryId currentUninterpretedSortOwner()
+{
+  if (s_smtEngine_current == NULL)
+  {
+    return theory::THEORY_UF;
+  }
+  return s_smtEngine_current->d_uninterpretedSortOwner;
+}
+
 SmtScope::SmtScope(const SmtEngine* smt)
     : NodeManagerScope(smt->d_nodeManager),
       d_oldSmtEngine(s_smtEngine_current) {
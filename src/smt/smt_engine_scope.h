@@ -21,6 +21,7 @@
 #define CVC4__SMT__SMT_ENGINE_SCOPE_H
 
 #include "expr/node_manager.h"
+#include "theory/theory_id.h"
 
 namespace CVC4 {
 
@@ -36,6 +37,12 @@ bool smtEngineInScope();
 // FIXME: Maybe move into SmtScope?
 ProofManager* currentProofManager();
 
+/**
+ * The theory that owns the uninterpreted sort in the SmtEngine in scope, or
+ * the UF theory if there is none.
+ */
+theory::TheoryId currentUninterpretedSortOwner();
+
 class SmtScope : public NodeManagerScope {
   /** The old NodeManager, to be restored on destruction. */
   SmtEngine* d_oldSmtEngine;
@@ -436,7 +436,7 @@ DeltaRational ErrorSet::computeDiff(ArithVar v) const{
 }
 
 void ErrorSet::debugPrint(std::ostream& out) const {
-  static int instance = 0;
+  static thread_local int instance = 0;
   ++instance;
   out << "error set debugprint " << instance << endl;
   for(error_iterator i = errorBegin(), i_end = errorEnd();
@@ -280,7 +280,7 @@ void LinearEqualityModule::pivotAndUpdate(ArithVar x_i, ArithVar x_j, const Delt
 
   TimerStat::CodeTimer codeTimer(d_statistics.d_pivotTime);
 
-  static int instance = 0;
+  static thread_local int instance = 0;
 
   if(Debug.isOn("arith::tracking::pre")){
     ++instance;
@@ -1154,7 +1154,7 @@ UpdateInfo LinearEqualityModule::speculativeUpdate(ArithVar nb, const Rational&
 
   int focusCoeffSgn = focusCoeff.sgn();
 
-  static int instance = 0;
+  static thread_local int instance = 0;
   ++instance;
   Debug("speculativeUpdate") << "speculativeUpdate " << instance << endl;
   Debug("speculativeUpdate") << "nb " << nb << endl;
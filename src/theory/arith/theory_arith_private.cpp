@@ -2147,7 +2147,7 @@ Node flattenAndSort(Node n){
 void TheoryArithPrivate::outputConflicts(){
   Debug("arith::conflict") << "outputting conflicts" << std::endl;
   Assert(anyConflict());
-  static unsigned int conflicts = 0;
+  static thread_local unsigned int conflicts = 0;
   
   if(!conflictQueueEmpty()){
     Assert(!d_conflicts.empty());
@@ -4985,7 +4985,7 @@ bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx){
   uint32_t rowLength = d_tableau.getRowLength(ridx);
 
   bool success = false;
-  static int instance = 0;
+  static thread_local int instance = 0;
   ++instance;
 
   Debug("arith::prop")
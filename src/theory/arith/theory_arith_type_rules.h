@@ -19,6 +19,8 @@
 #ifndef CVC4__THEORY__ARITH__THEORY_ARITH_TYPE_RULES_H
 #define CVC4__THEORY__ARITH__THEORY_ARITH_TYPE_RULES_H
 
+#include "expr/type_checker_util.h"
+
 namespace CVC4 {
 namespace theory {
 namespace arith {
@@ -41,8 +43,6 @@ class ArithOperatorTypeRule {
 public:
   inline static TypeNode computeType(NodeManager* nodeManager, TNode n, bool check)
   {
-    TypeNode integerType = nodeManager->integerType();
-    TypeNode realType = nodeManager->realType();
     TNode::iterator child_it = n.begin();
     TNode::iterator child_it_end = n.end();
     bool isInteger = true;
@@ -60,14 +60,42 @@ public:
         }
       }
     }
-    switch(Kind k = n.getKind()) {
-      case kind::TO_REAL:
-        return realType;
-      case kind::TO_INTEGER:
-        return integerType;
-      default: {
+    return resultType(nodeManager, n.getKind(), isInteger);
+  }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    bool isInteger = true;
+    for (TNode child : n)
+    {
+      TypeNode childType = expr::getCheckedType(nodeManager, child);
+      if (!childType.isInteger())
+      {
+        if (!childType.isReal())
+        {
+          return TypeNode::null();
+        }
+        isInteger = false;
+      }
+    }
+    return resultType(nodeManager, n.getKind(), isInteger);
+  }
+
+ private:
+  /** The type of a k-application whose arguments are all integers or not */
+  inline static TypeNode resultType(NodeManager* nodeManager,
+                                    Kind k,
+                                    bool isInteger)
+  {
+    switch (k)
+    {
+      case kind::TO_REAL: return nodeManager->realType();
+      case kind::TO_INTEGER: return nodeManager->integerType();
+      default:
+      {
         bool isDivision = k == kind::DIVISION || k == kind::DIVISION_TOTAL;
-        return (isInteger && !isDivision ? integerType : realType);
+        return isInteger && !isDivision ? nodeManager->integerType()
+                                        : nodeManager->realType();
       }
     }
   }
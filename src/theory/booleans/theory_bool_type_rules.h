@@ -19,6 +19,8 @@
 #ifndef CVC4__THEORY_BOOL_TYPE_RULES_H
 #define CVC4__THEORY_BOOL_TYPE_RULES_H
 
+#include "expr/type_checker_util.h"
+
 namespace CVC4 {
 namespace theory {
 namespace boolean {
@@ -42,6 +44,18 @@ public:
     }
     return booleanType;
   }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    for (TNode child : n)
+    {
+      if (!expr::getCheckedType(nodeManager, child).isBoolean())
+      {
+        return TypeNode::null();
+      }
+    }
+    return nodeManager->booleanType();
+  }
 };/* class BooleanTypeRule */
 
 class IteTypeRule {
@@ -68,6 +82,18 @@ public:
     }
     return iteType;
   }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    TypeNode thenType = expr::getCheckedType(nodeManager, n[1]);
+    if (thenType.isNull()
+        || expr::getCheckedType(nodeManager, n[2]) != thenType
+        || !expr::getCheckedType(nodeManager, n[0]).isBoolean())
+    {
+      return TypeNode::null();
+    }
+    return thenType;
+  }
 };/* class IteTypeRule */
 
 }/* CVC4::theory::boolean namespace */
@@ -21,6 +21,7 @@
 
 #include "expr/node.h"
 #include "expr/type_node.h"
+#include "expr/type_checker_util.h"
 #include "expr/expr.h"
 #include "theory/rewriter.h"
 #include "theory/builtin/theory_builtin_rewriter.h" // for array and lambda representation
@@ -58,6 +59,17 @@ class EqualityTypeRule {
     }
     return booleanType;
   }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    TypeNode lhsType = expr::getCheckedType(nodeManager, n[0]);
+    if (lhsType.isNull()
+        || expr::getCheckedType(nodeManager, n[1]) != lhsType)
+    {
+      return TypeNode::null();
+    }
+    return nodeManager->booleanType();
+  }
 };/* class EqualityTypeRule */
 
 
@@ -21,6 +21,8 @@
 #ifndef CVC4__THEORY__BV__THEORY_BV_TYPE_RULES_H
 #define CVC4__THEORY__BV__THEORY_BV_TYPE_RULES_H
 
+#include "expr/type_checker_util.h"
+
 namespace CVC4 {
 namespace theory {
 namespace bv {
@@ -93,6 +95,25 @@ class BitVectorFixedWidthTypeRule
     }
     return t;
   }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    TNode::iterator it = n.begin();
+    TypeNode t = expr::getCheckedType(nodeManager, *it);
+    if (!t.isBitVector())
+    {
+      return TypeNode::null();
+    }
+    TNode::iterator it_end = n.end();
+    for (++it; it != it_end; ++it)
+    {
+      if (expr::getCheckedType(nodeManager, *it) != t)
+      {
+        return TypeNode::null();
+      }
+    }
+    return t;
+  }
 }; /* class BitVectorFixedWidthTypeRule */
 
 /* -------------------------------------------------------------------------- */
@@ -120,6 +141,17 @@ class BitVectorPredicateTypeRule
     }
     return nodeManager->booleanType();
   }
+
+  inline static TypeNode computeTypeFast(NodeManager* nodeManager, TNode n)
+  {
+    TypeNode lhsType = expr::getCheckedType(nodeManager, n[0]);
+    if (!lhsType.isBitVector()
+        || expr::getCheckedType(nodeManager, n[1]) != lhsType)
+    {
+      return TypeNode::null();
+    }
+    return nodeManager->booleanType();
+  }
 }; /* class BitVectorPredicateTypeRule */
 
 class BitVectorUnaryPredicateTypeRule
@@ -43,10 +43,7 @@ Node SygusAbduct::mkAbductionConjecture(const std::string& name,
 {
   NodeManager* nm = NodeManager::currentNM();
   std::unordered_set<Node, NodeHashFunction> symset;
-  for (size_t i = 0, size = asserts.size(); i < size; i++)
-  {
-    expr::getSymbols(asserts[i], symset);
-  }
+  expr::getSymbols(asserts, symset);
   Trace("sygus-abduct-debug")
       << "...finish, got " << symset.size() << " symbols." << std::endl;
 
@@ -259,8 +259,8 @@ bool SygusRepairConst::repairSolution(Node sygusBody,
   Trace("cegqi-engine") << "Repairing previous solution..." << std::endl;
   // make the satisfiability query
   bool needExport = true;
-  ExprManagerMapCollection varMap;
   ExprManager em(nm->getOptions());
+  ExprManagerMapCollection varMap;
   std::unique_ptr<SmtEngine> repcChecker;
   initializeChecker(repcChecker, em, varMap, fo_body, needExport);
   Result r = repcChecker->checkSat();
@@ -20,6 +20,7 @@
 #include <map>
 #include <unordered_set>
 
+#include "context/cdtrail_hashmap.h"
 #include "expr/attribute.h"
 #include "expr/node_trie.h"
 #include "theory/quantifiers/quant_util.h"
@@ -73,7 +74,7 @@ class TermDb : public QuantifiersUtil {
   friend class ::CVC4::theory::quantifiers::ConjectureGenerator;
   friend class ::CVC4::theory::quantifiers::TermGenEnv;
   typedef context::CDHashMap<Node, int, NodeHashFunction> NodeIntMap;
-  typedef context::CDHashMap<Node, bool, NodeHashFunction> NodeBoolMap;
+  typedef context::CDTrailHashMap<Node, bool, NodeHashFunction> NodeBoolMap;
 
  public:
   TermDb(context::Context* c, context::UserContext* u, QuantifiersEngine* qe);
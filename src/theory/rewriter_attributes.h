@@ -29,8 +29,20 @@ struct RewriteCacheTag {};
 template <theory::TheoryId theoryId>
 struct RewriteAttibute {
 
-  typedef expr::Attribute< RewriteCacheTag<true, theoryId>, Node> pre_rewrite;
-  typedef expr::Attribute< RewriteCacheTag<false, theoryId>, Node> post_rewrite;
+  /**
+   * The rewrite caches are read for every node the rewriter visits, so
+   * they are stored densely, indexed by node id.
+   */
+  typedef expr::Attribute<RewriteCacheTag<true, theoryId>,
+                          Node,
+                          false,
+                          expr::attr::AttrStorageDense>
+      pre_rewrite;
+  typedef expr::Attribute<RewriteCacheTag<false, theoryId>,
+                          Node,
+                          false,
+                          expr::attr::AttrStorageDense>
+      post_rewrite;
 
   /**
    * Get the value of the pre-rewrite cache.
@@ -54,6 +54,19 @@ void initializeSubsolverWithExport(std::unique_ptr<SmtEngine>& smte,
                                    Node query,
                                    bool needsTimeout,
                                    unsigned long timeout)
+{
+  std::vector<Node> assertions;
+  assertions.push_back(query);
+  initializeSubsolverWithExport(
+      smte, em, varMap, assertions, needsTimeout, timeout);
+}
+
+void initializeSubsolverWithExport(std::unique_ptr<SmtEngine>& smte,
+                                   ExprManager& em,
+                                   ExprManagerMapCollection& varMap,
+                                   const std::vector<Node>& assertions,
+                                   bool needsTimeout,
+                                   unsigned long timeout)
 {
   // To support a separate timeout for the subsolver, we need to use
   // a separate ExprManager with its own options. This requires that
@@ -69,13 +82,21 @@ void initializeSubsolverWithExport(std::unique_ptr<SmtEngine>& smte,
       smte->setTimeLimit(timeout, true);
     }
     smte->setLogic(smt::currentSmtEngine()->getLogicInfo());
-    Expr equery = query.toExpr().exportTo(&em, varMap);
-    smte->assertFormula(equery);
+    std::vector<Expr> eassertions;
+    eassertions.reserve(assertions.size());
+    for (const Node& a : assertions)
+    {
+      eassertions.push_back(a.toExpr());
+    }
+    for (const Expr& ea : Expr::exportTo(eassertions, &em, varMap))
+    {
+      smte->assertFormula(ea);
+    }
   }
   catch (const CVC4::ExportUnsupportedException& e)
   {
     std::stringstream msg;
-    msg << "Unable to export " << query
+    msg << "Unable to export " << assertions
         << " but exporting expressions is "
            "required for a subsolver.";
     throw OptionException(msg.str());
@@ -130,10 +151,11 @@ Result checkWithSubsolver(Node query,
     }
     return r;
   }
-  std::unique_ptr<SmtEngine> smte;
-  ExprManagerMapCollection varMap;
   NodeManager* nm = NodeManager::currentNM();
   ExprManager em(nm->getOptions());
+  // destroyed before em, since it holds expressions of em
+  ExprManagerMapCollection varMap;
+  std::unique_ptr<SmtEngine> smte;
   bool needsExport = false;
   if (needsTimeout)
   {
@@ -148,17 +170,22 @@ Result checkWithSubsolver(Node query,
   r = smte->checkSat();
   if (r.asSatisfiabilityResult().isSat() == Result::SAT)
   {
+    std::vector<Expr> evars;
     for (const Node& v : vars)
     {
-      Expr val;
+      evars.push_back(v.toExpr());
+    }
+    if (needsExport)
+    {
+      // the variables of the query are already translated in varMap
+      evars = Expr::exportTo(evars, &em, varMap);
+    }
+    for (const Expr& ev : evars)
+    {
+      Expr val = smte->getValue(ev);
       if (needsExport)
       {
-        Expr ev = v.toExpr().exportTo(&em, varMap);
-        val = smte->getValue(ev).exportTo(nm->toExprManager(), varMap);
-      }
-      else
-      {
-        val = smte->getValue(v.toExpr());
+        val = val.exportTo(nm->toExprManager(), varMap);
       }
       modelVals.push_back(Node::fromExpr(val));
     }
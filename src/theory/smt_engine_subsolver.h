@@ -65,6 +65,20 @@ void initializeSubsolverWithExport(std::unique_ptr<SmtEngine>& smte,
                                    bool needsTimeout = false,
                                    unsigned long timeout = 0);
 
+/**
+ * Same as above, but asserts all formulas of assertions in smte. The
+ * formulas are exported to em in one pass over their subterms. Subterms
+ * that were exported with varMap before are not translated again, so a
+ * caller that checks several related queries may keep em and varMap (which
+ * must be destroyed before em) across calls.
+ */
+void initializeSubsolverWithExport(std::unique_ptr<SmtEngine>& smte,
+                                   ExprManager& em,
+                                   ExprManagerMapCollection& varMap,
+                                   const std::vector<Node>& assertions,
+                                   bool needsTimeout = false,
+                                   unsigned long timeout = 0);
+
 /**
  * This function initializes the smt engine smte to check the satisfiability
  * of the argument "query", without exporting expressions.
@@ -20,6 +20,7 @@
 
 #include "context/cdhashset.h"
 #include "context/cdlist.h"
+#include "context/cdtrail_hashmap.h"
 #include "theory/strings/base_solver.h"
 #include "theory/strings/infer_info.h"
 #include "theory/strings/inference_manager.h"
@@ -39,7 +40,7 @@ namespace strings {
 class CoreSolver
 {
   friend class InferenceManager;
-  typedef context::CDHashMap<Node, int, NodeHashFunction> NodeIntMap;
+  typedef context::CDTrailHashMap<Node, int, NodeHashFunction> NodeIntMap;
 
  public:
   CoreSolver(context::Context* c,
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "context/cdhashset.h"
+#include "context/cdtrail_hashmap.h"
 #include "context/context.h"
 #include "expr/node.h"
 #include "theory/output_channel.h"
@@ -69,7 +70,7 @@ class TheoryStrings;
 class InferenceManager
 {
   typedef context::CDHashSet<Node, NodeHashFunction> NodeSet;
-  typedef context::CDHashMap<Node, Node, NodeHashFunction> NodeNodeMap;
+  typedef context::CDTrailHashMap<Node, Node, NodeHashFunction> NodeNodeMap;
 
  public:
   InferenceManager(TheoryStrings& p,
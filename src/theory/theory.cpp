@@ -24,6 +24,7 @@
 #include "base/check.h"
 #include "expr/node_algorithm.h"
 #include "options/theory_options.h"
+#include "smt/smt_engine_scope.h"
 #include "smt/smt_statistics_registry.h"
 #include "theory/ext_theory.h"
 #include "theory/quantifiers_engine.h"
@@ -34,8 +35,10 @@ using namespace std;
 namespace CVC4 {
 namespace theory {
 
-/** Default value for the uninterpreted sorts is the UF theory */
-TheoryId Theory::s_uninterpretedSortOwner = THEORY_UF;
+TheoryId Theory::getUninterpretedSortOwner()
+{
+  return smt::currentUninterpretedSortOwner();
+}
 
 std::ostream& operator<<(std::ostream& os, Theory::Effort level){
   switch(level){
@@ -130,7 +133,7 @@ TheoryId Theory::theoryOf(options::TheoryOfMode mode, TNode node)
         if (Theory::theoryOf(node.getType()) != theory::THEORY_BOOL)
         {
           // We treat the variables as uninterpreted
-          tid = s_uninterpretedSortOwner;
+          tid = getUninterpretedSortOwner();
         }
         else
         {
@@ -241,11 +241,6 @@ private:
     return d_logicInfo;
   }
 
-  /**
-   * The theory that owns the uninterpreted sort.
-   */
-  static TheoryId s_uninterpretedSortOwner;
-
   void printFacts(std::ostream& os) const;
   void debugPrintFacts() const;
 
@@ -263,8 +258,9 @@ public:
       id = kindToTheoryId(typeNode.getKind());
     }
     if (id == THEORY_BUILTIN) {
-      Trace("theory::internal") << "theoryOf(" << typeNode << ") == " << s_uninterpretedSortOwner << std::endl;
-      return s_uninterpretedSortOwner;
+      id = getUninterpretedSortOwner();
+      Trace("theory::internal") << "theoryOf(" << typeNode << ") == " << id << std::endl;
+      return id;
     }
     return id;
   }
@@ -282,18 +278,11 @@ public:
   }
 
   /**
-   * Set the owner of the uninterpreted sort.
-   */
-  static void setUninterpretedSortOwner(TheoryId theory) {
-    s_uninterpretedSortOwner = theory;
-  }
-
-  /**
-   * Get the owner of the uninterpreted sort.
+   * Get the owner of the uninterpreted sort. This is decided per SmtEngine
+   * (see SmtEngine::setDefaults()) and read from the one in scope; it is the
+   * UF theory if no SmtEngine is in scope.
    */
-  static TheoryId getUninterpretedSortOwner() {
-    return s_uninterpretedSortOwner;
-  }
+  static TheoryId getUninterpretedSortOwner();
 
   /**
    * Checks if the node is a leaf node of this theory
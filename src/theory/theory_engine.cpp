@@ -136,6 +136,10 @@ theory::LemmaStatus TheoryEngine::EngineOutputChannel::lemma(TNode lemma,
                          << lemma << ")"
                          << ", preprocess = " << preprocess << std::endl;
   ++d_statistics.lemmas;
+  if (removable)
+  {
+    ++d_statistics.removableLemmas;
+  }
   d_engine->d_outputChannelUsed = true;
 
   PROOF({ registerLemmaRecipe(lemma, lemma, preprocess, d_theory); });
@@ -236,6 +240,10 @@ theory::LemmaStatus TheoryEngine::EngineOutputChannel::splitLemma(
   Debug("theory::lemma") << "EngineOutputChannel<" << d_theory << ">::lemma("
                          << lemma << ")" << std::endl;
   ++d_statistics.lemmas;
+  if (removable)
+  {
+    ++d_statistics.removableLemmas;
+  }
   d_engine->d_outputChannelUsed = true;
 
   Debug("pf::explain") << "TheoryEngine::EngineOutputChannel::splitLemma( "
@@ -2391,13 +2399,15 @@ TheoryEngine::Statistics::Statistics(theory::TheoryId theory):
     propagations(getStatsPrefix(theory) + "::propagations", 0),
     lemmas(getStatsPrefix(theory) + "::lemmas", 0),
     requirePhase(getStatsPrefix(theory) + "::requirePhase", 0),
-    restartDemands(getStatsPrefix(theory) + "::restartDemands", 0)
+    restartDemands(getStatsPrefix(theory) + "::restartDemands", 0),
+    removableLemmas(getStatsPrefix(theory) + "::removableLemmas", 0)
 {
   smtStatisticsRegistry()->registerStat(&conflicts);
   smtStatisticsRegistry()->registerStat(&propagations);
   smtStatisticsRegistry()->registerStat(&lemmas);
   smtStatisticsRegistry()->registerStat(&requirePhase);
   smtStatisticsRegistry()->registerStat(&restartDemands);
+  smtStatisticsRegistry()->registerStat(&removableLemmas);
 }
 
 TheoryEngine::Statistics::~Statistics() {
@@ -2406,6 +2416,7 @@ TheoryEngine::Statistics::~Statistics() {
   smtStatisticsRegistry()->unregisterStat(&lemmas);
   smtStatisticsRegistry()->unregisterStat(&requirePhase);
   smtStatisticsRegistry()->unregisterStat(&restartDemands);
+  smtStatisticsRegistry()->unregisterStat(&removableLemmas);
 }
 
 }/* CVC4 namespace */
@@ -28,6 +28,7 @@
 
 #include "base/check.h"
 #include "context/cdhashset.h"
+#include "context/cdtrail_hashmap.h"
 #include "expr/node.h"
 #include "options/options.h"
 #include "options/smt_options.h"
@@ -250,6 +251,8 @@ class TheoryEngine {
 
    public:
     IntStat conflicts, propagations, lemmas, requirePhase, restartDemands;
+    /** The lemmas the SAT solver may drop as duplicates, or evict */
+    IntStat removableLemmas;
 
     Statistics(theory::TheoryId theory);
     ~Statistics();
@@ -384,7 +387,10 @@ class TheoryEngine {
   /**
    * Mapping of propagations from recievers to senders.
    */
-  typedef context::CDHashMap<NodeTheoryPair, NodeTheoryPair, NodeTheoryPairHashFunction> PropagationMap;
+  typedef context::CDTrailHashMap<NodeTheoryPair,
+                                  NodeTheoryPair,
+                                  NodeTheoryPairHashFunction>
+      PropagationMap;
   PropagationMap d_propagationMap;
 
   /**
@@ -698,10 +704,19 @@ public:
   void notifyRestart();
 
   void getPropagatedLiterals(std::vector<TNode>& literals) {
-    for (; d_propagatedLiteralsIndex < d_propagatedLiterals.size(); d_propagatedLiteralsIndex = d_propagatedLiteralsIndex + 1) {
-      Debug("getPropagatedLiterals") << "TheoryEngine::getPropagatedLiterals: propagating: " << d_propagatedLiterals[d_propagatedLiteralsIndex] << std::endl;
-      literals.push_back(d_propagatedLiterals[d_propagatedLiteralsIndex]);
+    // The literals are handed over in one batch, the context-dependent index
+    // being set once
+    unsigned index = d_propagatedLiteralsIndex;
+    unsigned size = d_propagatedLiterals.size();
+    if (index == size) {
+      return;
     }
+    literals.reserve(literals.size() + size - index);
+    for (; index < size; ++index) {
+      Debug("getPropagatedLiterals") << "TheoryEngine::getPropagatedLiterals: propagating: " << d_propagatedLiterals[index] << std::endl;
+      literals.push_back(d_propagatedLiterals[index]);
+    }
+    d_propagatedLiteralsIndex = index;
   }
 
   /**
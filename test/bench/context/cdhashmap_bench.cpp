@@ -0,0 +1,98 @@
+/*********************                                                        */
+/*! \file cdhashmap_bench.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Microbenchmark of CDHashMap against CDTrailHashMap
+ **
+ ** Drives both maps through the same search-like trace: each decision
+ ** pushes a level, inserts and updates a few keys and looks up some more,
+ ** and every so often the search backjumps over several levels.  The maps
+ ** must agree on every lookup; the program fails if they do not.
+ **
+ ** Usage: cdhashmap_bench [decisions]
+ **/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "context/cdhashmap.h"
+#include "context/cdtrail_hashmap.h"
+#include "context/context.h"
+
+using namespace CVC4::context;
+
+namespace {
+
+/** Run the trace on Map, returning a checksum of the lookups */
+template <class Map>
+uint64_t runTrace(unsigned decisions, double& seconds)
+{
+  Context context;
+  Map map(&context);
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<uint32_t> key(0, 1 << 16);
+  uint64_t checksum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned d = 0; d < decisions; ++d)
+  {
+    context.push();
+    for (unsigned i = 0; i < 8; ++i)
+    {
+      uint32_t k = key(rng);
+      map[k] = d;
+    }
+    for (unsigned i = 0; i < 2; ++i)
+    {
+      map.insert(key(rng), i);
+    }
+    for (unsigned i = 0; i < 32; ++i)
+    {
+      typename Map::const_iterator it = map.find(key(rng));
+      if (it != map.end())
+      {
+        checksum = checksum * 31 + (*it).second;
+      }
+    }
+    // backjump over a few levels every 16 decisions
+    if (d % 16 == 15)
+    {
+      int level = context.getLevel() - 1 - static_cast<int>(rng() % 24);
+      context.popto(level < 0 ? 0 : level);
+    }
+    checksum = checksum * 31 + map.size();
+  }
+  context.popto(0);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  seconds = elapsed.count();
+  return checksum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned decisions = argc > 1 ? std::atoi(argv[1]) : 200000;
+  double cdhashmap, cdtrail;
+  uint64_t c1 = runTrace<CDHashMap<uint32_t, uint32_t>>(decisions, cdhashmap);
+  uint64_t c2 =
+      runTrace<CDTrailHashMap<uint32_t, uint32_t>>(decisions, cdtrail);
+  std::cout << "decisions       " << decisions << std::endl
+            << "CDHashMap       " << cdhashmap << " s" << std::endl
+            << "CDTrailHashMap  " << cdtrail << " s" << std::endl;
+  if (c1 != c2)
+  {
+    std::cerr << "the maps disagree" << std::endl;
+    return 1;
+  }
+  return 0;
+}
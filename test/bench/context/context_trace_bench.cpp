@@ -0,0 +1,267 @@
+/*********************                                                        */
+/*! \file context_trace_bench.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Replay of context push/pop traces on the context-dependent
+ ** data structures
+ **
+ ** Replays a push/pop trace on each context-dependent data structure in
+ ** turn.  The trace is the one written by cvc4 --context-trace=FILE: each
+ ** level pushed by the trace is filled with as many updates as the number
+ ** of objects the solver restored when popping it.  Without a trace file, a
+ ** synthetic trace shaped like a DPLL search is used: decisions push a
+ ** level, and every so often the search backjumps over several levels.
+ **
+ ** Usage: context_trace_bench [trace-file]
+ **/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "context/cdhashmap.h"
+#include "context/cdinsert_hashmap.h"
+#include "context/cdlist.h"
+#include "context/cdo.h"
+#include "context/cdqueue.h"
+#include "context/cdtrail_hashmap.h"
+#include "context/context.h"
+
+using namespace CVC4::context;
+
+namespace {
+
+/** A pop of the trace */
+const int kPop = -1;
+
+/**
+ * A trace, as a list of events: kPop, or the number of updates to do at a
+ * pushed level.
+ */
+typedef std::vector<int> PushPopTrace;
+
+/** Read the trace written by --context-trace, returns false on failure */
+bool readTrace(const char* file, PushPopTrace& trace)
+{
+  std::ifstream in(file);
+  if (!in.good())
+  {
+    return false;
+  }
+  std::vector<size_t> pushes;
+  std::string event;
+  while (in >> event)
+  {
+    if (event == "push")
+    {
+      pushes.push_back(trace.size());
+      trace.push_back(0);
+    }
+    else if (event == "pop")
+    {
+      int restored;
+      if (!(in >> restored) || pushes.empty())
+      {
+        return false;
+      }
+      trace[pushes.back()] = restored;
+      pushes.pop_back();
+      trace.push_back(kPop);
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** A DPLL-like trace with the given number of decisions */
+PushPopTrace syntheticTrace(unsigned decisions)
+{
+  PushPopTrace trace;
+  std::mt19937 rng(42);
+  std::geometric_distribution<int> updates(1.0 / 12);
+  int level = 0;
+  for (unsigned d = 0; d < decisions; ++d)
+  {
+    trace.push_back(updates(rng));
+    ++level;
+    // backjump over a few levels every 16 decisions
+    if (d % 16 == 15)
+    {
+      for (int n = 1 + rng() % 24; n > 0 && level > 0; --n, --level)
+      {
+        trace.push_back(kPop);
+      }
+    }
+  }
+  return trace;
+}
+
+/**
+ * Replay the trace, calling Driver::update(i) for each of the n updates of
+ * a level, and return the time taken.
+ */
+template <class Driver>
+double replay(const PushPopTrace& trace)
+{
+  Context context;
+  Driver driver(&context);
+  auto start = std::chrono::steady_clock::now();
+  for (int event : trace)
+  {
+    if (event == kPop)
+    {
+      context.pop();
+      continue;
+    }
+    context.push();
+    for (int i = 0; i < event; ++i)
+    {
+      driver.update(i);
+    }
+  }
+  context.popto(0);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+/** Updates distinct CDOs of a pool, so that each update is one restore */
+class CDODriver
+{
+ public:
+  CDODriver(Context* c) : d_next(0)
+  {
+    for (unsigned i = 0; i < kPoolSize; ++i)
+    {
+      d_pool.push_back(new (true) CDO<uint32_t>(c, 0));
+    }
+  }
+  ~CDODriver()
+  {
+    for (CDO<uint32_t>* cdo : d_pool)
+    {
+      cdo->deleteSelf();
+    }
+  }
+  void update(int i)
+  {
+    *d_pool[d_next] = i;
+    d_next = (d_next + 1) % kPoolSize;
+  }
+
+ private:
+  static const unsigned kPoolSize = 1 << 12;
+  std::vector<CDO<uint32_t>*> d_pool;
+  unsigned d_next;
+};
+
+class CDListDriver
+{
+ public:
+  CDListDriver(Context* c) : d_list(c) {}
+  void update(int i) { d_list.push_back(i); }
+
+ private:
+  CDList<uint32_t> d_list;
+};
+
+class CDQueueDriver
+{
+ public:
+  CDQueueDriver(Context* c) : d_queue(c) {}
+  void update(int i)
+  {
+    d_queue.push(i);
+    if (i % 2 == 1)
+    {
+      d_queue.pop();
+    }
+  }
+
+ private:
+  CDQueue<uint32_t> d_queue;
+};
+
+/** Inserts and updates random keys of a map */
+template <class Map>
+class MapDriver
+{
+ public:
+  MapDriver(Context* c) : d_map(c), d_rng(42), d_key(0, 1 << 16) {}
+  void update(int i) { d_map[d_key(d_rng)] = i; }
+
+ private:
+  Map d_map;
+  std::mt19937 d_rng;
+  std::uniform_int_distribution<uint32_t> d_key;
+};
+
+/** Inserts fresh keys, since a CDInsertHashMap cannot update its keys */
+class CDInsertHashMapDriver
+{
+ public:
+  CDInsertHashMapDriver(Context* c) : d_map(c), d_next(0) {}
+  void update(int i) { d_map.insert(d_next++, i); }
+
+ private:
+  CDInsertHashMap<uint32_t, uint32_t> d_map;
+  uint32_t d_next;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  PushPopTrace trace;
+  if (argc > 1)
+  {
+    if (!readTrace(argv[1], trace))
+    {
+      std::cerr << "cannot read the trace " << argv[1] << std::endl;
+      return 1;
+    }
+  }
+  else
+  {
+    trace = syntheticTrace(200000);
+  }
+  uint64_t pushes = 0, updates = 0;
+  for (int event : trace)
+  {
+    if (event != kPop)
+    {
+      ++pushes;
+      updates += event;
+    }
+  }
+  std::cout << "pushes           " << pushes << std::endl
+            << "updates          " << updates << std::endl
+            << "CDO              " << replay<CDODriver>(trace) << " s"
+            << std::endl
+            << "CDList           " << replay<CDListDriver>(trace) << " s"
+            << std::endl
+            << "CDQueue          " << replay<CDQueueDriver>(trace) << " s"
+            << std::endl
+            << "CDHashMap        "
+            << replay<MapDriver<CDHashMap<uint32_t, uint32_t>>>(trace) << " s"
+            << std::endl
+            << "CDTrailHashMap   "
+            << replay<MapDriver<CDTrailHashMap<uint32_t, uint32_t>>>(trace)
+            << " s" << std::endl
+            << "CDInsertHashMap  " << replay<CDInsertHashMapDriver>(trace)
+            << " s" << std::endl;
+  return 0;
+}
@@ -0,0 +1,138 @@
+/*********************                                                        */
+/*! \file node_value_pool_bench.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Microbenchmark of NodeValuePool against std::unordered_set
+ **
+ ** Makes the given number of distinct nodes, then runs both sets, with the
+ ** hash and equality of the NodeManager pool, through the same rounds: each
+ ** round looks up every node in a random order and inserts it if it is
+ ** missing, as NodeBuilder does, then removes half of the nodes, as the
+ ** collection of zombies does.  The sets must agree on every lookup; the
+ ** program fails if they do not.
+ **
+ ** Usage: node_value_pool_bench [nodes] [rounds]
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "expr/node_value.h"
+#include "expr/node_value_pool.h"
+
+using namespace CVC4;
+using namespace CVC4::expr;
+
+namespace {
+
+/** An std::unordered_set with the interface of NodeValuePool */
+class UnorderedSetPool
+{
+ public:
+  NodeValue* find(const NodeValue* nv) const
+  {
+    std::unordered_set<NodeValue*,
+                       NodeValuePoolHashFunction,
+                       NodeValuePoolEq>::const_iterator it =
+        d_set.find(const_cast<NodeValue*>(nv));
+    return it == d_set.end() ? nullptr : *it;
+  }
+  void insert(NodeValue* nv) { d_set.insert(nv); }
+  void erase(NodeValue* nv) { d_set.erase(nv); }
+  size_t size() const { return d_set.size(); }
+
+ private:
+  std::unordered_set<NodeValue*, NodeValuePoolHashFunction, NodeValuePoolEq>
+      d_set;
+};
+
+/** Run the rounds on Pool, returning a checksum of the lookups */
+template <class Pool>
+uint64_t runRounds(const std::vector<NodeValue*>& nvs,
+                   unsigned rounds,
+                   double& seconds)
+{
+  Pool pool;
+  std::mt19937 rng(42);
+  std::vector<NodeValue*> order(nvs);
+  uint64_t checksum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned r = 0; r < rounds; ++r)
+  {
+    std::shuffle(order.begin(), order.end(), rng);
+    for (NodeValue* nv : order)
+    {
+      if (pool.find(nv) == nullptr)
+      {
+        pool.insert(nv);
+        ++checksum;
+      }
+    }
+    for (size_t i = 0; i < order.size() / 2; ++i)
+    {
+      pool.erase(order[i]);
+    }
+    checksum = checksum * 31 + pool.size();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  seconds = elapsed.count();
+  return checksum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned nodes = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  unsigned rounds = argc > 2 ? std::atoi(argv[2]) : 3;
+  NodeManager nm(nullptr);
+  NodeManagerScope scope(&nm);
+
+  // binary sums over a few variables, as in arithmetic problems
+  std::vector<Node> vars;
+  for (unsigned i = 0; i < 2048; ++i)
+  {
+    vars.push_back(nm.mkSkolem("x", nm.integerType()));
+  }
+  std::vector<Node> ns;
+  for (unsigned i = 0; ns.size() < nodes; ++i)
+  {
+    ns.push_back(nm.mkNode(kind::PLUS,
+                           vars[i % vars.size()],
+                           vars[(i / vars.size()) % vars.size()]));
+  }
+  std::vector<NodeValue*> nvs;
+  for (const Node& n : ns)
+  {
+    nvs.push_back(n.d_nv);
+  }
+
+  double pool, set;
+  uint64_t c1 = runRounds<NodeValuePool>(nvs, rounds, pool);
+  uint64_t c2 = runRounds<UnorderedSetPool>(nvs, rounds, set);
+  std::cout << "nodes               " << nodes << std::endl
+            << "rounds              " << rounds << std::endl
+            << "NodeValuePool       " << pool << " s" << std::endl
+            << "std::unordered_set  " << set << " s" << std::endl;
+  if (c1 != c2)
+  {
+    std::cerr << "the sets disagree" << std::endl;
+    return 1;
+  }
+  return 0;
+}
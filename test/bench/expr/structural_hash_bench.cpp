@@ -0,0 +1,199 @@
+/*********************                                                        */
+/*! \file structural_hash_bench.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Microbenchmark of cross-NodeManager lookups by structural hash
+ **
+ ** Builds the same random arithmetic DAG in two NodeManagers, declaring the
+ ** variables in the same order, and indexes the nodes of the first one by
+ ** content.  Then it looks up nodes of the second one in the index, once
+ ** with the hash stored in each NodeValue, and once with a content hash
+ ** computed by a memoized traversal of the query, as a cache has to do
+ ** without the stored hash.  Both must find the same nodes; the program
+ ** fails if they do not.
+ **
+ ** Usage: structural_hash_bench [nodes] [queries]
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "expr/node_manager_attributes.h"
+#include "expr/node_value.h"
+
+using namespace CVC4;
+
+namespace {
+
+typedef std::unordered_map<TNode, uint64_t, TNodeHashFunction> HashCache;
+
+/** The number of variables at the leaves of the DAG */
+const unsigned s_numVars = 64;
+
+/** Build a random DAG of the given number of nodes in nm */
+std::vector<Node> buildDag(NodeManager* nm, unsigned nodes)
+{
+  NodeManagerScope scope(nm);
+  std::vector<Node> dag;
+  for (unsigned i = 0; i < s_numVars; ++i)
+  {
+    dag.push_back(
+        nm->mkBoundVar("x" + std::to_string(i), nm->integerType()));
+  }
+  std::mt19937 rng(42);
+  while (dag.size() < nodes)
+  {
+    // favour recent nodes, so that the DAG is deep
+    size_t n = dag.size();
+    size_t a = n - 1 - rng() % std::min<size_t>(n, 16);
+    size_t b = rng() % n;
+    Kind k = rng() % 2 ? kind::PLUS : kind::MULT;
+    dag.push_back(nm->mkNode(k, dag[a], dag[b]));
+  }
+  return dag;
+}
+
+/**
+ * The content hash of n, from its kind, the names of its variables and the
+ * content hashes of its children, memoized in cache.
+ */
+uint64_t contentHash(TNode n, HashCache& cache)
+{
+  std::vector<TNode> visit{n};
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    if (cache.find(cur) != cache.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    uint64_t h = cur.getKind();
+    bool ready = true;
+    for (TNode cn : cur)
+    {
+      HashCache::iterator it = cache.find(cn);
+      if (it == cache.end())
+      {
+        visit.push_back(cn);
+        ready = false;
+      }
+      else if (ready)
+      {
+        h = expr::NodeValue::hashCombine(h, it->second);
+      }
+    }
+    if (!ready)
+    {
+      continue;
+    }
+    if (cur.getNumChildren() == 0)
+    {
+      std::string name;
+      cur.getAttribute(expr::VarNameAttr(), name);
+      h = expr::NodeValue::hashCombine(h, std::hash<std::string>()(name));
+    }
+    cache[cur] = expr::NodeValue::hashMix(h);
+    visit.pop_back();
+  }
+  return cache[n];
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned nodes = argc > 1 ? std::atoi(argv[1]) : 200000;
+  unsigned queries = argc > 2 ? std::atoi(argv[2]) : 200;
+  NodeManager nm1(nullptr);
+  NodeManager nm2(nullptr);
+  std::vector<Node> dag1 = buildDag(&nm1, nodes);
+  std::vector<Node> dag2 = buildDag(&nm2, nodes);
+
+  std::mt19937 rng(7);
+  std::vector<size_t> qs;
+  for (unsigned i = 0; i < queries; ++i)
+  {
+    qs.push_back(rng() % dag2.size());
+  }
+
+  // with the stored hashes
+  uint64_t c1 = 0;
+  double stored;
+  {
+    NodeManagerScope scope(&nm1);
+    std::unordered_map<uint64_t, size_t> index;
+    for (size_t i = 0; i < dag1.size(); ++i)
+    {
+      index.emplace(dag1[i].getStructuralHash(), i);
+    }
+    NodeManagerScope scope2(&nm2);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t q : qs)
+    {
+      std::unordered_map<uint64_t, size_t>::iterator it =
+          index.find(dag2[q].getStructuralHash());
+      c1 = c1 * 31 + (it == index.end() ? 0 : it->second + 1);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    stored = elapsed.count();
+  }
+
+  // with content hashes computed per query
+  uint64_t c2 = 0;
+  double computed;
+  {
+    NodeManagerScope scope(&nm1);
+    std::unordered_map<uint64_t, size_t> index;
+    HashCache cache1;
+    for (size_t i = 0; i < dag1.size(); ++i)
+    {
+      index.emplace(contentHash(dag1[i], cache1), i);
+    }
+    NodeManagerScope scope2(&nm2);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t q : qs)
+    {
+      HashCache cache2;
+      std::unordered_map<uint64_t, size_t>::iterator it =
+          index.find(contentHash(dag2[q], cache2));
+      c2 = c2 * 31 + (it == index.end() ? 0 : it->second + 1);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    computed = elapsed.count();
+  }
+
+  std::cout << "nodes           " << nodes << std::endl
+            << "queries         " << queries << std::endl
+            << "stored hash     " << stored << " s" << std::endl
+            << "computed hash   " << computed << " s" << std::endl;
+  if (c1 != c2)
+  {
+    std::cerr << "the lookups disagree" << std::endl;
+    return 1;
+  }
+  {
+    NodeManagerScope scope(&nm1);
+    dag1.clear();
+  }
+  NodeManagerScope scope(&nm2);
+  dag2.clear();
+  return 0;
+}
@@ -0,0 +1,20 @@
+; COMMAND-LINE: --portfolio=2 --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; Each check-sat of the portfolio runs on a fresh thread; the uninterpreted
+; sorts must still be owned by the theory of arrays there.
+(set-logic QF_AX)
+(declare-sort Index 0)
+(declare-sort Element 0)
+(declare-fun a () (Array Index Element))
+(declare-fun b () (Array Index Element))
+(declare-fun i () Index)
+(declare-fun j () Index)
+(declare-fun e () Element)
+(assert (= b (store a i e)))
+(assert (not (= a b)))
+(check-sat)
+(push 1)
+(assert (= (select a i) e))
+(check-sat)
+(pop 1)
@@ -0,0 +1,34 @@
+; REQUIRES: cadical-dpll
+; COMMAND-LINE: --incremental --sat-solver=cadical
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun f (U) U)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(assert (or p q))
+(assert (=> p (= (f a) b)))
+(assert (=> q (= (f a) c)))
+(check-sat)
+(push 1)
+(assert (not (= b c)))
+(assert (= b (f a)))
+(assert (= c (f a)))
+(check-sat)
+(pop 1)
+(check-sat)
+(push 1)
+(assert (not p))
+(push 1)
+(assert (not q))
+(check-sat)
+(pop 1)
+(check-sat)
+(pop 1)
@@ -0,0 +1,26 @@
+; REQUIRES: cadical-dpll
+; COMMAND-LINE: --incremental --sat-solver=cadical
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+; The branching lemmas of the integers are added at the user levels of the
+; pushes, and must be forgotten by the pops.
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (and (> (* 2 x) 1) (< (* 2 x) 7)))
+(assert (and (> (* 3 y) 2) (< (* 3 y) 10)))
+(check-sat)
+(push 1)
+(assert (= (+ (* 2 x) (* 4 y)) 7))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= (+ x y) 5))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (> (+ x y) 6))
+(check-sat)
+(pop 1)
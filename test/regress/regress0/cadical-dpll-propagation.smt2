@@ -0,0 +1,23 @@
+; REQUIRES: cadical-dpll
+; COMMAND-LINE: --incremental --sat-solver=cadical
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; Arithmetic propagates the bounds on x and y to the SAT solver, which asks
+; for their explanations in conflicts.
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (>= x 2))
+(assert (or (< y 1) (>= y 3)))
+(assert (or (< x 1) (< z 0) (> (+ x y) 6)))
+(assert (or (< x 0) (>= z 0)))
+(check-sat)
+(push 1)
+(assert (< y 3))
+(assert (< x 4))
+(assert (or (< x 1) (>= y 1)))
+(check-sat)
+(pop 1)
+(check-sat)
@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental --cnf-gate-hashing
+; COMMAND-LINE: --incremental --cnf-gate-hashing --cnf-polarity
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (or (and (< x y) (< y z)) (and (< y z) (< x y))))
+(check-sat)
+(push 1)
+(assert (or (and (< z (+ x 2)) (not (< z (+ x 2)))) (< z (+ x 2))))
+(check-sat)
+(pop 1)
+(assert (or (and (= z 5) (= z 5)) (and (not (= x 1)) (= x 1))))
+(check-sat)
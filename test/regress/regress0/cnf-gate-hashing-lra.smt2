@@ -0,0 +1,17 @@
+; COMMAND-LINE: --incremental --cnf-gate-hashing
+; COMMAND-LINE: --incremental --cnf-gate-hashing --cnf-polarity
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (or (and (< x y) (< y z))
+            (and (< y z) (< x y))
+            (and (< z x) (not (or (< x y) (< x 0.0))))))
+(assert (or (and (< x y) (not (< x y))) (>= x 0.0)))
+(check-sat)
+(assert (not (and (< y z) (< x y))))
+(assert (or (and (< y z) (< z x)) (and (< z x) (< y z) (not (< z x)))))
+(assert (or (not (< y z)) (and (< x y) (< x y))))
+(check-sat)
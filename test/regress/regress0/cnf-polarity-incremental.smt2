@@ -0,0 +1,24 @@
+; COMMAND-LINE: --incremental --cnf-polarity --cnf-gate-hashing
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun f (U) U)
+(declare-fun x () U)
+(declare-fun y () U)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(declare-fun r () Bool)
+(assert (or (and (= x y) (or p q)) r))
+(check-sat)
+(push 1)
+(assert (not r))
+(assert (not (and (= x y) (or p q))))
+(check-sat)
+(pop 1)
+(assert (=> (and (= x y) (or p q)) (not (= (f x) (f y)))))
+(check-sat)
+(assert (not r))
+(check-sat)
@@ -0,0 +1,26 @@
+; COMMAND-LINE: --incremental
+; COMMAND-LINE: --incremental --no-explanation-cache
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_UFLRA)
+(declare-fun f (Real) Real)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(declare-fun p () Bool)
+(assert (or (< x y) (= (f x) z)))
+(assert (or (< y z) p))
+(assert (=> p (= x y)))
+(check-sat)
+(push 1)
+(assert (< z x))
+(assert (not (= (f x) z)))
+(check-sat)
+(pop 1)
+(assert (or (= x y) (< z x)))
+(assert (not (= (f x) (f y))))
+(check-sat)
+(assert (not (< z x)))
+(check-sat)
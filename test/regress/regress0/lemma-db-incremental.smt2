@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental --lemma-db-limit=1
+; COMMAND-LINE: --incremental --lemma-dedup
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (and (<= 0 x) (<= x 10) (<= 0 y) (<= y 10)))
+(assert (= (+ (* 2 x) (* 3 y)) 7))
+(check-sat)
+(push 1)
+(assert (= (* 2 (+ x y)) 7))
+(check-sat)
+(pop 1)
+(check-sat)
+(assert (> x 3))
+(check-sat)
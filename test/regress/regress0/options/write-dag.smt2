@@ -0,0 +1,21 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; Also run after a round trip through --write-dag and --lang=dag.
+(set-logic QF_AUFBVLIA)
+(declare-fun a () (Array Int Int))
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun b () (_ BitVec 8))
+(assert (= (select (store a x y) x) (f y)))
+(assert (> (f y) 3))
+(assert (= ((_ extract 3 0) b) #x5))
+(check-sat)
+(push 1)
+(assert (bvult b #x05))
+(check-sat)
+(pop 1)
+(assert (distinct x y))
+(check-sat)
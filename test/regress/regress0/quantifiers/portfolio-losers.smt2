@@ -0,0 +1,19 @@
+; COMMAND-LINE: --portfolio=2 --incremental --portfolio-opts="--finite-model-find --no-nl-ext;--full-saturate-quant"
+; EXPECT: sat
+; EXPECT: unsat
+; The first check is won by finite model finding, while the second solver
+; saturates forever and is interrupted.  Only the second solver can answer
+; the second check, so it must not stay interrupted.
+(set-logic UFNIA)
+(declare-sort U 0)
+(declare-fun f (U) Int)
+(declare-fun g (U) U)
+(declare-fun c () U)
+(declare-fun x () Int)
+(push 1)
+(assert (forall ((y U)) (distinct (f (g y)) (f y))))
+(assert (= (f c) 0))
+(check-sat)
+(pop 1)
+(assert (< (* x x) 0))
+(check-sat)
@@ -0,0 +1,76 @@
+; COMMAND-LINE: --incremental --sat-target-phase --sat-rephase --sat-rephase-interval=1
+; COMMAND-LINE: --incremental --sat-target-phase
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UF)
+(declare-fun p00 () Bool)
+(declare-fun p01 () Bool)
+(declare-fun p02 () Bool)
+(declare-fun p03 () Bool)
+(declare-fun p10 () Bool)
+(declare-fun p11 () Bool)
+(declare-fun p12 () Bool)
+(declare-fun p13 () Bool)
+(declare-fun p20 () Bool)
+(declare-fun p21 () Bool)
+(declare-fun p22 () Bool)
+(declare-fun p23 () Bool)
+(declare-fun p30 () Bool)
+(declare-fun p31 () Bool)
+(declare-fun p32 () Bool)
+(declare-fun p33 () Bool)
+(declare-fun p40 () Bool)
+(declare-fun p41 () Bool)
+(declare-fun p42 () Bool)
+(declare-fun p43 () Bool)
+(assert (or p00 p01 p02 p03))
+(assert (or p10 p11 p12 p13))
+(assert (or p20 p21 p22 p23))
+(assert (or p30 p31 p32 p33))
+(assert (not (and p00 p10)))
+(assert (not (and p00 p20)))
+(assert (not (and p00 p30)))
+(assert (not (and p10 p20)))
+(assert (not (and p10 p30)))
+(assert (not (and p20 p30)))
+(assert (not (and p01 p11)))
+(assert (not (and p01 p21)))
+(assert (not (and p01 p31)))
+(assert (not (and p11 p21)))
+(assert (not (and p11 p31)))
+(assert (not (and p21 p31)))
+(assert (not (and p02 p12)))
+(assert (not (and p02 p22)))
+(assert (not (and p02 p32)))
+(assert (not (and p12 p22)))
+(assert (not (and p12 p32)))
+(assert (not (and p22 p32)))
+(assert (not (and p03 p13)))
+(assert (not (and p03 p23)))
+(assert (not (and p03 p33)))
+(assert (not (and p13 p23)))
+(assert (not (and p13 p33)))
+(assert (not (and p23 p33)))
+(check-sat)
+(push 1)
+(assert (or p40 p41 p42 p43))
+(assert (not (and p00 p40)))
+(assert (not (and p10 p40)))
+(assert (not (and p20 p40)))
+(assert (not (and p30 p40)))
+(assert (not (and p01 p41)))
+(assert (not (and p11 p41)))
+(assert (not (and p21 p41)))
+(assert (not (and p31 p41)))
+(assert (not (and p02 p42)))
+(assert (not (and p12 p42)))
+(assert (not (and p22 p42)))
+(assert (not (and p32 p42)))
+(assert (not (and p03 p43)))
+(assert (not (and p13 p43)))
+(assert (not (and p23 p43)))
+(assert (not (and p33 p43)))
+(check-sat)
+(pop 1)
+(check-sat)
@@ -0,0 +1,25 @@
+; COMMAND-LINE: --incremental --sat-tier-core-lbd=0 --sat-tier-mid-lbd=0
+; COMMAND-LINE: --incremental --sat-tier-core-lbd=1 --sat-tier-mid-lbd=100
+; COMMAND-LINE: --incremental --sat-tier-core-lbd=100 --sat-tier-mid-lbd=100
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun h0 () Int)
+(declare-fun h1 () Int)
+(declare-fun h2 () Int)
+(declare-fun h3 () Int)
+(declare-fun h4 () Int)
+(assert (and (<= 0 h0) (<= h0 3)))
+(assert (and (<= 0 h1) (<= h1 3)))
+(assert (and (<= 0 h2) (<= h2 3)))
+(assert (and (<= 0 h3) (<= h3 3)))
+(assert (distinct (f h0) (f h1) (f h2) (f h3)))
+(check-sat)
+(push 1)
+(assert (and (<= 0 h4) (<= h4 3)))
+(assert (distinct (f h0) (f h1) (f h2) (f h3) (f h4)))
+(check-sat)
+(pop 1)
+(check-sat)
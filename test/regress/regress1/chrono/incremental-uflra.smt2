@@ -0,0 +1,27 @@
+; COMMAND-LINE: --incremental --sat-chrono-backtrack --sat-chrono-distance=0 --sat-chrono-conflicts=0
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UFLRA)
+(declare-fun f (Real) Real)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(assert (or a (> x 1.0)))
+(assert (or b (< y 0.0)))
+(assert (or c (= z (f x))))
+(assert (or (not a) (not b) (> (f y) z)))
+(assert (or (not c) (= x y)))
+(check-sat)
+(push 1)
+(assert (= x y))
+(assert (not a))
+(assert (not b))
+(assert (> x 0.0))
+(check-sat)
+(pop 1)
+(assert (or (> (f x) (f y)) (< (f x) (f y))))
+(check-sat)
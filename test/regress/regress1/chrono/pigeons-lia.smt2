@@ -0,0 +1,18 @@
+; COMMAND-LINE: --sat-chrono-backtrack --sat-chrono-distance=0 --sat-chrono-conflicts=0
+; EXPECT: unsat
+(set-logic QF_LIA)
+(set-info :status unsat)
+(declare-fun p1 () Int)
+(declare-fun p2 () Int)
+(declare-fun p3 () Int)
+(declare-fun p4 () Int)
+(declare-fun p5 () Int)
+(declare-fun p6 () Int)
+(assert (and (<= 1 p1) (<= p1 5)))
+(assert (and (<= 1 p2) (<= p2 5)))
+(assert (and (<= 1 p3) (<= p3 5)))
+(assert (and (<= 1 p4) (<= p4 5)))
+(assert (and (<= 1 p5) (<= p5 5)))
+(assert (and (<= 1 p6) (<= p6 5)))
+(assert (distinct p1 p2 p3 p4 p5 p6))
+(check-sat)
@@ -0,0 +1,10 @@
+; COMMAND-LINE: --cube-workers=4 --cube-probe=0 --bitblast=lazy
+; EXPECT: unsat
+(set-logic QF_BV)
+(set-info :status unsat)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(assert (bvult x #x10))
+(assert (bvult y #x10))
+(assert (= (bvmul x y) #x89))
+(check-sat)
@@ -0,0 +1,16 @@
+; COMMAND-LINE: --cube-workers=2 --cube-depth=2 --cube-probe=0
+; EXPECT: sat
+; EXPECT: ((x 3) (y 4))
+(set-option :produce-models true)
+(set-logic QF_LIA)
+(set-info :status sat)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (or (> x 5) (< x 4) (= z 1)))
+(assert (or (> y 5) (< y 5)))
+(assert (or (> z 2) (< z 0) (> x y)))
+(assert (= (+ x y) 7))
+(assert (= (- x y) (- 1)))
+(check-sat)
+(get-value (x y))
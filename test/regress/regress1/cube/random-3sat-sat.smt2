@@ -0,0 +1,1059 @@
+; COMMAND-LINE: --cube-workers=2 --cube-probe=0
+; EXPECT: sat
+; Random 3-SAT at the threshold, hard enough that the probe is interrupted;
+; the parent then solves again under the sat cube of a worker.
+(set-logic QF_UF)
+(set-info :status sat)
+(declare-fun p1 () Bool)
+(declare-fun p2 () Bool)
+(declare-fun p3 () Bool)
+(declare-fun p4 () Bool)
+(declare-fun p5 () Bool)
+(declare-fun p6 () Bool)
+(declare-fun p7 () Bool)
+(declare-fun p8 () Bool)
+(declare-fun p9 () Bool)
+(declare-fun p10 () Bool)
+(declare-fun p11 () Bool)
+(declare-fun p12 () Bool)
+(declare-fun p13 () Bool)
+(declare-fun p14 () Bool)
+(declare-fun p15 () Bool)
+(declare-fun p16 () Bool)
+(declare-fun p17 () Bool)
+(declare-fun p18 () Bool)
+(declare-fun p19 () Bool)
+(declare-fun p20 () Bool)
+(declare-fun p21 () Bool)
+(declare-fun p22 () Bool)
+(declare-fun p23 () Bool)
+(declare-fun p24 () Bool)
+(declare-fun p25 () Bool)
+(declare-fun p26 () Bool)
+(declare-fun p27 () Bool)
+(declare-fun p28 () Bool)
+(declare-fun p29 () Bool)
+(declare-fun p30 () Bool)
+(declare-fun p31 () Bool)
+(declare-fun p32 () Bool)
+(declare-fun p33 () Bool)
+(declare-fun p34 () Bool)
+(declare-fun p35 () Bool)
+(declare-fun p36 () Bool)
+(declare-fun p37 () Bool)
+(declare-fun p38 () Bool)
+(declare-fun p39 () Bool)
+(declare-fun p40 () Bool)
+(declare-fun p41 () Bool)
+(declare-fun p42 () Bool)
+(declare-fun p43 () Bool)
+(declare-fun p44 () Bool)
+(declare-fun p45 () Bool)
+(declare-fun p46 () Bool)
+(declare-fun p47 () Bool)
+(declare-fun p48 () Bool)
+(declare-fun p49 () Bool)
+(declare-fun p50 () Bool)
+(declare-fun p51 () Bool)
+(declare-fun p52 () Bool)
+(declare-fun p53 () Bool)
+(declare-fun p54 () Bool)
+(declare-fun p55 () Bool)
+(declare-fun p56 () Bool)
+(declare-fun p57 () Bool)
+(declare-fun p58 () Bool)
+(declare-fun p59 () Bool)
+(declare-fun p60 () Bool)
+(declare-fun p61 () Bool)
+(declare-fun p62 () Bool)
+(declare-fun p63 () Bool)
+(declare-fun p64 () Bool)
+(declare-fun p65 () Bool)
+(declare-fun p66 () Bool)
+(declare-fun p67 () Bool)
+(declare-fun p68 () Bool)
+(declare-fun p69 () Bool)
+(declare-fun p70 () Bool)
+(declare-fun p71 () Bool)
+(declare-fun p72 () Bool)
+(declare-fun p73 () Bool)
+(declare-fun p74 () Bool)
+(declare-fun p75 () Bool)
+(declare-fun p76 () Bool)
+(declare-fun p77 () Bool)
+(declare-fun p78 () Bool)
+(declare-fun p79 () Bool)
+(declare-fun p80 () Bool)
+(declare-fun p81 () Bool)
+(declare-fun p82 () Bool)
+(declare-fun p83 () Bool)
+(declare-fun p84 () Bool)
+(declare-fun p85 () Bool)
+(declare-fun p86 () Bool)
+(declare-fun p87 () Bool)
+(declare-fun p88 () Bool)
+(declare-fun p89 () Bool)
+(declare-fun p90 () Bool)
+(declare-fun p91 () Bool)
+(declare-fun p92 () Bool)
+(declare-fun p93 () Bool)
+(declare-fun p94 () Bool)
+(declare-fun p95 () Bool)
+(declare-fun p96 () Bool)
+(declare-fun p97 () Bool)
+(declare-fun p98 () Bool)
+(declare-fun p99 () Bool)
+(declare-fun p100 () Bool)
+(declare-fun p101 () Bool)
+(declare-fun p102 () Bool)
+(declare-fun p103 () Bool)
+(declare-fun p104 () Bool)
+(declare-fun p105 () Bool)
+(declare-fun p106 () Bool)
+(declare-fun p107 () Bool)
+(declare-fun p108 () Bool)
+(declare-fun p109 () Bool)
+(declare-fun p110 () Bool)
+(declare-fun p111 () Bool)
+(declare-fun p112 () Bool)
+(declare-fun p113 () Bool)
+(declare-fun p114 () Bool)
+(declare-fun p115 () Bool)
+(declare-fun p116 () Bool)
+(declare-fun p117 () Bool)
+(declare-fun p118 () Bool)
+(declare-fun p119 () Bool)
+(declare-fun p120 () Bool)
+(declare-fun p121 () Bool)
+(declare-fun p122 () Bool)
+(declare-fun p123 () Bool)
+(declare-fun p124 () Bool)
+(declare-fun p125 () Bool)
+(declare-fun p126 () Bool)
+(declare-fun p127 () Bool)
+(declare-fun p128 () Bool)
+(declare-fun p129 () Bool)
+(declare-fun p130 () Bool)
+(declare-fun p131 () Bool)
+(declare-fun p132 () Bool)
+(declare-fun p133 () Bool)
+(declare-fun p134 () Bool)
+(declare-fun p135 () Bool)
+(declare-fun p136 () Bool)
+(declare-fun p137 () Bool)
+(declare-fun p138 () Bool)
+(declare-fun p139 () Bool)
+(declare-fun p140 () Bool)
+(declare-fun p141 () Bool)
+(declare-fun p142 () Bool)
+(declare-fun p143 () Bool)
+(declare-fun p144 () Bool)
+(declare-fun p145 () Bool)
+(declare-fun p146 () Bool)
+(declare-fun p147 () Bool)
+(declare-fun p148 () Bool)
+(declare-fun p149 () Bool)
+(declare-fun p150 () Bool)
+(declare-fun p151 () Bool)
+(declare-fun p152 () Bool)
+(declare-fun p153 () Bool)
+(declare-fun p154 () Bool)
+(declare-fun p155 () Bool)
+(declare-fun p156 () Bool)
+(declare-fun p157 () Bool)
+(declare-fun p158 () Bool)
+(declare-fun p159 () Bool)
+(declare-fun p160 () Bool)
+(declare-fun p161 () Bool)
+(declare-fun p162 () Bool)
+(declare-fun p163 () Bool)
+(declare-fun p164 () Bool)
+(declare-fun p165 () Bool)
+(declare-fun p166 () Bool)
+(declare-fun p167 () Bool)
+(declare-fun p168 () Bool)
+(declare-fun p169 () Bool)
+(declare-fun p170 () Bool)
+(declare-fun p171 () Bool)
+(declare-fun p172 () Bool)
+(declare-fun p173 () Bool)
+(declare-fun p174 () Bool)
+(declare-fun p175 () Bool)
+(declare-fun p176 () Bool)
+(declare-fun p177 () Bool)
+(declare-fun p178 () Bool)
+(declare-fun p179 () Bool)
+(declare-fun p180 () Bool)
+(declare-fun p181 () Bool)
+(declare-fun p182 () Bool)
+(declare-fun p183 () Bool)
+(declare-fun p184 () Bool)
+(declare-fun p185 () Bool)
+(declare-fun p186 () Bool)
+(declare-fun p187 () Bool)
+(declare-fun p188 () Bool)
+(declare-fun p189 () Bool)
+(declare-fun p190 () Bool)
+(declare-fun p191 () Bool)
+(declare-fun p192 () Bool)
+(declare-fun p193 () Bool)
+(declare-fun p194 () Bool)
+(declare-fun p195 () Bool)
+(declare-fun p196 () Bool)
+(declare-fun p197 () Bool)
+(declare-fun p198 () Bool)
+(declare-fun p199 () Bool)
+(declare-fun p200 () Bool)
+(assert (or p59 (not p95) p97))
+(assert (or p64 p130 p54))
+(assert (or p100 (not p127) p147))
+(assert (or (not p60) (not p195) p6))
+(assert (or (not p98) p186 (not p30)))
+(assert (or p99 p159 p97))
+(assert (or (not p23) p128 (not p167)))
+(assert (or (not p156) p17 p139))
+(assert (or (not p149) p117 (not p187)))
+(assert (or (not p110) p35 (not p41)))
+(assert (or (not p180) (not p92) p165))
+(assert (or p39 (not p92) (not p136)))
+(assert (or p130 p180 p140))
+(assert (or p88 p57 p69))
+(assert (or (not p181) p107 (not p45)))
+(assert (or p7 p52 (not p197)))
+(assert (or (not p98) (not p88) p44))
+(assert (or p145 (not p115) p105))
+(assert (or (not p25) (not p9) (not p22)))
+(assert (or (not p40) (not p130) p125))
+(assert (or p5 (not p36) (not p88)))
+(assert (or p90 (not p84) p94))
+(assert (or (not p159) (not p9) p195))
+(assert (or p87 p111 p114))
+(assert (or p122 (not p40) p98))
+(assert (or (not p33) p185 (not p113)))
+(assert (or p145 p101 p93))
+(assert (or (not p29) (not p28) (not p55)))
+(assert (or (not p6) (not p168) (not p94)))
+(assert (or (not p192) (not p194) p154))
+(assert (or p59 (not p83) p135))
+(assert (or (not p75) (not p157) (not p76)))
+(assert (or p104 (not p58) (not p162)))
+(assert (or (not p95) (not p190) (not p83)))
+(assert (or p76 p167 (not p28)))
+(assert (or p80 p53 (not p75)))
+(assert (or p135 (not p177) (not p187)))
+(assert (or p173 (not p110) (not p51)))
+(assert (or p69 (not p42) (not p18)))
+(assert (or (not p200) p30 p160))
+(assert (or (not p130) (not p69) p71))
+(assert (or (not p63) p64 (not p130)))
+(assert (or p153 (not p135) (not p51)))
+(assert (or p100 (not p22) p168))
+(assert (or (not p12) (not p36) p6))
+(assert (or (not p119) (not p118) p172))
+(assert (or p156 (not p92) (not p168)))
+(assert (or (not p22) (not p36) p168))
+(assert (or (not p60) p186 p10))
+(assert (or (not p92) p84 (not p17)))
+(assert (or p90 (not p112) p41))
+(assert (or (not p187) p17 (not p26)))
+(assert (or p87 p192 (not p51)))
+(assert (or (not p189) p46 (not p44)))
+(assert (or p189 (not p129) p123))
+(assert (or p36 p192 p34))
+(assert (or p35 (not p196) (not p113)))
+(assert (or (not p158) p74 (not p107)))
+(assert (or (not p189) (not p96) (not p178)))
+(assert (or p189 p200 (not p136)))
+(assert (or (not p33) (not p71) (not p128)))
+(assert (or (not p132) p75 p56))
+(assert (or p126 p166 p122))
+(assert (or p96 (not p130) (not p76)))
+(assert (or p37 p177 (not p4)))
+(assert (or (not p33) (not p197) (not p109)))
+(assert (or (not p96) (not p129) p11))
+(assert (or (not p92) p28 p82))
+(assert (or (not p61) (not p123) (not p94)))
+(assert (or (not p110) p96 p191))
+(assert (or p182 p170 p167))
+(assert (or p93 p124 p94))
+(assert (or (not p69) (not p6) p113))
+(assert (or (not p76) p75 (not p104)))
+(assert (or p128 (not p168) (not p113)))
+(assert (or (not p93) p184 (not p154)))
+(assert (or (not p53) p140 p134))
+(assert (or (not p9) (not p23) p141))
+(assert (or (not p163) (not p103) (not p65)))
+(assert (or (not p4) p10 p114))
+(assert (or (not p2) (not p189) (not p5)))
+(assert (or p3 (not p12) p55))
+(assert (or (not p1) p175 (not p25)))
+(assert (or (not p194) p184 p108))
+(assert (or (not p38) (not p169) (not p182)))
+(assert (or p153 p112 (not p169)))
+(assert (or (not p8) p73 p17))
+(assert (or p15 p102 p178))
+(assert (or (not p6) (not p104) p54))
+(assert (or (not p29) (not p198) (not p168)))
+(assert (or p40 (not p184) p81))
+(assert (or p130 p141 (not p176)))
+(assert (or (not p94) p159 p36))
+(assert (or (not p87) (not p157) p42))
+(assert (or p174 p153 (not p52)))
+(assert (or (not p19) p114 p83))
+(assert (or (not p153) p102 (not p6)))
+(assert (or (not p31) (not p99) p174))
+(assert (or p154 (not p3) (not p125)))
+(assert (or p52 (not p5) (not p194)))
+(assert (or p82 (not p96) (not p181)))
+(assert (or p30 (not p14) p114))
+(assert (or p162 p20 p16))
+(assert (or (not p125) (not p155) p41))
+(assert (or (not p16) p123 (not p120)))
+(assert (or (not p171) (not p177) p15))
+(assert (or (not p115) (not p134) (not p122)))
+(assert (or (not p147) p158 p131))
+(assert (or (not p76) (not p146) p140))
+(assert (or (not p47) (not p77) (not p41)))
+(assert (or (not p91) (not p136) p15))
+(assert (or (not p64) p142 p183))
+(assert (or p49 p123 (not p141)))
+(assert (or p18 p47 p102))
+(assert (or p125 p83 p146))
+(assert (or p98 p8 (not p134)))
+(assert (or p147 (not p11) p150))
+(assert (or (not p28) p27 p50))
+(assert (or p177 p34 (not p8)))
+(assert (or p172 p134 p177))
+(assert (or (not p174) (not p163) (not p107)))
+(assert (or p61 (not p114) (not p52)))
+(assert (or p39 (not p55) (not p134)))
+(assert (or (not p94) (not p23) (not p43)))
+(assert (or p186 (not p77) (not p35)))
+(assert (or (not p40) p57 p17))
+(assert (or p74 (not p140) (not p100)))
+(assert (or p99 p114 p128))
+(assert (or p12 (not p149) (not p174)))
+(assert (or p167 p181 (not p109)))
+(assert (or (not p95) (not p11) (not p167)))
+(assert (or p14 (not p129) p5))
+(assert (or (not p64) (not p93) p91))
+(assert (or (not p22) (not p62) p165))
+(assert (or p161 p108 p8))
+(assert (or p38 p129 p69))
+(assert (or (not p92) p132 (not p98)))
+(assert (or (not p195) p163 (not p161)))
+(assert (or p188 (not p5) (not p136)))
+(assert (or (not p142) (not p37) p78))
+(assert (or (not p179) (not p11) p185))
+(assert (or p114 (not p186) (not p172)))
+(assert (or p183 p175 (not p35)))
+(assert (or (not p59) (not p194) (not p134)))
+(assert (or (not p22) (not p137) p67))
+(assert (or p74 p88 (not p130)))
+(assert (or (not p178) (not p103) p161))
+(assert (or p4 (not p178) p1))
+(assert (or p86 p144 (not p162)))
+(assert (or (not p53) p126 (not p117)))
+(assert (or p133 (not p150) p109))
+(assert (or p100 (not p136) (not p83)))
+(assert (or (not p155) (not p171) (not p16)))
+(assert (or (not p171) p51 p60))
+(assert (or (not p68) p141 p87))
+(assert (or p108 p101 p138))
+(assert (or (not p160) p59 p147))
+(assert (or p188 (not p42) (not p194)))
+(assert (or (not p167) (not p98) (not p147)))
+(assert (or p33 p170 p67))
+(assert (or (not p94) (not p26) (not p157)))
+(assert (or (not p167) (not p30) (not p190)))
+(assert (or p13 p165 p29))
+(assert (or (not p176) (not p147) p16))
+(assert (or (not p104) p3 p7))
+(assert (or p59 (not p171) p15))
+(assert (or p141 p106 p35))
+(assert (or (not p85) p50 p190))
+(assert (or p79 p83 p71))
+(assert (or p9 p167 (not p50)))
+(assert (or (not p21) p122 (not p158)))
+(assert (or p127 p183 p174))
+(assert (or p13 p142 (not p90)))
+(assert (or p119 p138 p60))
+(assert (or (not p13) (not p30) (not p112)))
+(assert (or p186 (not p174) (not p30)))
+(assert (or (not p176) p185 (not p90)))
+(assert (or p131 p19 p101))
+(assert (or (not p121) p115 p1))
+(assert (or (not p137) p148 p13))
+(assert (or p156 p56 p135))
+(assert (or p144 (not p81) p78))
+(assert (or (not p68) (not p75) p47))
+(assert (or (not p179) p31 p5))
+(assert (or (not p56) (not p147) (not p38)))
+(assert (or p46 (not p67) (not p118)))
+(assert (or p64 (not p175) (not p98)))
+(assert (or p107 p177 (not p8)))
+(assert (or (not p28) p35 p91))
+(assert (or (not p10) (not p19) p73))
+(assert (or p106 p84 p16))
+(assert (or (not p148) p36 (not p122)))
+(assert (or (not p34) (not p68) p121))
+(assert (or p82 p149 p75))
+(assert (or p78 p48 p24))
+(assert (or (not p150) p35 (not p160)))
+(assert (or (not p162) p51 p144))
+(assert (or (not p72) (not p132) p52))
+(assert (or (not p132) p196 p42))
+(assert (or p23 (not p4) (not p30)))
+(assert (or (not p169) p9 (not p108)))
+(assert (or p193 p89 p146))
+(assert (or p108 p134 (not p77)))
+(assert (or p118 (not p68) p21))
+(assert (or p120 p198 (not p136)))
+(assert (or (not p33) (not p34) (not p94)))
+(assert (or (not p42) (not p22) p5))
+(assert (or p160 p186 p9))
+(assert (or p161 p33 (not p184)))
+(assert (or p91 (not p33) (not p90)))
+(assert (or p18 p53 p151))
+(assert (or (not p196) (not p37) (not p150)))
+(assert (or (not p99) (not p127) p58))
+(assert (or p1 (not p153) p154))
+(assert (or p165 (not p132) (not p144)))
+(assert (or (not p27) p55 p11))
+(assert (or (not p31) (not p148) (not p83)))
+(assert (or (not p181) (not p138) p11))
+(assert (or p4 p171 p29))
+(assert (or (not p80) (not p69) (not p124)))
+(assert (or (not p89) p17 (not p142)))
+(assert (or p104 (not p105) (not p138)))
+(assert (or p113 (not p103) (not p167)))
+(assert (or p188 (not p13) p36))
+(assert (or p9 (not p155) (not p95)))
+(assert (or (not p52) (not p94) p13))
+(assert (or (not p57) (not p156) p165))
+(assert (or p180 p44 (not p97)))
+(assert (or p90 p25 p176))
+(assert (or p17 (not p57) p174))
+(assert (or p199 p159 p193))
+(assert (or (not p171) p66 (not p138)))
+(assert (or p181 (not p160) (not p61)))
+(assert (or (not p95) p42 (not p2)))
+(assert (or p121 (not p123) p98))
+(assert (or p114 p38 (not p135)))
+(assert (or p67 p40 (not p59)))
+(assert (or (not p189) p20 p144))
+(assert (or p189 p98 (not p42)))
+(assert (or (not p111) p122 (not p94)))
+(assert (or p2 (not p190) (not p38)))
+(assert (or (not p135) (not p40) (not p180)))
+(assert (or p190 (not p137) p25))
+(assert (or p105 p140 (not p150)))
+(assert (or p157 p122 (not p104)))
+(assert (or p151 p61 p18))
+(assert (or (not p195) p199 p49))
+(assert (or p10 (not p85) p189))
+(assert (or p94 p48 (not p12)))
+(assert (or (not p60) (not p83) (not p180)))
+(assert (or (not p55) (not p147) p178))
+(assert (or (not p169) p6 p129))
+(assert (or p55 (not p183) p62))
+(assert (or p23 (not p192) (not p5)))
+(assert (or p12 p75 (not p177)))
+(assert (or p166 (not p119) (not p143)))
+(assert (or p120 p139 p164))
+(assert (or p196 p144 p57))
+(assert (or (not p50) p167 (not p130)))
+(assert (or p110 p109 (not p38)))
+(assert (or p176 (not p130) p147))
+(assert (or p152 p139 p123))
+(assert (or (not p143) (not p58) p104))
+(assert (or p188 (not p137) (not p107)))
+(assert (or (not p29) (not p17) p11))
+(assert (or p8 (not p130) p144))
+(assert (or (not p136) p51 (not p39)))
+(assert (or (not p93) (not p139) p16))
+(assert (or p140 p143 p111))
+(assert (or (not p35) (not p131) (not p90)))
+(assert (or (not p16) p148 p76))
+(assert (or p123 p28 (not p197)))
+(assert (or (not p189) (not p118) (not p23)))
+(assert (or (not p159) p167 p129))
+(assert (or (not p87) p136 (not p58)))
+(assert (or p189 (not p188) p53))
+(assert (or p156 p113 p23))
+(assert (or p37 (not p102) p55))
+(assert (or p154 (not p44) (not p84)))
+(assert (or p28 (not p193) (not p191)))
+(assert (or p38 p3 (not p59)))
+(assert (or (not p76) (not p112) p180))
+(assert (or (not p96) p53 (not p61)))
+(assert (or p98 p196 p1))
+(assert (or p200 (not p33) p163))
+(assert (or (not p197) (not p88) (not p46)))
+(assert (or p119 p84 (not p182)))
+(assert (or (not p134) p132 (not p107)))
+(assert (or p179 p81 p65))
+(assert (or (not p31) p86 (not p22)))
+(assert (or (not p180) p123 (not p119)))
+(assert (or p184 p187 p81))
+(assert (or (not p21) (not p182) (not p197)))
+(assert (or (not p155) p106 (not p80)))
+(assert (or p62 p33 (not p141)))
+(assert (or p134 (not p66) (not p103)))
+(assert (or (not p54) (not p9) (not p126)))
+(assert (or (not p152) (not p145) (not p139)))
+(assert (or (not p51) (not p169) p62))
+(assert (or (not p70) (not p98) p115))
+(assert (or p128 p148 (not p130)))
+(assert (or p77 (not p95) (not p57)))
+(assert (or (not p69) (not p127) p186))
+(assert (or (not p50) p17 p24))
+(assert (or p98 (not p176) p144))
+(assert (or p138 (not p146) (not p2)))
+(assert (or p181 p133 p146))
+(assert (or p130 (not p32) p192))
+(assert (or (not p157) (not p6) p102))
+(assert (or (not p149) (not p175) p20))
+(assert (or (not p178) p124 p69))
+(assert (or p25 (not p75) (not p145)))
+(assert (or p121 (not p15) (not p36)))
+(assert (or (not p50) (not p39) (not p142)))
+(assert (or (not p35) p181 (not p76)))
+(assert (or (not p103) (not p70) p130))
+(assert (or p191 (not p105) p11))
+(assert (or p194 p130 (not p133)))
+(assert (or (not p108) (not p5) (not p41)))
+(assert (or p200 p4 (not p177)))
+(assert (or (not p169) (not p128) (not p22)))
+(assert (or (not p135) p32 (not p145)))
+(assert (or (not p28) p137 (not p1)))
+(assert (or (not p197) p171 p115))
+(assert (or (not p153) p135 (not p75)))
+(assert (or p10 p191 p25))
+(assert (or (not p62) p180 p139))
+(assert (or (not p36) p68 p66))
+(assert (or (not p2) (not p39) p38))
+(assert (or (not p138) p6 p65))
+(assert (or p128 p180 p97))
+(assert (or p97 p178 p29))
+(assert (or (not p56) (not p197) p149))
+(assert (or (not p102) p78 p69))
+(assert (or p123 p193 p1))
+(assert (or p66 p83 (not p117)))
+(assert (or p52 p155 (not p189)))
+(assert (or (not p8) (not p17) (not p133)))
+(assert (or (not p127) (not p167) (not p125)))
+(assert (or p139 (not p76) (not p145)))
+(assert (or (not p102) (not p80) (not p38)))
+(assert (or p193 (not p136) (not p72)))
+(assert (or p7 p17 (not p35)))
+(assert (or (not p168) (not p74) p200))
+(assert (or p57 p105 p152))
+(assert (or (not p69) (not p121) (not p68)))
+(assert (or p156 (not p154) p74))
+(assert (or p101 p57 (not p91)))
+(assert (or p67 p43 p9))
+(assert (or (not p73) (not p52) (not p103)))
+(assert (or (not p4) (not p39) p164))
+(assert (or (not p145) (not p16) (not p119)))
+(assert (or p126 p184 (not p164)))
+(assert (or p159 p46 (not p60)))
+(assert (or (not p23) (not p4) p91))
+(assert (or (not p180) (not p154) p145))
+(assert (or (not p145) p160 (not p112)))
+(assert (or p84 (not p183) p20))
+(assert (or (not p143) p144 p183))
+(assert (or p112 (not p51) p85))
+(assert (or (not p95) (not p63) (not p193)))
+(assert (or (not p48) p171 p161))
+(assert (or p15 (not p10) p127))
+(assert (or p110 p65 p190))
+(assert (or p164 (not p125) (not p30)))
+(assert (or (not p58) (not p4) p93))
+(assert (or p21 (not p147) (not p29)))
+(assert (or p101 (not p179) p165))
+(assert (or (not p44) (not p186) (not p43)))
+(assert (or p59 (not p88) (not p78)))
+(assert (or p50 (not p165) p34))
+(assert (or p6 (not p189) (not p145)))
+(assert (or p89 (not p97) (not p125)))
+(assert (or (not p122) p187 p138))
+(assert (or (not p189) (not p6) (not p10)))
+(assert (or (not p144) (not p70) p54))
+(assert (or (not p19) (not p126) p120))
+(assert (or p93 (not p113) (not p160)))
+(assert (or p85 (not p125) p30))
+(assert (or p130 p33 (not p5)))
+(assert (or p87 p78 (not p16)))
+(assert (or p111 (not p129) (not p28)))
+(assert (or (not p64) p150 p125))
+(assert (or (not p94) p187 p154))
+(assert (or (not p61) (not p188) (not p92)))
+(assert (or p124 p140 (not p144)))
+(assert (or p186 p8 p44))
+(assert (or p76 p14 p34))
+(assert (or p198 (not p156) (not p195)))
+(assert (or p136 (not p16) p189))
+(assert (or p117 p1 p123))
+(assert (or (not p98) (not p194) p171))
+(assert (or p161 (not p194) p77))
+(assert (or (not p20) p133 p105))
+(assert (or (not p113) (not p48) p75))
+(assert (or (not p79) p69 p186))
+(assert (or p123 p90 (not p89)))
+(assert (or (not p36) p73 (not p145)))
+(assert (or p74 (not p89) p158))
+(assert (or p121 p181 p179))
+(assert (or p1 p105 p78))
+(assert (or (not p103) (not p174) p107))
+(assert (or p25 p132 (not p43)))
+(assert (or p12 p38 (not p55)))
+(assert (or (not p152) p112 p141))
+(assert (or p102 (not p85) (not p180)))
+(assert (or p155 p98 (not p104)))
+(assert (or p46 (not p13) p73))
+(assert (or p102 (not p14) (not p60)))
+(assert (or (not p83) (not p22) p112))
+(assert (or p129 p1 p187))
+(assert (or p136 (not p189) (not p50)))
+(assert (or p119 p30 p99))
+(assert (or p145 p53 (not p106)))
+(assert (or p147 (not p177) (not p34)))
+(assert (or (not p17) p173 p11))
+(assert (or p171 p68 (not p87)))
+(assert (or (not p166) (not p98) p134))
+(assert (or p95 (not p43) p97))
+(assert (or p19 (not p103) (not p58)))
+(assert (or (not p158) p150 p2))
+(assert (or (not p190) (not p4) (not p104)))
+(assert (or (not p59) p39 p61))
+(assert (or (not p67) p199 p23))
+(assert (or p140 p154 (not p24)))
+(assert (or p90 (not p183) p137))
+(assert (or p46 (not p133) p145))
+(assert (or p62 (not p72) p172))
+(assert (or (not p85) p48 p21))
+(assert (or p119 p90 (not p118)))
+(assert (or p112 p155 (not p4)))
+(assert (or (not p87) (not p70) (not p92)))
+(assert (or (not p167) (not p43) p79))
+(assert (or p87 (not p172) (not p121)))
+(assert (or p79 (not p16) (not p117)))
+(assert (or (not p90) p22 p19))
+(assert (or (not p170) (not p6) p5))
+(assert (or (not p191) (not p144) p189))
+(assert (or p93 p38 p115))
+(assert (or p129 (not p137) (not p170)))
+(assert (or (not p157) p112 p165))
+(assert (or p6 (not p40) (not p117)))
+(assert (or p64 (not p53) (not p46)))
+(assert (or p195 (not p99) p124))
+(assert (or p15 p136 p191))
+(assert (or (not p84) (not p117) (not p153)))
+(assert (or (not p185) (not p88) p179))
+(assert (or p61 (not p145) p182))
+(assert (or p76 p75 (not p90)))
+(assert (or (not p51) p103 p44))
+(assert (or p191 p152 (not p142)))
+(assert (or (not p187) p36 (not p159)))
+(assert (or p97 p50 (not p47)))
+(assert (or p95 p33 (not p99)))
+(assert (or p180 (not p185) p16))
+(assert (or (not p127) p156 (not p154)))
+(assert (or (not p72) (not p93) (not p152)))
+(assert (or p188 (not p2) p45))
+(assert (or p33 p17 (not p110)))
+(assert (or p163 (not p158) (not p101)))
+(assert (or (not p8) p59 (not p160)))
+(assert (or (not p196) p76 p117))
+(assert (or p170 p68 p31))
+(assert (or p45 p128 p170))
+(assert (or (not p175) (not p12) p105))
+(assert (or (not p97) (not p24) (not p85)))
+(assert (or p1 p58 (not p97)))
+(assert (or (not p32) (not p80) p10))
+(assert (or p83 p129 (not p59)))
+(assert (or (not p97) (not p64) p28))
+(assert (or (not p149) (not p113) p168))
+(assert (or p73 p49 (not p147)))
+(assert (or (not p1) p126 (not p165)))
+(assert (or p141 p199 p66))
+(assert (or (not p71) p157 (not p11)))
+(assert (or (not p41) (not p28) p43))
+(assert (or p66 p194 p192))
+(assert (or (not p89) p196 p93))
+(assert (or (not p76) p53 p180))
+(assert (or p149 (not p19) (not p118)))
+(assert (or p66 p85 (not p155)))
+(assert (or p148 p79 p146))
+(assert (or (not p180) (not p145) (not p66)))
+(assert (or (not p159) p24 (not p148)))
+(assert (or (not p150) p38 (not p11)))
+(assert (or (not p10) p163 (not p26)))
+(assert (or p61 (not p169) (not p184)))
+(assert (or p189 (not p123) (not p139)))
+(assert (or (not p177) (not p52) p108))
+(assert (or (not p124) (not p99) (not p172)))
+(assert (or p62 (not p168) p181))
+(assert (or (not p106) p34 (not p122)))
+(assert (or (not p28) p143 (not p117)))
+(assert (or (not p175) p154 p164))
+(assert (or (not p52) p137 (not p128)))
+(assert (or (not p73) p146 p11))
+(assert (or p35 (not p164) (not p7)))
+(assert (or p184 (not p60) (not p95)))
+(assert (or (not p80) (not p55) (not p99)))
+(assert (or p40 (not p3) p102))
+(assert (or p115 (not p102) p139))
+(assert (or (not p9) p132 (not p14)))
+(assert (or p85 (not p159) (not p180)))
+(assert (or (not p93) p3 p117))
+(assert (or (not p198) (not p102) (not p51)))
+(assert (or (not p122) p144 p77))
+(assert (or (not p140) (not p113) p23))
+(assert (or (not p26) p158 (not p66)))
+(assert (or (not p166) p56 (not p186)))
+(assert (or (not p162) p161 (not p15)))
+(assert (or (not p106) p52 p60))
+(assert (or p57 p143 p132))
+(assert (or (not p102) p34 p155))
+(assert (or (not p64) p186 (not p182)))
+(assert (or (not p34) p164 (not p3)))
+(assert (or (not p58) (not p77) (not p150)))
+(assert (or (not p18) (not p198) (not p146)))
+(assert (or p96 p200 (not p129)))
+(assert (or (not p197) (not p64) (not p59)))
+(assert (or (not p166) p177 (not p115)))
+(assert (or (not p94) (not p160) (not p46)))
+(assert (or p197 p146 p93))
+(assert (or p175 p50 (not p92)))
+(assert (or (not p24) (not p148) p54))
+(assert (or p76 (not p121) p165))
+(assert (or p95 p143 p154))
+(assert (or p42 p74 (not p69)))
+(assert (or (not p171) p35 (not p152)))
+(assert (or p1 p10 p82))
+(assert (or (not p2) p181 p158))
+(assert (or p147 (not p59) p173))
+(assert (or (not p127) p170 (not p36)))
+(assert (or p44 (not p129) (not p26)))
+(assert (or (not p157) (not p182) (not p42)))
+(assert (or p19 p170 p180))
+(assert (or (not p176) p7 (not p85)))
+(assert (or p194 p33 p110))
+(assert (or p139 (not p155) p182))
+(assert (or p43 (not p142) (not p27)))
+(assert (or (not p60) p1 p112))
+(assert (or (not p26) p115 (not p38)))
+(assert (or p43 (not p1) p175))
+(assert (or p51 (not p133) (not p87)))
+(assert (or (not p176) p123 (not p110)))
+(assert (or (not p178) (not p29) (not p53)))
+(assert (or (not p142) p197 (not p66)))
+(assert (or (not p102) p65 p129))
+(assert (or p47 p72 p86))
+(assert (or p47 p8 p67))
+(assert (or (not p15) (not p167) (not p67)))
+(assert (or p197 p22 p199))
+(assert (or p96 p197 (not p55)))
+(assert (or p45 p58 (not p195)))
+(assert (or (not p151) (not p114) (not p78)))
+(assert (or (not p81) p33 p12))
+(assert (or (not p114) p34 p74))
+(assert (or (not p61) p133 p111))
+(assert (or (not p4) (not p113) (not p107)))
+(assert (or p152 p22 (not p135)))
+(assert (or (not p74) p13 p1))
+(assert (or p181 (not p133) p144))
+(assert (or (not p87) p143 (not p4)))
+(assert (or p138 (not p143) p114))
+(assert (or (not p136) (not p72) p8))
+(assert (or (not p59) p61 p44))
+(assert (or p98 (not p154) (not p127)))
+(assert (or p129 p15 p9))
+(assert (or (not p58) (not p52) p75))
+(assert (or (not p26) (not p186) (not p20)))
+(assert (or (not p89) (not p199) (not p35)))
+(assert (or (not p61) (not p96) p193))
+(assert (or (not p31) (not p174) (not p8)))
+(assert (or (not p156) p192 p84))
+(assert (or p60 p68 (not p167)))
+(assert (or p44 (not p137) (not p183)))
+(assert (or p140 (not p62) p37))
+(assert (or p23 p43 (not p111)))
+(assert (or (not p27) (not p54) p115))
+(assert (or (not p124) p46 p153))
+(assert (or p166 (not p16) (not p47)))
+(assert (or p110 p15 (not p76)))
+(assert (or (not p184) (not p7) p89))
+(assert (or p52 (not p167) p79))
+(assert (or (not p76) p48 p5))
+(assert (or (not p125) (not p73) p67))
+(assert (or p33 (not p141) p21))
+(assert (or (not p156) p126 (not p11)))
+(assert (or (not p91) (not p170) p198))
+(assert (or p37 p17 (not p50)))
+(assert (or p194 (not p121) p11))
+(assert (or p120 p43 p191))
+(assert (or (not p179) p135 p28))
+(assert (or p118 (not p111) p148))
+(assert (or (not p75) p33 p72))
+(assert (or p52 p139 p179))
+(assert (or (not p43) (not p23) (not p75)))
+(assert (or (not p46) (not p9) (not p125)))
+(assert (or (not p49) (not p140) p24))
+(assert (or p198 (not p38) (not p135)))
+(assert (or (not p77) p8 (not p163)))
+(assert (or p75 (not p21) p25))
+(assert (or (not p136) p193 p123))
+(assert (or p159 p27 p38))
+(assert (or (not p192) (not p121) (not p182)))
+(assert (or (not p15) (not p143) (not p185)))
+(assert (or p140 p122 p6))
+(assert (or (not p118) (not p5) p181))
+(assert (or (not p109) (not p133) p49))
+(assert (or (not p97) p132 (not p20)))
+(assert (or p157 p11 (not p55)))
+(assert (or p188 (not p81) (not p95)))
+(assert (or p56 (not p22) (not p125)))
+(assert (or p77 p3 (not p135)))
+(assert (or (not p177) (not p89) p183))
+(assert (or (not p51) p62 (not p20)))
+(assert (or (not p98) (not p127) (not p65)))
+(assert (or (not p25) (not p20) p46))
+(assert (or p176 p82 p47))
+(assert (or p109 p95 p35))
+(assert (or (not p86) (not p121) p119))
+(assert (or (not p39) p145 (not p81)))
+(assert (or (not p31) (not p122) (not p75)))
+(assert (or p145 p14 (not p99)))
+(assert (or (not p164) p187 p170))
+(assert (or p96 (not p149) p14))
+(assert (or (not p101) p85 (not p43)))
+(assert (or p194 p4 p104))
+(assert (or (not p198) (not p54) p142))
+(assert (or (not p53) p33 (not p73)))
+(assert (or (not p142) (not p2) (not p39)))
+(assert (or p15 p6 p42))
+(assert (or (not p191) (not p193) p92))
+(assert (or (not p154) (not p67) p184))
+(assert (or p56 (not p54) p35))
+(assert (or (not p159) p140 p163))
+(assert (or (not p46) (not p66) p151))
+(assert (or p154 (not p160) (not p143)))
+(assert (or (not p29) (not p145) (not p159)))
+(assert (or p152 p172 (not p126)))
+(assert (or p91 p128 (not p166)))
+(assert (or (not p45) (not p149) (not p21)))
+(assert (or p127 (not p107) (not p160)))
+(assert (or p24 (not p175) (not p85)))
+(assert (or p53 p124 p100))
+(assert (or (not p192) (not p38) p16))
+(assert (or p109 p39 (not p113)))
+(assert (or (not p15) p190 (not p136)))
+(assert (or p170 (not p107) p176))
+(assert (or (not p156) (not p164) (not p189)))
+(assert (or (not p56) p65 p181))
+(assert (or (not p123) (not p110) (not p88)))
+(assert (or p122 (not p183) p78))
+(assert (or p27 p105 p45))
+(assert (or (not p136) (not p72) p115))
+(assert (or (not p1) (not p54) (not p90)))
+(assert (or (not p92) (not p21) p170))
+(assert (or p187 p147 p5))
+(assert (or p156 (not p101) p42))
+(assert (or (not p84) (not p16) (not p100)))
+(assert (or (not p183) p139 p179))
+(assert (or p83 p60 p182))
+(assert (or (not p28) p26 p6))
+(assert (or (not p68) p9 (not p119)))
+(assert (or p123 p127 (not p159)))
+(assert (or p82 (not p165) (not p198)))
+(assert (or (not p52) (not p29) (not p112)))
+(assert (or (not p21) (not p34) p178))
+(assert (or p138 (not p181) p200))
+(assert (or (not p187) (not p90) p156))
+(assert (or (not p173) p76 (not p27)))
+(assert (or (not p32) p158 (not p178)))
+(assert (or p115 (not p103) p10))
+(assert (or (not p172) (not p191) (not p71)))
+(assert (or p109 (not p131) p155))
+(assert (or (not p66) p170 p74))
+(assert (or p23 p193 (not p148)))
+(assert (or p53 (not p42) (not p107)))
+(assert (or (not p30) p173 (not p199)))
+(assert (or p79 p200 p114))
+(assert (or (not p178) (not p144) (not p169)))
+(assert (or (not p24) (not p170) p40))
+(assert (or (not p118) (not p125) (not p56)))
+(assert (or p144 (not p102) (not p36)))
+(assert (or p70 p94 p80))
+(assert (or (not p133) (not p81) p60))
+(assert (or (not p21) (not p110) (not p193)))
+(assert (or p113 p141 (not p177)))
+(assert (or p55 p151 (not p31)))
+(assert (or (not p121) (not p158) p157))
+(assert (or (not p24) (not p21) (not p67)))
+(assert (or p131 p17 p9))
+(assert (or p168 p165 (not p111)))
+(assert (or (not p52) p194 (not p163)))
+(assert (or (not p180) p193 p170))
+(assert (or p32 p191 p84))
+(assert (or p136 (not p26) (not p147)))
+(assert (or p142 p26 p170))
+(assert (or (not p44) (not p144) p149))
+(assert (or (not p137) p199 (not p3)))
+(assert (or p174 p143 (not p101)))
+(assert (or p65 p100 (not p111)))
+(assert (or (not p118) p199 (not p31)))
+(assert (or p131 p192 p120))
+(assert (or (not p124) (not p1) (not p17)))
+(assert (or p104 (not p5) (not p22)))
+(assert (or (not p154) p39 (not p21)))
+(assert (or (not p47) p94 p101))
+(assert (or p121 p77 (not p34)))
+(assert (or (not p59) (not p100) p77))
+(assert (or (not p21) p195 p116))
+(assert (or p71 (not p119) (not p41)))
+(assert (or (not p76) (not p99) p20))
+(assert (or (not p17) p63 (not p177)))
+(assert (or (not p6) p54 p82))
+(assert (or (not p167) p148 (not p72)))
+(assert (or p189 (not p174) (not p173)))
+(assert (or p38 p9 (not p125)))
+(assert (or (not p45) (not p92) (not p145)))
+(assert (or p26 (not p12) p33))
+(assert (or p163 p84 p20))
+(assert (or p45 (not p104) p144))
+(assert (or (not p13) p70 p16))
+(assert (or (not p47) (not p174) p56))
+(assert (or (not p175) p85 p82))
+(assert (or p119 (not p148) p141))
+(assert (or (not p116) (not p103) (not p90)))
+(assert (or p137 p37 p153))
+(assert (or p42 (not p35) (not p55)))
+(assert (or (not p105) p84 p27))
+(assert (or p74 (not p129) p104))
+(assert (or p156 (not p77) p153))
+(assert (or p88 p84 (not p183)))
+(assert (or p166 p169 p84))
+(assert (or p132 (not p85) (not p95)))
+(assert (or p84 p41 p111))
+(assert (or (not p49) p48 (not p118)))
+(assert (or (not p93) p179 p142))
+(assert (or p43 (not p25) p190))
+(assert (or p51 p112 p80))
+(assert (or p19 p13 (not p132)))
+(assert (or p24 (not p87) p108))
+(assert (or p123 (not p170) p19))
+(assert (or p198 (not p86) (not p32)))
+(assert (or (not p173) p190 p92))
+(assert (or p166 (not p2) (not p26)))
+(assert (or p5 p74 (not p75)))
+(assert (or p150 (not p134) (not p5)))
+(assert (or p170 p4 (not p56)))
+(assert (or (not p13) (not p122) (not p105)))
+(assert (or p47 (not p105) (not p30)))
+(assert (or (not p141) (not p168) p91))
+(assert (or (not p28) (not p30) (not p128)))
+(assert (or (not p8) (not p151) p96))
+(assert (or (not p29) p158 p173))
+(assert (or (not p50) p174 (not p156)))
+(assert (or (not p83) p50 (not p174)))
+(assert (or (not p166) p22 (not p58)))
+(assert (or (not p15) p100 (not p124)))
+(assert (or (not p143) (not p182) p8))
+(assert (or (not p119) (not p20) p30))
+(assert (or (not p85) p100 p40))
+(assert (or (not p34) p72 p143))
+(assert (or p198 (not p184) (not p197)))
+(assert (or (not p70) p160 p99))
+(assert (or (not p84) p199 (not p91)))
+(assert (or (not p63) p94 (not p191)))
+(assert (or (not p96) p192 p141))
+(assert (or p159 (not p139) p43))
+(assert (or p84 (not p103) p190))
+(assert (or (not p80) p137 (not p22)))
+(assert (or (not p19) p110 (not p132)))
+(assert (or (not p52) (not p68) p99))
+(assert (or p160 p107 (not p181)))
+(assert (or (not p168) p36 p65))
+(assert (or (not p112) (not p130) (not p22)))
+(assert (or (not p53) (not p71) (not p46)))
+(assert (or (not p40) (not p106) p92))
+(assert (or (not p64) p116 (not p152)))
+(assert (or p89 (not p100) (not p79)))
+(assert (or p114 (not p26) p124))
+(assert (or (not p161) p121 p194))
+(assert (or (not p103) p185 (not p14)))
+(assert (or p25 (not p182) p194))
+(assert (or (not p87) p169 p193))
+(assert (or (not p9) p85 (not p186)))
+(assert (or (not p80) p136 (not p18)))
+(assert (or (not p135) p125 p95))
+(assert (or p78 p85 p148))
+(assert (or p48 p157 p149))
+(assert (or p155 p153 p167))
+(assert (or p80 p131 (not p69)))
+(assert (or p74 (not p2) (not p141)))
+(assert (or (not p5) (not p71) p101))
+(assert (or (not p59) p161 p29))
+(assert (or p32 (not p54) (not p126)))
+(assert (or (not p33) (not p199) p101))
+(assert (or (not p12) (not p85) (not p16)))
+(assert (or p85 p166 (not p76)))
+(assert (or (not p147) (not p73) p168))
+(assert (or (not p137) p10 (not p56)))
+(assert (or p135 p139 p126))
+(assert (or (not p66) (not p99) p169))
+(assert (or (not p145) p2 (not p62)))
+(assert (or (not p181) p186 (not p88)))
+(assert (or p181 p57 p159))
+(assert (or (not p44) p93 (not p187)))
+(assert (or (not p3) p36 (not p165)))
+(assert (or p38 (not p180) (not p77)))
+(assert (or p172 p17 (not p143)))
+(assert (or p22 (not p66) p112))
+(assert (or (not p18) (not p6) p152))
+(assert (or p57 p19 p83))
+(assert (or (not p142) (not p43) (not p135)))
+(assert (or (not p30) (not p169) (not p129)))
+(assert (or (not p100) (not p199) p69))
+(assert (or (not p155) p57 (not p15)))
+(assert (or (not p23) p190 (not p33)))
+(assert (or (not p147) p10 p189))
+(assert (or (not p155) p142 p152))
+(assert (or p36 p128 (not p161)))
+(assert (or (not p72) p47 p28))
+(assert (or (not p13) p14 p82))
+(assert (or p134 p152 p90))
+(assert (or (not p186) (not p112) p170))
+(assert (or (not p173) p44 p133))
+(assert (or (not p123) p23 p136))
+(assert (or (not p77) (not p49) p127))
+(assert (or (not p84) p60 (not p176)))
+(assert (or p35 (not p102) (not p17)))
+(assert (or p31 (not p69) (not p74)))
+(assert (or p52 (not p14) p137))
+(assert (or (not p53) p120 p3))
+(assert (or p72 (not p105) (not p91)))
+(assert (or p78 (not p157) p197))
+(assert (or p7 (not p179) p98))
+(assert (or (not p166) (not p47) p98))
+(assert (or p51 (not p33) (not p182)))
+(assert (or (not p20) p139 p148))
+(assert (or p168 p120 p153))
+(assert (or (not p120) (not p80) p151))
+(assert (or p11 (not p179) (not p90)))
+(assert (or (not p54) p78 p185))
+(assert (or p160 p67 p146))
+(assert (or (not p24) p152 (not p130)))
+(assert (or (not p36) (not p39) p17))
+(assert (or (not p52) (not p68) p154))
+(assert (or (not p112) (not p143) p19))
+(assert (or p49 p44 p39))
+(assert (or (not p197) p148 (not p172)))
+(assert (or (not p154) p37 p56))
+(assert (or (not p66) (not p140) (not p119)))
+(assert (or p130 (not p145) p147))
+(check-sat)
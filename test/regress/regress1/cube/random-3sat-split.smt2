@@ -0,0 +1,1059 @@
+; COMMAND-LINE: --cube-workers=2 --cube-probe=0 --cube-split=0
+; EXPECT: unsat
+; Random 3-SAT at the threshold, hard enough that the probe is interrupted
+; and the busy cubes are split again.
+(set-logic QF_UF)
+(set-info :status unsat)
+(declare-fun p1 () Bool)
+(declare-fun p2 () Bool)
+(declare-fun p3 () Bool)
+(declare-fun p4 () Bool)
+(declare-fun p5 () Bool)
+(declare-fun p6 () Bool)
+(declare-fun p7 () Bool)
+(declare-fun p8 () Bool)
+(declare-fun p9 () Bool)
+(declare-fun p10 () Bool)
+(declare-fun p11 () Bool)
+(declare-fun p12 () Bool)
+(declare-fun p13 () Bool)
+(declare-fun p14 () Bool)
+(declare-fun p15 () Bool)
+(declare-fun p16 () Bool)
+(declare-fun p17 () Bool)
+(declare-fun p18 () Bool)
+(declare-fun p19 () Bool)
+(declare-fun p20 () Bool)
+(declare-fun p21 () Bool)
+(declare-fun p22 () Bool)
+(declare-fun p23 () Bool)
+(declare-fun p24 () Bool)
+(declare-fun p25 () Bool)
+(declare-fun p26 () Bool)
+(declare-fun p27 () Bool)
+(declare-fun p28 () Bool)
+(declare-fun p29 () Bool)
+(declare-fun p30 () Bool)
+(declare-fun p31 () Bool)
+(declare-fun p32 () Bool)
+(declare-fun p33 () Bool)
+(declare-fun p34 () Bool)
+(declare-fun p35 () Bool)
+(declare-fun p36 () Bool)
+(declare-fun p37 () Bool)
+(declare-fun p38 () Bool)
+(declare-fun p39 () Bool)
+(declare-fun p40 () Bool)
+(declare-fun p41 () Bool)
+(declare-fun p42 () Bool)
+(declare-fun p43 () Bool)
+(declare-fun p44 () Bool)
+(declare-fun p45 () Bool)
+(declare-fun p46 () Bool)
+(declare-fun p47 () Bool)
+(declare-fun p48 () Bool)
+(declare-fun p49 () Bool)
+(declare-fun p50 () Bool)
+(declare-fun p51 () Bool)
+(declare-fun p52 () Bool)
+(declare-fun p53 () Bool)
+(declare-fun p54 () Bool)
+(declare-fun p55 () Bool)
+(declare-fun p56 () Bool)
+(declare-fun p57 () Bool)
+(declare-fun p58 () Bool)
+(declare-fun p59 () Bool)
+(declare-fun p60 () Bool)
+(declare-fun p61 () Bool)
+(declare-fun p62 () Bool)
+(declare-fun p63 () Bool)
+(declare-fun p64 () Bool)
+(declare-fun p65 () Bool)
+(declare-fun p66 () Bool)
+(declare-fun p67 () Bool)
+(declare-fun p68 () Bool)
+(declare-fun p69 () Bool)
+(declare-fun p70 () Bool)
+(declare-fun p71 () Bool)
+(declare-fun p72 () Bool)
+(declare-fun p73 () Bool)
+(declare-fun p74 () Bool)
+(declare-fun p75 () Bool)
+(declare-fun p76 () Bool)
+(declare-fun p77 () Bool)
+(declare-fun p78 () Bool)
+(declare-fun p79 () Bool)
+(declare-fun p80 () Bool)
+(declare-fun p81 () Bool)
+(declare-fun p82 () Bool)
+(declare-fun p83 () Bool)
+(declare-fun p84 () Bool)
+(declare-fun p85 () Bool)
+(declare-fun p86 () Bool)
+(declare-fun p87 () Bool)
+(declare-fun p88 () Bool)
+(declare-fun p89 () Bool)
+(declare-fun p90 () Bool)
+(declare-fun p91 () Bool)
+(declare-fun p92 () Bool)
+(declare-fun p93 () Bool)
+(declare-fun p94 () Bool)
+(declare-fun p95 () Bool)
+(declare-fun p96 () Bool)
+(declare-fun p97 () Bool)
+(declare-fun p98 () Bool)
+(declare-fun p99 () Bool)
+(declare-fun p100 () Bool)
+(declare-fun p101 () Bool)
+(declare-fun p102 () Bool)
+(declare-fun p103 () Bool)
+(declare-fun p104 () Bool)
+(declare-fun p105 () Bool)
+(declare-fun p106 () Bool)
+(declare-fun p107 () Bool)
+(declare-fun p108 () Bool)
+(declare-fun p109 () Bool)
+(declare-fun p110 () Bool)
+(declare-fun p111 () Bool)
+(declare-fun p112 () Bool)
+(declare-fun p113 () Bool)
+(declare-fun p114 () Bool)
+(declare-fun p115 () Bool)
+(declare-fun p116 () Bool)
+(declare-fun p117 () Bool)
+(declare-fun p118 () Bool)
+(declare-fun p119 () Bool)
+(declare-fun p120 () Bool)
+(declare-fun p121 () Bool)
+(declare-fun p122 () Bool)
+(declare-fun p123 () Bool)
+(declare-fun p124 () Bool)
+(declare-fun p125 () Bool)
+(declare-fun p126 () Bool)
+(declare-fun p127 () Bool)
+(declare-fun p128 () Bool)
+(declare-fun p129 () Bool)
+(declare-fun p130 () Bool)
+(declare-fun p131 () Bool)
+(declare-fun p132 () Bool)
+(declare-fun p133 () Bool)
+(declare-fun p134 () Bool)
+(declare-fun p135 () Bool)
+(declare-fun p136 () Bool)
+(declare-fun p137 () Bool)
+(declare-fun p138 () Bool)
+(declare-fun p139 () Bool)
+(declare-fun p140 () Bool)
+(declare-fun p141 () Bool)
+(declare-fun p142 () Bool)
+(declare-fun p143 () Bool)
+(declare-fun p144 () Bool)
+(declare-fun p145 () Bool)
+(declare-fun p146 () Bool)
+(declare-fun p147 () Bool)
+(declare-fun p148 () Bool)
+(declare-fun p149 () Bool)
+(declare-fun p150 () Bool)
+(declare-fun p151 () Bool)
+(declare-fun p152 () Bool)
+(declare-fun p153 () Bool)
+(declare-fun p154 () Bool)
+(declare-fun p155 () Bool)
+(declare-fun p156 () Bool)
+(declare-fun p157 () Bool)
+(declare-fun p158 () Bool)
+(declare-fun p159 () Bool)
+(declare-fun p160 () Bool)
+(declare-fun p161 () Bool)
+(declare-fun p162 () Bool)
+(declare-fun p163 () Bool)
+(declare-fun p164 () Bool)
+(declare-fun p165 () Bool)
+(declare-fun p166 () Bool)
+(declare-fun p167 () Bool)
+(declare-fun p168 () Bool)
+(declare-fun p169 () Bool)
+(declare-fun p170 () Bool)
+(declare-fun p171 () Bool)
+(declare-fun p172 () Bool)
+(declare-fun p173 () Bool)
+(declare-fun p174 () Bool)
+(declare-fun p175 () Bool)
+(declare-fun p176 () Bool)
+(declare-fun p177 () Bool)
+(declare-fun p178 () Bool)
+(declare-fun p179 () Bool)
+(declare-fun p180 () Bool)
+(declare-fun p181 () Bool)
+(declare-fun p182 () Bool)
+(declare-fun p183 () Bool)
+(declare-fun p184 () Bool)
+(declare-fun p185 () Bool)
+(declare-fun p186 () Bool)
+(declare-fun p187 () Bool)
+(declare-fun p188 () Bool)
+(declare-fun p189 () Bool)
+(declare-fun p190 () Bool)
+(declare-fun p191 () Bool)
+(declare-fun p192 () Bool)
+(declare-fun p193 () Bool)
+(declare-fun p194 () Bool)
+(declare-fun p195 () Bool)
+(declare-fun p196 () Bool)
+(declare-fun p197 () Bool)
+(declare-fun p198 () Bool)
+(declare-fun p199 () Bool)
+(declare-fun p200 () Bool)
+(assert (or p35 p146 (not p196)))
+(assert (or (not p121) p167 p98))
+(assert (or (not p100) p111 p156))
+(assert (or (not p185) (not p59) p152))
+(assert (or p7 (not p167) (not p139)))
+(assert (or (not p109) (not p186) (not p8)))
+(assert (or p142 p60 p89))
+(assert (or (not p75) (not p6) (not p107)))
+(assert (or (not p48) p162 p186))
+(assert (or (not p185) p183 (not p129)))
+(assert (or p172 (not p49) p78))
+(assert (or (not p130) p101 (not p151)))
+(assert (or p104 (not p107) (not p171)))
+(assert (or p173 (not p189) p96))
+(assert (or p42 (not p134) p101))
+(assert (or (not p79) p181 p158))
+(assert (or (not p129) (not p59) (not p4)))
+(assert (or p60 (not p104) p132))
+(assert (or (not p69) (not p169) p141))
+(assert (or (not p190) (not p132) p34))
+(assert (or (not p15) p124 (not p94)))
+(assert (or p125 (not p92) (not p107)))
+(assert (or (not p157) (not p85) (not p118)))
+(assert (or (not p141) (not p150) (not p47)))
+(assert (or p66 (not p9) p173))
+(assert (or p194 (not p72) p64))
+(assert (or p75 (not p18) p43))
+(assert (or p70 (not p166) p183))
+(assert (or p30 p7 p80))
+(assert (or (not p28) p65 (not p187)))
+(assert (or p6 p58 (not p5)))
+(assert (or (not p115) (not p181) p130))
+(assert (or p162 (not p178) p133))
+(assert (or (not p173) p148 (not p83)))
+(assert (or p33 (not p55) p13))
+(assert (or p77 p191 p41))
+(assert (or (not p10) (not p152) p56))
+(assert (or (not p200) p181 p160))
+(assert (or (not p53) (not p147) p173))
+(assert (or (not p171) p100 (not p76)))
+(assert (or p103 (not p73) (not p5)))
+(assert (or p145 p35 p87))
+(assert (or (not p98) (not p141) (not p89)))
+(assert (or p197 p137 p61))
+(assert (or p43 p138 (not p55)))
+(assert (or p66 p95 (not p87)))
+(assert (or (not p155) p200 (not p184)))
+(assert (or p27 p83 (not p11)))
+(assert (or p38 (not p33) (not p88)))
+(assert (or p20 p147 p141))
+(assert (or (not p76) p145 p137))
+(assert (or (not p12) p76 p4))
+(assert (or (not p11) (not p49) p62))
+(assert (or p116 (not p43) p175))
+(assert (or (not p97) (not p139) p76))
+(assert (or p54 p167 (not p82)))
+(assert (or p76 p186 p153))
+(assert (or (not p17) p82 p154))
+(assert (or (not p159) p200 p139))
+(assert (or p47 p139 p54))
+(assert (or p72 (not p23) (not p193)))
+(assert (or p59 p100 (not p79)))
+(assert (or p149 (not p78) (not p63)))
+(assert (or p153 (not p24) p63))
+(assert (or (not p69) p142 p19))
+(assert (or p193 (not p92) p127))
+(assert (or (not p200) (not p84) p20))
+(assert (or p39 (not p37) (not p82)))
+(assert (or (not p155) p76 (not p33)))
+(assert (or (not p9) (not p200) (not p81)))
+(assert (or p142 p192 (not p177)))
+(assert (or p13 (not p183) (not p171)))
+(assert (or p115 p111 (not p141)))
+(assert (or p3 p102 (not p87)))
+(assert (or p107 p147 p5))
+(assert (or (not p33) p36 (not p67)))
+(assert (or p45 p157 (not p23)))
+(assert (or (not p129) (not p167) p113))
+(assert (or p81 p127 p176))
+(assert (or (not p144) p157 (not p187)))
+(assert (or (not p13) (not p19) p196))
+(assert (or p197 p53 (not p80)))
+(assert (or p43 p180 p189))
+(assert (or p156 p132 p147))
+(assert (or (not p146) p185 p194))
+(assert (or (not p164) p90 (not p99)))
+(assert (or (not p11) (not p135) p24))
+(assert (or (not p22) (not p36) (not p199)))
+(assert (or (not p21) p114 (not p62)))
+(assert (or (not p111) p102 (not p43)))
+(assert (or p125 (not p55) (not p31)))
+(assert (or p170 (not p76) p72))
+(assert (or (not p49) p136 (not p113)))
+(assert (or p63 p67 p53))
+(assert (or p80 (not p150) (not p194)))
+(assert (or p44 (not p140) (not p92)))
+(assert (or p147 p99 (not p53)))
+(assert (or p31 p146 (not p192)))
+(assert (or p186 p167 (not p35)))
+(assert (or p112 (not p129) p174))
+(assert (or p114 (not p184) p116))
+(assert (or p188 (not p175) p147))
+(assert (or (not p53) (not p143) (not p1)))
+(assert (or p190 (not p187) (not p131)))
+(assert (or (not p133) (not p105) (not p191)))
+(assert (or (not p116) p159 p172))
+(assert (or (not p100) p149 (not p110)))
+(assert (or p188 (not p180) p192))
+(assert (or p167 (not p75) p162))
+(assert (or (not p200) (not p102) (not p70)))
+(assert (or (not p155) (not p3) p90))
+(assert (or p176 (not p140) p78))
+(assert (or p120 p131 (not p12)))
+(assert (or p18 p91 (not p169)))
+(assert (or p42 (not p177) (not p24)))
+(assert (or (not p54) p136 p61))
+(assert (or p134 (not p169) p95))
+(assert (or (not p77) (not p168) p189))
+(assert (or p157 p190 p60))
+(assert (or (not p67) p157 (not p85)))
+(assert (or (not p63) (not p170) p8))
+(assert (or (not p111) p195 (not p64)))
+(assert (or (not p43) (not p149) p114))
+(assert (or p68 (not p118) (not p135)))
+(assert (or (not p113) p93 (not p80)))
+(assert (or p184 p175 p79))
+(assert (or p26 (not p48) (not p12)))
+(assert (or p56 (not p175) (not p9)))
+(assert (or (not p157) p114 (not p88)))
+(assert (or p45 p25 p57))
+(assert (or (not p44) p60 (not p61)))
+(assert (or p55 p116 p184))
+(assert (or p55 p21 p12))
+(assert (or (not p99) p149 (not p74)))
+(assert (or (not p195) p166 p39))
+(assert (or (not p171) p139 p15))
+(assert (or p167 p78 (not p4)))
+(assert (or p11 p71 p200))
+(assert (or p164 (not p34) p191))
+(assert (or (not p115) (not p100) (not p85)))
+(assert (or (not p63) (not p16) p151))
+(assert (or (not p155) (not p179) (not p144)))
+(assert (or p141 (not p106) p138))
+(assert (or p170 (not p18) (not p183)))
+(assert (or (not p19) p65 (not p46)))
+(assert (or (not p110) (not p12) (not p14)))
+(assert (or (not p129) p95 (not p26)))
+(assert (or (not p114) (not p171) (not p33)))
+(assert (or (not p115) p7 (not p189)))
+(assert (or (not p22) p78 p9))
+(assert (or (not p189) (not p34) (not p67)))
+(assert (or (not p78) (not p25) p109))
+(assert (or (not p87) (not p131) p101))
+(assert (or (not p168) (not p115) (not p135)))
+(assert (or p180 (not p134) (not p138)))
+(assert (or p191 (not p41) p52))
+(assert (or p89 p33 (not p148)))
+(assert (or p137 p81 p107))
+(assert (or p192 p134 p129))
+(assert (or p187 (not p84) p147))
+(assert (or (not p94) (not p190) (not p98)))
+(assert (or (not p15) (not p35) (not p13)))
+(assert (or (not p63) p180 (not p147)))
+(assert (or p165 (not p95) p104))
+(assert (or p130 (not p43) (not p8)))
+(assert (or p29 (not p48) p197))
+(assert (or p26 p140 p175))
+(assert (or (not p162) (not p147) (not p135)))
+(assert (or (not p56) p165 (not p45)))
+(assert (or p125 p182 p73))
+(assert (or (not p61) (not p109) (not p116)))
+(assert (or (not p124) (not p186) p19))
+(assert (or (not p52) p3 (not p192)))
+(assert (or (not p20) (not p104) (not p158)))
+(assert (or p11 (not p91) (not p118)))
+(assert (or p165 p2 (not p139)))
+(assert (or (not p192) (not p81) (not p199)))
+(assert (or (not p135) (not p106) (not p139)))
+(assert (or p155 p162 (not p149)))
+(assert (or (not p151) (not p36) p141))
+(assert (or (not p3) p109 p189))
+(assert (or (not p73) (not p169) (not p193)))
+(assert (or p2 (not p99) p69))
+(assert (or p192 p124 p197))
+(assert (or p91 (not p38) (not p107)))
+(assert (or (not p95) (not p33) p151))
+(assert (or p132 p74 p190))
+(assert (or (not p125) (not p56) p184))
+(assert (or p109 (not p24) p17))
+(assert (or p7 (not p27) p65))
+(assert (or (not p167) p186 (not p48)))
+(assert (or (not p14) p141 (not p56)))
+(assert (or (not p27) (not p189) (not p142)))
+(assert (or p68 (not p176) (not p72)))
+(assert (or (not p13) (not p55) p174))
+(assert (or (not p115) (not p76) p175))
+(assert (or p123 (not p28) p39))
+(assert (or (not p134) (not p66) (not p107)))
+(assert (or (not p127) (not p163) (not p140)))
+(assert (or (not p125) (not p27) p3))
+(assert (or (not p182) p69 (not p15)))
+(assert (or p26 (not p59) p131))
+(assert (or p34 (not p66) (not p50)))
+(assert (or (not p15) (not p137) p156))
+(assert (or p123 p179 p79))
+(assert (or p121 (not p62) (not p87)))
+(assert (or (not p149) p178 p116))
+(assert (or (not p177) (not p35) p166))
+(assert (or p160 p127 p123))
+(assert (or (not p66) (not p58) p23))
+(assert (or p45 p176 (not p30)))
+(assert (or p79 p109 p84))
+(assert (or (not p158) p57 (not p22)))
+(assert (or (not p88) p69 p154))
+(assert (or p89 (not p36) (not p30)))
+(assert (or p11 (not p89) p20))
+(assert (or p64 p69 p136))
+(assert (or (not p103) p96 (not p185)))
+(assert (or (not p71) (not p3) p132))
+(assert (or (not p165) (not p186) p33))
+(assert (or (not p174) p148 p159))
+(assert (or (not p101) (not p78) p57))
+(assert (or p131 (not p29) p45))
+(assert (or p6 (not p65) p138))
+(assert (or (not p104) p182 (not p27)))
+(assert (or (not p93) (not p140) (not p143)))
+(assert (or p8 p159 p79))
+(assert (or (not p149) p37 (not p174)))
+(assert (or (not p197) p86 (not p94)))
+(assert (or p98 (not p113) p104))
+(assert (or (not p171) p176 (not p164)))
+(assert (or (not p165) (not p34) p98))
+(assert (or (not p8) p200 (not p111)))
+(assert (or p105 p104 (not p156)))
+(assert (or p166 p181 p179))
+(assert (or (not p36) (not p136) (not p131)))
+(assert (or (not p146) (not p168) p92))
+(assert (or (not p160) p62 p28))
+(assert (or p199 (not p11) p181))
+(assert (or (not p169) (not p161) p198))
+(assert (or (not p92) p76 (not p194)))
+(assert (or p163 p157 p133))
+(assert (or (not p132) p45 p140))
+(assert (or p182 (not p32) p150))
+(assert (or p45 p102 (not p184)))
+(assert (or (not p85) p169 p63))
+(assert (or (not p127) (not p167) p198))
+(assert (or (not p103) (not p139) (not p31)))
+(assert (or p39 (not p4) (not p97)))
+(assert (or p47 (not p118) (not p197)))
+(assert (or (not p40) p135 p28))
+(assert (or (not p163) p181 (not p189)))
+(assert (or (not p2) (not p140) (not p64)))
+(assert (or p88 (not p170) (not p62)))
+(assert (or (not p42) (not p45) p97))
+(assert (or p11 (not p133) (not p186)))
+(assert (or p138 p20 (not p64)))
+(assert (or (not p13) (not p100) p23))
+(assert (or p133 (not p62) p200))
+(assert (or p72 p186 (not p107)))
+(assert (or (not p82) (not p198) (not p137)))
+(assert (or p142 p43 p179))
+(assert (or p72 p93 p39))
+(assert (or (not p185) p160 p22))
+(assert (or p66 (not p65) p90))
+(assert (or p34 (not p65) (not p58)))
+(assert (or (not p51) p140 p110))
+(assert (or p118 (not p101) p183))
+(assert (or (not p171) p15 (not p8)))
+(assert (or (not p152) (not p153) (not p34)))
+(assert (or p98 (not p36) p74))
+(assert (or p192 p46 p58))
+(assert (or (not p75) p23 p132))
+(assert (or p75 p160 p152))
+(assert (or (not p159) p15 (not p14)))
+(assert (or (not p162) (not p27) p29))
+(assert (or p54 (not p130) (not p102)))
+(assert (or p99 (not p170) p133))
+(assert (or (not p1) (not p184) (not p31)))
+(assert (or (not p170) p124 (not p140)))
+(assert (or p172 p142 p129))
+(assert (or p170 p108 (not p103)))
+(assert (or p34 (not p48) p144))
+(assert (or (not p101) p187 p138))
+(assert (or p20 p174 p192))
+(assert (or p45 (not p153) (not p129)))
+(assert (or (not p51) (not p60) (not p93)))
+(assert (or p17 (not p88) p14))
+(assert (or p38 (not p74) (not p121)))
+(assert (or (not p145) (not p102) (not p24)))
+(assert (or p166 p78 (not p101)))
+(assert (or p13 p142 (not p123)))
+(assert (or (not p39) (not p153) p151))
+(assert (or p156 (not p199) (not p93)))
+(assert (or p148 (not p149) p30))
+(assert (or (not p86) p87 p95))
+(assert (or p19 (not p125) p163))
+(assert (or (not p140) p1 p42))
+(assert (or p149 p38 (not p151)))
+(assert (or (not p93) p88 p67))
+(assert (or (not p162) p64 p68))
+(assert (or (not p159) (not p22) (not p20)))
+(assert (or p106 (not p22) p33))
+(assert (or (not p54) p26 (not p71)))
+(assert (or (not p53) p140 p20))
+(assert (or p133 p35 (not p10)))
+(assert (or (not p8) (not p81) p107))
+(assert (or (not p151) (not p180) p170))
+(assert (or (not p51) (not p60) (not p30)))
+(assert (or p185 p69 (not p118)))
+(assert (or p86 (not p158) (not p186)))
+(assert (or p4 (not p126) p9))
+(assert (or (not p59) p196 (not p22)))
+(assert (or p52 p54 p114))
+(assert (or p101 p168 (not p19)))
+(assert (or (not p77) p149 p110))
+(assert (or (not p27) (not p169) (not p161)))
+(assert (or p182 (not p150) p88))
+(assert (or (not p132) (not p127) (not p156)))
+(assert (or (not p123) (not p154) (not p175)))
+(assert (or (not p155) (not p121) (not p43)))
+(assert (or (not p145) p196 p102))
+(assert (or (not p155) p194 p12))
+(assert (or (not p131) (not p114) (not p54)))
+(assert (or (not p161) p38 p99))
+(assert (or (not p3) p66 p193))
+(assert (or (not p84) (not p87) (not p80)))
+(assert (or p54 (not p184) (not p21)))
+(assert (or (not p17) (not p33) (not p200)))
+(assert (or (not p60) p7 (not p165)))
+(assert (or (not p130) p192 p147))
+(assert (or (not p135) p119 p19))
+(assert (or (not p11) p159 p62))
+(assert (or (not p54) p160 (not p39)))
+(assert (or (not p93) p1 p183))
+(assert (or (not p173) p38 p8))
+(assert (or (not p132) p126 (not p82)))
+(assert (or p141 (not p170) (not p71)))
+(assert (or (not p164) (not p126) (not p30)))
+(assert (or p192 p68 p112))
+(assert (or p132 (not p131) (not p42)))
+(assert (or (not p18) p56 (not p1)))
+(assert (or p6 (not p17) p15))
+(assert (or (not p5) p157 p3))
+(assert (or p149 p141 p134))
+(assert (or (not p16) p62 p143))
+(assert (or p31 (not p5) (not p145)))
+(assert (or p56 (not p58) p46))
+(assert (or p81 p186 p38))
+(assert (or p192 p74 p89))
+(assert (or p59 p171 (not p48)))
+(assert (or p30 p23 p191))
+(assert (or p109 p64 p185))
+(assert (or (not p90) (not p92) (not p117)))
+(assert (or p98 (not p174) (not p99)))
+(assert (or (not p126) p88 p46))
+(assert (or p112 (not p71) p137))
+(assert (or p95 p105 (not p117)))
+(assert (or p131 p5 (not p95)))
+(assert (or p141 p183 (not p187)))
+(assert (or (not p35) p42 p21))
+(assert (or (not p81) p44 p71))
+(assert (or (not p141) (not p91) (not p116)))
+(assert (or p18 p176 p48))
+(assert (or (not p50) p167 (not p92)))
+(assert (or (not p91) p129 (not p161)))
+(assert (or (not p48) (not p97) (not p9)))
+(assert (or (not p54) p16 (not p64)))
+(assert (or p63 (not p93) (not p198)))
+(assert (or (not p2) p51 (not p25)))
+(assert (or p69 p37 (not p42)))
+(assert (or (not p139) p154 (not p111)))
+(assert (or p47 (not p132) p92))
+(assert (or p59 p196 p37))
+(assert (or (not p93) p48 p13))
+(assert (or p179 (not p55) (not p23)))
+(assert (or (not p43) (not p148) (not p177)))
+(assert (or (not p5) (not p56) (not p81)))
+(assert (or p94 p128 (not p144)))
+(assert (or (not p171) p190 p146))
+(assert (or p147 (not p23) p124))
+(assert (or p169 p166 p83))
+(assert (or (not p81) (not p68) p65))
+(assert (or (not p4) p76 p42))
+(assert (or p157 (not p56) (not p72)))
+(assert (or p148 p73 p156))
+(assert (or (not p25) (not p102) (not p92)))
+(assert (or (not p102) (not p116) p39))
+(assert (or p187 p164 (not p64)))
+(assert (or (not p121) (not p146) (not p124)))
+(assert (or p145 p182 (not p128)))
+(assert (or (not p190) p116 (not p43)))
+(assert (or p95 (not p91) (not p113)))
+(assert (or (not p23) p114 p195))
+(assert (or p12 (not p94) (not p146)))
+(assert (or p123 (not p3) p148))
+(assert (or p168 p42 p131))
+(assert (or (not p81) p68 p36))
+(assert (or p190 (not p159) p136))
+(assert (or p118 (not p131) (not p142)))
+(assert (or p80 p152 p53))
+(assert (or p88 (not p31) (not p109)))
+(assert (or (not p159) p113 (not p116)))
+(assert (or p14 (not p22) p185))
+(assert (or p102 (not p47) p122))
+(assert (or p50 p152 p116))
+(assert (or p194 (not p45) p154))
+(assert (or (not p16) (not p172) p17))
+(assert (or (not p82) p114 p86))
+(assert (or p120 (not p72) p105))
+(assert (or (not p139) p110 p158))
+(assert (or (not p38) p90 (not p36)))
+(assert (or (not p56) p117 p167))
+(assert (or (not p14) (not p117) (not p39)))
+(assert (or p102 p4 (not p100)))
+(assert (or p78 (not p165) p149))
+(assert (or p26 p126 (not p47)))
+(assert (or (not p138) p82 (not p81)))
+(assert (or (not p163) (not p88) (not p186)))
+(assert (or p83 (not p125) p177))
+(assert (or (not p62) (not p138) p52))
+(assert (or p83 p159 p195))
+(assert (or (not p93) (not p154) p153))
+(assert (or p74 (not p58) (not p81)))
+(assert (or (not p45) (not p3) p100))
+(assert (or p200 (not p158) p57))
+(assert (or p53 p182 p76))
+(assert (or (not p105) (not p40) (not p29)))
+(assert (or p193 p88 (not p37)))
+(assert (or (not p180) p134 p71))
+(assert (or p138 (not p42) p38))
+(assert (or (not p35) (not p86) p156))
+(assert (or (not p36) p6 (not p92)))
+(assert (or (not p152) p126 (not p9)))
+(assert (or p145 p37 (not p54)))
+(assert (or p90 (not p17) (not p99)))
+(assert (or (not p185) (not p62) (not p53)))
+(assert (or (not p78) p11 (not p69)))
+(assert (or p198 p29 (not p103)))
+(assert (or (not p148) (not p134) p182))
+(assert (or (not p96) p166 p90))
+(assert (or p141 p53 p51))
+(assert (or (not p172) p101 p117))
+(assert (or p45 (not p135) p2))
+(assert (or (not p34) p61 p178))
+(assert (or p88 p150 (not p192)))
+(assert (or p134 p94 (not p150)))
+(assert (or p163 p164 p32))
+(assert (or p34 (not p39) p74))
+(assert (or p193 (not p151) (not p111)))
+(assert (or (not p33) p138 (not p173)))
+(assert (or p105 (not p62) p134))
+(assert (or (not p30) (not p18) p54))
+(assert (or (not p25) p91 (not p28)))
+(assert (or (not p152) (not p23) p1))
+(assert (or p79 p125 p157))
+(assert (or (not p161) p11 (not p172)))
+(assert (or (not p113) (not p57) (not p69)))
+(assert (or p123 (not p114) (not p137)))
+(assert (or (not p113) p117 (not p76)))
+(assert (or (not p169) (not p102) (not p195)))
+(assert (or p144 (not p153) p102))
+(assert (or (not p17) (not p38) (not p127)))
+(assert (or (not p67) p80 (not p139)))
+(assert (or p36 (not p117) (not p10)))
+(assert (or (not p139) p96 p33))
+(assert (or (not p69) p160 (not p17)))
+(assert (or p186 p129 p178))
+(assert (or (not p83) (not p155) (not p159)))
+(assert (or p115 p24 (not p157)))
+(assert (or p12 p49 p44))
+(assert (or (not p143) p136 (not p79)))
+(assert (or (not p59) (not p56) (not p23)))
+(assert (or p112 (not p69) p158))
+(assert (or (not p153) p68 (not p15)))
+(assert (or p73 (not p122) p109))
+(assert (or (not p197) (not p174) (not p9)))
+(assert (or (not p107) (not p91) (not p131)))
+(assert (or p59 p16 (not p94)))
+(assert (or (not p57) (not p66) (not p40)))
+(assert (or (not p28) (not p123) (not p176)))
+(assert (or (not p121) (not p80) (not p68)))
+(assert (or (not p54) (not p34) (not p177)))
+(assert (or (not p98) p118 (not p138)))
+(assert (or (not p166) p26 (not p76)))
+(assert (or p26 p64 p63))
+(assert (or (not p181) (not p165) p153))
+(assert (or (not p108) (not p194) p7))
+(assert (or p33 p16 p75))
+(assert (or (not p154) p70 (not p123)))
+(assert (or (not p28) (not p84) p40))
+(assert (or (not p173) (not p174) p7))
+(assert (or (not p95) p117 (not p68)))
+(assert (or p105 (not p181) p98))
+(assert (or p197 (not p144) p101))
+(assert (or p8 p97 (not p16)))
+(assert (or (not p117) p22 p76))
+(assert (or p19 p12 (not p150)))
+(assert (or (not p159) p92 (not p84)))
+(assert (or (not p135) (not p64) (not p84)))
+(assert (or (not p180) p56 (not p80)))
+(assert (or p183 p78 (not p151)))
+(assert (or (not p59) p38 p62))
+(assert (or (not p36) (not p43) (not p142)))
+(assert (or (not p19) p81 p99))
+(assert (or (not p56) p103 p29))
+(assert (or (not p164) (not p75) p131))
+(assert (or p18 p19 (not p60)))
+(assert (or (not p118) p3 (not p154)))
+(assert (or p50 (not p4) p63))
+(assert (or p79 p68 (not p90)))
+(assert (or p161 p200 p113))
+(assert (or (not p78) p30 p64))
+(assert (or (not p163) (not p35) (not p160)))
+(assert (or (not p113) (not p187) p8))
+(assert (or p137 p3 p58))
+(assert (or (not p148) p22 p133))
+(assert (or (not p72) p91 p67))
+(assert (or p136 p137 p120))
+(assert (or p101 p35 p159))
+(assert (or p82 p38 p57))
+(assert (or (not p152) p122 (not p129)))
+(assert (or (not p34) (not p143) (not p106)))
+(assert (or (not p56) (not p50) (not p78)))
+(assert (or p6 (not p146) (not p69)))
+(assert (or p42 p59 (not p23)))
+(assert (or p104 p73 (not p4)))
+(assert (or p182 p151 (not p111)))
+(assert (or (not p145) (not p120) (not p170)))
+(assert (or p58 p17 (not p33)))
+(assert (or p95 (not p111) p150))
+(assert (or (not p104) (not p92) p99))
+(assert (or (not p159) (not p28) (not p47)))
+(assert (or (not p20) p7 (not p108)))
+(assert (or (not p118) (not p29) p161))
+(assert (or (not p90) (not p132) p24))
+(assert (or (not p151) p135 (not p197)))
+(assert (or (not p111) (not p176) p80))
+(assert (or p99 p8 p129))
+(assert (or (not p22) p84 p161))
+(assert (or p21 (not p44) (not p117)))
+(assert (or (not p116) (not p174) p121))
+(assert (or (not p126) p145 p22))
+(assert (or p10 p69 (not p80)))
+(assert (or (not p87) p5 (not p117)))
+(assert (or p89 p189 p183))
+(assert (or p40 p46 p60))
+(assert (or (not p117) p138 p159))
+(assert (or (not p66) p173 (not p133)))
+(assert (or p155 (not p184) p97))
+(assert (or p87 (not p145) (not p7)))
+(assert (or (not p42) (not p111) (not p140)))
+(assert (or (not p45) p69 p106))
+(assert (or (not p182) p117 p102))
+(assert (or (not p140) p184 (not p181)))
+(assert (or (not p19) p68 (not p182)))
+(assert (or p151 (not p65) p126))
+(assert (or p39 p29 p99))
+(assert (or (not p187) p168 p120))
+(assert (or p121 (not p190) p165))
+(assert (or p82 p98 (not p168)))
+(assert (or (not p113) p144 (not p90)))
+(assert (or p191 p112 p151))
+(assert (or (not p91) (not p97) p18))
+(assert (or (not p46) (not p38) p196))
+(assert (or p53 (not p123) (not p181)))
+(assert (or p183 p42 (not p198)))
+(assert (or p166 (not p103) p109))
+(assert (or p20 p7 p95))
+(assert (or p131 (not p151) (not p70)))
+(assert (or (not p88) (not p21) (not p152)))
+(assert (or (not p143) p191 p121))
+(assert (or (not p47) p72 (not p50)))
+(assert (or p70 p179 p175))
+(assert (or p102 (not p119) p62))
+(assert (or (not p155) (not p7) p162))
+(assert (or (not p198) p169 (not p5)))
+(assert (or (not p196) (not p137) p81))
+(assert (or (not p195) (not p188) (not p14)))
+(assert (or p177 (not p167) (not p25)))
+(assert (or (not p5) p3 (not p199)))
+(assert (or p45 (not p104) (not p189)))
+(assert (or p133 (not p180) (not p157)))
+(assert (or (not p121) (not p186) p76))
+(assert (or (not p174) (not p9) (not p200)))
+(assert (or p38 (not p83) (not p44)))
+(assert (or (not p143) (not p170) (not p33)))
+(assert (or p158 (not p101) (not p67)))
+(assert (or (not p190) (not p75) p41))
+(assert (or (not p32) (not p66) (not p3)))
+(assert (or p28 (not p120) p39))
+(assert (or (not p21) (not p28) p25))
+(assert (or (not p65) p107 (not p38)))
+(assert (or (not p100) p158 (not p160)))
+(assert (or p44 (not p91) (not p155)))
+(assert (or (not p172) p44 (not p84)))
+(assert (or (not p193) p13 p4))
+(assert (or (not p1) (not p170) (not p13)))
+(assert (or p160 p195 (not p66)))
+(assert (or (not p58) p79 (not p165)))
+(assert (or (not p191) p7 (not p94)))
+(assert (or p173 p40 (not p71)))
+(assert (or (not p85) (not p159) p37))
+(assert (or (not p182) p124 p92))
+(assert (or p160 (not p113) (not p29)))
+(assert (or p82 (not p51) p54))
+(assert (or (not p66) p1 (not p126)))
+(assert (or p24 p133 p71))
+(assert (or (not p30) (not p171) (not p113)))
+(assert (or p42 (not p56) p70))
+(assert (or p65 p146 (not p194)))
+(assert (or p200 p153 (not p138)))
+(assert (or p45 (not p179) p52))
+(assert (or (not p177) p95 (not p193)))
+(assert (or p101 (not p87) p147))
+(assert (or (not p151) (not p177) p66))
+(assert (or (not p91) (not p158) p20))
+(assert (or (not p157) (not p121) p89))
+(assert (or (not p136) p14 (not p44)))
+(assert (or p113 p76 p109))
+(assert (or (not p188) p151 (not p54)))
+(assert (or (not p127) (not p26) p105))
+(assert (or p183 p169 (not p127)))
+(assert (or (not p10) p77 (not p76)))
+(assert (or p78 (not p122) p35))
+(assert (or (not p11) (not p80) p129))
+(assert (or p68 (not p41) (not p75)))
+(assert (or p67 (not p100) (not p173)))
+(assert (or p185 (not p44) (not p99)))
+(assert (or (not p82) p14 (not p134)))
+(assert (or p159 (not p161) p180))
+(assert (or p160 (not p91) (not p133)))
+(assert (or (not p9) p86 (not p5)))
+(assert (or (not p191) p72 (not p172)))
+(assert (or p75 p162 (not p43)))
+(assert (or p139 p176 (not p169)))
+(assert (or p13 (not p59) (not p86)))
+(assert (or p149 (not p131) p173))
+(assert (or (not p168) (not p46) (not p200)))
+(assert (or p125 p19 p164))
+(assert (or p1 p73 (not p9)))
+(assert (or p194 p115 (not p178)))
+(assert (or (not p123) p45 (not p66)))
+(assert (or (not p142) p3 p146))
+(assert (or (not p25) p66 p42))
+(assert (or (not p180) (not p175) (not p148)))
+(assert (or p57 p104 p175))
+(assert (or p158 (not p198) p45))
+(assert (or p107 (not p49) (not p41)))
+(assert (or p86 (not p171) (not p65)))
+(assert (or (not p64) (not p172) (not p75)))
+(assert (or p183 (not p162) (not p69)))
+(assert (or (not p57) p198 p49))
+(assert (or p44 (not p189) p83))
+(assert (or p57 (not p100) p68))
+(assert (or (not p197) (not p9) p40))
+(assert (or (not p94) (not p104) p200))
+(assert (or (not p72) (not p68) p124))
+(assert (or p100 (not p16) p19))
+(assert (or p79 p11 (not p69)))
+(assert (or (not p158) (not p127) p111))
+(assert (or p94 p156 p185))
+(assert (or p101 (not p75) (not p25)))
+(assert (or (not p94) p146 (not p110)))
+(assert (or p14 (not p112) (not p156)))
+(assert (or (not p123) p99 p45))
+(assert (or p89 (not p83) p130))
+(assert (or (not p162) p124 p145))
+(assert (or p64 (not p196) (not p34)))
+(assert (or (not p2) p96 (not p74)))
+(assert (or p169 (not p174) (not p38)))
+(assert (or p69 p196 (not p34)))
+(assert (or (not p155) (not p107) p56))
+(assert (or p155 p17 p128))
+(assert (or (not p49) p157 p158))
+(assert (or (not p17) (not p198) (not p193)))
+(assert (or p92 (not p136) p72))
+(assert (or (not p143) (not p148) (not p182)))
+(assert (or p31 p112 (not p190)))
+(assert (or (not p101) p86 (not p172)))
+(assert (or p13 (not p95) p159))
+(assert (or p96 (not p91) (not p40)))
+(assert (or (not p154) p54 (not p33)))
+(assert (or (not p23) (not p168) (not p59)))
+(assert (or p77 p127 (not p184)))
+(assert (or (not p80) p192 (not p77)))
+(assert (or p117 p84 (not p108)))
+(assert (or (not p190) p98 p42))
+(assert (or (not p125) p95 (not p141)))
+(assert (or (not p171) (not p112) p100))
+(assert (or (not p161) (not p12) p168))
+(assert (or p35 p113 p180))
+(assert (or p130 p98 (not p178)))
+(assert (or p99 (not p124) p94))
+(assert (or p124 (not p51) (not p44)))
+(assert (or (not p165) (not p179) (not p77)))
+(assert (or p157 (not p148) p130))
+(assert (or (not p32) (not p198) (not p146)))
+(assert (or p23 (not p136) p167))
+(assert (or (not p36) (not p140) p12))
+(assert (or p171 (not p191) (not p92)))
+(assert (or p119 p22 (not p101)))
+(assert (or p96 (not p161) (not p2)))
+(assert (or p79 (not p180) (not p45)))
+(assert (or p191 p85 (not p86)))
+(assert (or p182 (not p47) p154))
+(assert (or (not p152) (not p135) p70))
+(assert (or p4 p34 (not p193)))
+(assert (or p128 (not p10) (not p99)))
+(assert (or p59 p133 p150))
+(assert (or (not p39) (not p200) p122))
+(assert (or (not p90) (not p20) (not p154)))
+(assert (or p141 (not p40) (not p34)))
+(assert (or p85 (not p50) (not p34)))
+(assert (or (not p33) (not p199) p9))
+(assert (or p38 p180 (not p3)))
+(assert (or (not p183) p102 (not p80)))
+(assert (or (not p115) p90 p75))
+(assert (or (not p80) p59 (not p178)))
+(assert (or p21 (not p153) p119))
+(assert (or (not p183) p101 (not p189)))
+(assert (or (not p159) p71 (not p47)))
+(assert (or p85 (not p89) (not p23)))
+(assert (or (not p53) (not p85) (not p144)))
+(assert (or (not p111) p147 (not p92)))
+(assert (or (not p91) p48 p176))
+(assert (or p117 (not p111) p56))
+(assert (or p101 (not p95) (not p149)))
+(assert (or p19 (not p49) p106))
+(assert (or p31 (not p115) p85))
+(assert (or p174 (not p36) p50))
+(assert (or (not p149) p80 (not p15)))
+(assert (or (not p29) p47 (not p181)))
+(assert (or p120 (not p111) p14))
+(assert (or (not p75) (not p191) p97))
+(assert (or p179 p131 (not p60)))
+(assert (or p93 (not p137) p134))
+(assert (or (not p89) (not p61) p62))
+(assert (or p107 (not p43) (not p61)))
+(assert (or (not p15) p168 p40))
+(assert (or p140 (not p69) p59))
+(assert (or (not p66) p106 p92))
+(assert (or (not p173) p118 (not p10)))
+(assert (or p173 p190 p100))
+(assert (or (not p31) (not p150) p176))
+(assert (or p54 p32 p162))
+(assert (or p55 p88 (not p76)))
+(assert (or p147 p183 p131))
+(assert (or (not p8) (not p19) p78))
+(assert (or (not p76) (not p107) p48))
+(assert (or p187 p119 p57))
+(assert (or (not p122) (not p127) (not p91)))
+(assert (or (not p193) p31 p55))
+(assert (or (not p187) p46 p195))
+(assert (or (not p37) p18 (not p132)))
+(assert (or (not p195) p129 (not p140)))
+(assert (or p78 p122 (not p35)))
+(assert (or p173 p149 p89))
+(assert (or p70 (not p53) (not p172)))
+(assert (or p176 (not p160) p107))
+(assert (or (not p84) p115 (not p175)))
+(assert (or p59 p131 (not p82)))
+(assert (or (not p64) p106 p8))
+(assert (or (not p22) p43 (not p120)))
+(assert (or p57 p75 (not p155)))
+(assert (or p31 (not p190) (not p111)))
+(assert (or (not p142) p16 (not p170)))
+(assert (or (not p43) p133 p125))
+(assert (or p166 (not p82) (not p79)))
+(assert (or (not p9) p89 (not p73)))
+(assert (or (not p71) p44 (not p74)))
+(assert (or (not p179) p10 p33))
+(assert (or p121 (not p43) p75))
+(assert (or p164 (not p157) p146))
+(assert (or (not p198) (not p7) p159))
+(assert (or (not p148) p146 (not p5)))
+(assert (or (not p91) p150 (not p9)))
+(assert (or p49 p3 (not p33)))
+(assert (or (not p26) p107 p116))
+(assert (or (not p109) (not p40) (not p90)))
+(assert (or p22 (not p117) (not p93)))
+(assert (or p26 (not p53) p155))
+(assert (or (not p21) (not p54) (not p192)))
+(assert (or (not p126) p145 p119))
+(assert (or (not p198) (not p164) (not p135)))
+(assert (or p37 (not p1) p45))
+(assert (or p199 p35 p178))
+(assert (or p125 (not p130) (not p141)))
+(assert (or (not p140) p166 p130))
+(assert (or p33 p172 (not p170)))
+(assert (or p157 (not p36) p113))
+(assert (or (not p173) (not p16) p89))
+(assert (or (not p199) p175 p146))
+(assert (or (not p154) (not p163) (not p186)))
+(assert (or (not p172) (not p19) (not p1)))
+(assert (or p34 (not p141) p65))
+(assert (or (not p175) p72 (not p170)))
+(assert (or p41 p105 (not p21)))
+(assert (or (not p129) p27 p3))
+(assert (or p154 (not p183) (not p55)))
+(assert (or p117 (not p132) (not p7)))
+(assert (or p169 p80 p40))
+(assert (or p7 p160 p81))
+(assert (or p66 p168 p147))
+(assert (or (not p74) p8 (not p165)))
+(assert (or p63 p152 (not p158)))
+(assert (or (not p51) p146 (not p94)))
+(assert (or p21 (not p77) (not p60)))
+(assert (or (not p78) (not p36) (not p77)))
+(assert (or (not p77) p134 p26))
+(assert (or (not p193) p26 (not p8)))
+(assert (or p2 p76 p178))
+(assert (or (not p141) (not p52) p133))
+(assert (or p111 p179 p192))
+(assert (or p63 p30 p93))
+(assert (or p189 p105 (not p116)))
+(assert (or (not p191) p158 p168))
+(assert (or (not p175) (not p67) (not p34)))
+(assert (or p195 (not p107) (not p52)))
+(assert (or (not p165) (not p58) (not p51)))
+(assert (or (not p50) p78 (not p80)))
+(assert (or (not p8) p174 (not p64)))
+(assert (or p180 (not p30) (not p4)))
+(assert (or p193 (not p100) (not p126)))
+(assert (or p58 p154 p90))
+(assert (or p36 p192 (not p97)))
+(assert (or (not p10) (not p141) p117))
+(assert (or (not p180) (not p96) p191))
+(assert (or p3 p30 (not p100)))
+(assert (or p195 p131 (not p123)))
+(assert (or (not p110) (not p189) (not p117)))
+(assert (or p44 p131 p11))
+(assert (or p29 (not p157) (not p43)))
+(assert (or p34 (not p24) (not p67)))
+(assert (or p48 p117 p109))
+(assert (or (not p106) (not p10) (not p120)))
+(assert (or p133 (not p186) (not p12)))
+(assert (or (not p106) p119 (not p28)))
+(assert (or p7 p68 (not p154)))
+(assert (or p8 p36 p140))
+(assert (or (not p78) (not p191) p106))
+(assert (or p135 p127 (not p134)))
+(assert (or (not p39) (not p118) p104))
+(assert (or p143 (not p20) (not p136)))
+(assert (or (not p53) p156 (not p153)))
+(assert (or p197 (not p45) p180))
+(assert (or (not p164) (not p190) (not p179)))
+(assert (or p95 p80 p105))
+(assert (or p160 p180 p106))
+(assert (or p164 (not p178) (not p65)))
+(assert (or p76 p136 p127))
+(assert (or (not p166) p179 (not p122)))
+(check-sat)
@@ -0,0 +1,86 @@
+; COMMAND-LINE: --incremental --sat-inprocess --sat-inprocess-interval=1
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_UF)
+(declare-sort Hole 0)
+(declare-const h1 Hole)
+(declare-const h2 Hole)
+(declare-const h3 Hole)
+(declare-const h4 Hole)
+(declare-const q1 Hole)
+(declare-const p1_1 Bool)
+(declare-const p1_2 Bool)
+(declare-const p1_3 Bool)
+(declare-const p1_4 Bool)
+(assert (or (and p1_1 (= q1 h1)) (and p1_2 (= q1 h2)) (and p1_3 (= q1 h3)) (and p1_4 (= q1 h4))))
+(declare-const q2 Hole)
+(declare-const p2_1 Bool)
+(declare-const p2_2 Bool)
+(declare-const p2_3 Bool)
+(declare-const p2_4 Bool)
+(assert (or (and p2_1 (= q2 h1)) (and p2_2 (= q2 h2)) (and p2_3 (= q2 h3)) (and p2_4 (= q2 h4))))
+(assert (not (and p1_1 p2_1)))
+(assert (not (and p1_2 p2_2)))
+(assert (not (and p1_3 p2_3)))
+(assert (not (and p1_4 p2_4)))
+(declare-const q3 Hole)
+(declare-const p3_1 Bool)
+(declare-const p3_2 Bool)
+(declare-const p3_3 Bool)
+(declare-const p3_4 Bool)
+(assert (or (and p3_1 (= q3 h1)) (and p3_2 (= q3 h2)) (and p3_3 (= q3 h3)) (and p3_4 (= q3 h4))))
+(assert (not (and p1_1 p3_1)))
+(assert (not (and p2_1 p3_1)))
+(assert (not (and p1_2 p3_2)))
+(assert (not (and p2_2 p3_2)))
+(assert (not (and p1_3 p3_3)))
+(assert (not (and p2_3 p3_3)))
+(assert (not (and p1_4 p3_4)))
+(assert (not (and p2_4 p3_4)))
+(declare-const q4 Hole)
+(declare-const p4_1 Bool)
+(declare-const p4_2 Bool)
+(declare-const p4_3 Bool)
+(declare-const p4_4 Bool)
+(assert (or (and p4_1 (= q4 h1)) (and p4_2 (= q4 h2)) (and p4_3 (= q4 h3)) (and p4_4 (= q4 h4))))
+(assert (not (and p1_1 p4_1)))
+(assert (not (and p2_1 p4_1)))
+(assert (not (and p3_1 p4_1)))
+(assert (not (and p1_2 p4_2)))
+(assert (not (and p2_2 p4_2)))
+(assert (not (and p3_2 p4_2)))
+(assert (not (and p1_3 p4_3)))
+(assert (not (and p2_3 p4_3)))
+(assert (not (and p3_3 p4_3)))
+(assert (not (and p1_4 p4_4)))
+(assert (not (and p2_4 p4_4)))
+(assert (not (and p3_4 p4_4)))
+(check-sat)
+(push 1)
+(declare-const q5 Hole)
+(declare-const p5_1 Bool)
+(declare-const p5_2 Bool)
+(declare-const p5_3 Bool)
+(declare-const p5_4 Bool)
+(assert (or (and p5_1 (= q5 h1)) (and p5_2 (= q5 h2)) (and p5_3 (= q5 h3)) (and p5_4 (= q5 h4))))
+(assert (not (and p1_1 p5_1)))
+(assert (not (and p2_1 p5_1)))
+(assert (not (and p3_1 p5_1)))
+(assert (not (and p4_1 p5_1)))
+(assert (not (and p1_2 p5_2)))
+(assert (not (and p2_2 p5_2)))
+(assert (not (and p3_2 p5_2)))
+(assert (not (and p4_2 p5_2)))
+(assert (not (and p1_3 p5_3)))
+(assert (not (and p2_3 p5_3)))
+(assert (not (and p3_3 p5_3)))
+(assert (not (and p4_3 p5_3)))
+(assert (not (and p1_4 p5_4)))
+(assert (not (and p2_4 p5_4)))
+(assert (not (and p3_4 p5_4)))
+(assert (not (and p4_4 p5_4)))
+(check-sat)
+(pop 1)
+(assert (distinct h1 h2 h3 h4))
+(check-sat)
@@ -2,7 +2,7 @@
 """
 Usage:
 
-    run_regression.py [--enable-proof] [--with-lfsc] [--dump]
+    run_regression.py [--enable-proof] [--with-lfsc] [--dump] [--dag]
         [--use-skip-return-code] [wrapper] cvc4-binary
         [benchmark.cvc | benchmark.smt | benchmark.smt2 | benchmark.p]
 
@@ -16,6 +16,7 @@ import re
 import shlex
 import subprocess
 import sys
+import tempfile
 import threading
 
 
@@ -139,14 +140,15 @@ def logic_supported_with_proofs(logic):
             "QF_AUFBVLRA"
             ]
 
-def run_benchmark(dump, wrapper, scrubber, error_scrubber, cvc4_binary,
+def run_benchmark(dump, dag, wrapper, scrubber, error_scrubber, cvc4_binary,
                   command_line, benchmark_dir, benchmark_filename, timeout):
     """Runs CVC4 on the file `benchmark_filename` in the directory
     `benchmark_dir` using the binary `cvc4_binary` with the command line
     options `command_line`. The output is scrubbed using `scrubber` and
     `error_scrubber` for stdout and stderr, respectively. If dump is true, the
     function first uses CVC4 to read in and dump the benchmark file and then
-    uses that as input."""
+    uses that as input. If dag is true, the function first uses CVC4 to write
+    the benchmark to a binary DAG file and then uses that as input."""
 
     bin_args = wrapper[:]
     bin_args.append(cvc4_binary)
@@ -165,6 +167,20 @@ def run_benchmark(dump, wrapper, scrubber, error_scrubber, cvc4_binary,
         output, error, exit_status = run_process(
             bin_args + command_line + ['--lang=smt2', '-'], benchmark_dir,
             timeout, dump_output)
+    elif dag:
+        dag_fd, dag_filename = tempfile.mkstemp(suffix='.dag')
+        os.close(dag_fd)
+        try:
+            run_process(
+                bin_args + command_line +
+                ['--write-dag=' + dag_filename, benchmark_filename],
+                benchmark_dir, timeout)
+            output, error, exit_status = run_process(
+                bin_args + command_line + ['--lang=dag', dag_filename],
+                benchmark_dir, timeout)
+        finally:
+            if os.path.exists(dag_filename):
+                os.remove(dag_filename)
     else:
         output, error, exit_status = run_process(
             bin_args + command_line + [benchmark_filename], benchmark_dir,
@@ -187,13 +203,14 @@ def run_benchmark(dump, wrapper, scrubber, error_scrubber, cvc4_binary,
     return (output.strip(), error.strip(), exit_status)
 
 
-def run_regression(unsat_cores, proofs, dump, use_skip_return_code, wrapper,
-                   cvc4_binary, benchmark_path, timeout):
+def run_regression(unsat_cores, proofs, dump, dag, use_skip_return_code,
+                   wrapper, cvc4_binary, benchmark_path, timeout):
     """Determines the expected output for a benchmark, runs CVC4 on it and then
     checks whether the output corresponds to the expected output. Optionally
     uses a wrapper `wrapper`, tests unsat cores (if unsat_cores is true),
-    checks proofs (if proofs is true), or dumps a benchmark and uses that as
-    the input (if dump is true). `use_skip_return_code` enables/disables
+    checks proofs (if proofs is true), dumps a benchmark and uses that as
+    the input (if dump is true), or writes a benchmark to a DAG file and uses
+    that as the input (if dag is true). `use_skip_return_code` enables/disables
     returning 77 when a test is skipped."""
 
     if not os.access(cvc4_binary, os.X_OK):
@@ -376,7 +393,7 @@ def run_regression(unsat_cores, proofs, dump, use_skip_return_code, wrapper,
     exit_code = EXIT_OK
     for command_line_args in command_line_args_configs:
         output, error, exit_status = run_benchmark(
-            dump, wrapper, scrubber, error_scrubber, cvc4_binary,
+            dump, dag, wrapper, scrubber, error_scrubber, cvc4_binary,
             command_line_args, benchmark_dir, benchmark_basename, timeout)
         output = re.sub(r'^[ \t]*', '', output, flags=re.MULTILINE)
         error = re.sub(r'^[ \t]*', '', error, flags=re.MULTILINE)
@@ -443,6 +460,7 @@ def main():
     parser.add_argument('--enable-proof', action='store_true')
     parser.add_argument('--with-lfsc', action='store_true')
     parser.add_argument('--dump', action='store_true')
+    parser.add_argument('--dag', action='store_true')
     parser.add_argument('--use-skip-return-code', action='store_true')
     parser.add_argument('wrapper', nargs='*')
     parser.add_argument('cvc4_binary')
@@ -457,8 +475,8 @@ def main():
     timeout = float(os.getenv('TEST_TIMEOUT', 1200.0))
 
     return run_regression(args.enable_proof, args.with_lfsc, args.dump,
-                          args.use_skip_return_code, wrapper, cvc4_binary,
-                          args.benchmark, timeout)
+                          args.dag, args.use_skip_return_code, wrapper,
+                          cvc4_binary, args.benchmark, timeout)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,162 @@
+/*********************                                                        */
+/*! \file threaded_smt_engines.cpp
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A stress test of SmtEngines running concurrently in several threads
+ **
+ ** A problem prefix is built once and exported to one ExprManager per thread.
+ ** Each thread then solves a number of queries on top of the prefix with its
+ ** own SmtEngine, creating and dropping many nodes on the way.
+ **
+ ** Without arguments, the test runs with a fixed number of threads and fails
+ ** if any thread gets a wrong answer. With an argument n, it runs with
+ ** 1, 2, 4, ..., n threads and prints the wall-clock time for each thread
+ ** count, which can be used to check how well solving scales.
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "expr/expr.h"
+#include "expr/expr_manager.h"
+#include "expr/variable_type_map.h"
+#include "smt/smt_engine.h"
+
+using namespace CVC4;
+
+namespace {
+
+/** The number of variables in the prefix. */
+const unsigned NUM_VARS = 200;
+/** The number of queries each thread solves. */
+const unsigned NUM_QUERIES = 20;
+
+/** The problem prefix: x_0 < x_1 < ... < x_{NUM_VARS - 1}. */
+struct Prefix
+{
+  Prefix() : d_em()
+  {
+    Type integer = d_em.integerType();
+    for (unsigned i = 0; i < NUM_VARS; ++i)
+    {
+      d_vars.push_back(d_em.mkVar("x", integer));
+      if (i > 0)
+      {
+        d_assertions.push_back(
+            d_em.mkExpr(kind::LT, d_vars[i - 1], d_vars[i]));
+      }
+    }
+  }
+
+  ExprManager d_em;
+  std::vector<Expr> d_vars;
+  std::vector<Expr> d_assertions;
+};
+
+/** The state of one thread, created by the main thread. */
+struct Worker
+{
+  Worker(const Prefix& prefix) : d_em(), d_ok(true)
+  {
+    ExprManagerMapCollection map;
+    for (const Expr& e : prefix.d_vars)
+    {
+      d_vars.push_back(e.exportTo(&d_em, map));
+    }
+    for (const Expr& e : prefix.d_assertions)
+    {
+      d_assertions.push_back(e.exportTo(&d_em, map));
+    }
+  }
+
+  /**
+   * Solve the queries. Query i asks whether x_last - x_0 < NUM_VARS - 2 + i,
+   * which is satisfiable iff i > 1.
+   */
+  void run()
+  {
+    SmtEngine smt(&d_em);
+    smt.setOption("incremental", SExpr(true));
+    for (const Expr& e : d_assertions)
+    {
+      smt.assertFormula(e);
+    }
+    Expr diff = d_em.mkExpr(kind::MINUS, d_vars.back(), d_vars.front());
+    for (unsigned i = 0; i < NUM_QUERIES; ++i)
+    {
+      smt.push();
+      Expr bound = d_em.mkConst(Rational(NUM_VARS - 2 + i));
+      smt.assertFormula(d_em.mkExpr(kind::LT, diff, bound));
+      Result r = smt.checkSat();
+      if (r.isSat() != (i > 1 ? Result::SAT : Result::UNSAT))
+      {
+        d_ok = false;
+      }
+      smt.pop();
+    }
+  }
+
+  ExprManager d_em;
+  std::vector<Expr> d_vars;
+  std::vector<Expr> d_assertions;
+  bool d_ok;
+};
+
+/**
+ * Solve with the given number of threads. Returns true if all answers were
+ * correct.
+ */
+bool solve(const Prefix& prefix, unsigned nthreads)
+{
+  // Export the prefix before starting any thread, the ExprManager of the
+  // prefix must not be used by several threads at once.
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (unsigned i = 0; i < nthreads; ++i)
+  {
+    workers.emplace_back(new Worker(prefix));
+  }
+  std::vector<std::thread> threads;
+  for (std::unique_ptr<Worker>& w : workers)
+  {
+    threads.emplace_back(&Worker::run, w.get());
+  }
+  bool ok = true;
+  for (unsigned i = 0; i < nthreads; ++i)
+  {
+    threads[i].join();
+    ok = ok && workers[i]->d_ok;
+  }
+  return ok;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  Prefix prefix;
+  if (argc < 2)
+  {
+    return solve(prefix, 4) ? 0 : 1;
+  }
+
+  unsigned maxThreads = std::atoi(argv[1]);
+  bool ok = true;
+  for (unsigned n = 1; n <= maxThreads; n *= 2)
+  {
+    auto start = std::chrono::steady_clock::now();
+    ok = solve(prefix, n) && ok;
+    std::chrono::duration<double> time =
+        std::chrono::steady_clock::now() - start;
+    std::cout << n << " thread(s): " << time.count() << "s" << std::endl;
+  }
+  return ok ? 0 : 1;
+}
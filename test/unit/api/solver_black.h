@@ -16,6 +16,8 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include <thread>
+
 #include "api/cvc4cpp.h"
 #include "base/configuration.h"
 
@@ -106,6 +108,9 @@ class SolverBlack : public CxxTest::TestSuite
 
   void testResetAssertions();
 
+  void testClone();
+  void testCloneThread();
+
  private:
   std::unique_ptr<Solver> d_solver;
 };
@@ -1229,3 +1234,87 @@ void SolverBlack::testResetAssertions()
   d_solver->resetAssertions();
   d_solver->checkSatAssuming({slt, ule});
 }
+
+void SolverBlack::testClone()
+{
+  d_solver->setOption("incremental", "true");
+  d_solver->setOption("produce-assertions", "true");
+
+  Sort intSort = d_solver->getIntegerSort();
+  Sort funSort = d_solver->mkFunctionSort(intSort, intSort);
+  Term x = d_solver->mkConst(intSort, "x");
+  Term f = d_solver->mkConst(funSort, "f");
+  Term y = d_solver->mkVar(intSort, "y");
+  Term g = d_solver->defineFun(
+      "g", {y}, intSort, d_solver->mkTerm(PLUS, y, d_solver->mkReal(1)));
+  d_solver->assertFormula(d_solver->mkTerm(
+      GT, d_solver->mkTerm(APPLY_UF, g, x), d_solver->mkReal(0)));
+  d_solver->push();
+  d_solver->assertFormula(d_solver->mkTerm(LT, x, d_solver->mkReal(5)));
+  d_solver->assertFormula(d_solver->mkTerm(
+      EQUAL, d_solver->mkTerm(APPLY_UF, f, x), d_solver->mkReal(3)));
+
+  std::unique_ptr<Solver> copy(d_solver->clone());
+  d_solver->pop();
+  TS_ASSERT_THROWS(d_solver->importTerm(x), CVC4ApiException&);
+
+  Term xc = copy->importTerm(x);
+  Term gc = copy->importTerm(g);
+  TS_ASSERT_EQUALS(copy->importSort(intSort), copy->getIntegerSort());
+  TS_ASSERT_EQUALS(copy->getAssertions().size(), 3);
+  copy->push();
+  copy->assertFormula(copy->mkTerm(GT, xc, copy->mkReal(10)));
+  TS_ASSERT(copy->checkSat().isUnsat());
+  copy->pop();
+  copy->push();
+  copy->assertFormula(copy->mkTerm(
+      LT, copy->mkTerm(APPLY_UF, gc, xc), copy->mkReal(0)));
+  TS_ASSERT(copy->checkSat().isUnsat());
+  copy->pop();
+  TS_ASSERT(copy->checkSat().isSat());
+
+  // The parent is unaffected by the copy
+  TS_ASSERT(d_solver
+                ->checkSatAssuming(
+                    d_solver->mkTerm(GT, x, d_solver->mkReal(10)))
+                .isSat());
+}
+
+void SolverBlack::testCloneThread()
+{
+  // The uninterpreted sorts of QF_AX are owned by the theory of arrays, also
+  // when the copy is solved on another thread
+  d_solver->setOption("incremental", "true");
+  d_solver->setOption("produce-assertions", "true");
+  d_solver->setLogic("QF_AX");
+
+  Sort indexSort = d_solver->mkUninterpretedSort("Index");
+  Sort elemSort = d_solver->mkUninterpretedSort("Element");
+  Sort arrSort = d_solver->mkArraySort(indexSort, elemSort);
+  Term a = d_solver->mkConst(arrSort, "a");
+  Term b = d_solver->mkConst(arrSort, "b");
+  Term i = d_solver->mkConst(indexSort, "i");
+  Term e = d_solver->mkConst(elemSort, "e");
+  d_solver->assertFormula(
+      d_solver->mkTerm(EQUAL, b, d_solver->mkTerm(STORE, a, i, e)));
+  d_solver->assertFormula(d_solver->mkTerm(DISTINCT, a, b));
+
+  std::unique_ptr<Solver> copy(d_solver->clone());
+  Term ac = copy->importTerm(a);
+  Term ic = copy->importTerm(i);
+  Term ec = copy->importTerm(e);
+  bool sat = false;
+  bool unsat = false;
+  std::thread worker([&]() {
+    sat = copy->checkSat().isSat();
+    copy->push();
+    copy->assertFormula(
+        copy->mkTerm(EQUAL, copy->mkTerm(SELECT, ac, ic), ec));
+    unsat = copy->checkSat().isUnsat();
+    copy->pop();
+  });
+  worker.join();
+  TS_ASSERT(sat);
+  TS_ASSERT(unsat);
+  TS_ASSERT(d_solver->checkSat().isSat());
+}
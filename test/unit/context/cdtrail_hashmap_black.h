@@ -0,0 +1,140 @@
+/*********************                                                        */
+/*! \file cdtrail_hashmap_black.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::context::CDTrailHashMap<>.
+ **
+ ** Black box testing of CVC4::context::CDTrailHashMap<>.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <map>
+
+#include "context/cdtrail_hashmap.h"
+#include "context/context.h"
+
+using CVC4::context::Context;
+using CVC4::context::CDTrailHashMap;
+
+class CDTrailHashMapBlack : public CxxTest::TestSuite
+{
+  Context* d_context;
+
+ public:
+  void setUp() override { d_context = new Context; }
+
+  void tearDown() override { delete d_context; }
+
+  // Returns the elements in a CDTrailHashMap.
+  static std::map<int, int> GetElements(const CDTrailHashMap<int, int>& map)
+  {
+    return std::map<int, int>{map.begin(), map.end()};
+  }
+
+  // Returns true if the elements in map are the same as expected.
+  static bool ElementsAre(const CDTrailHashMap<int, int>& map,
+                          const std::map<int, int>& expected)
+  {
+    return GetElements(map) == expected;
+  }
+
+  void testSimpleSequence()
+  {
+    CDTrailHashMap<int, int> map(d_context);
+    TS_ASSERT(ElementsAre(map, {}));
+
+    map.insert(3, 4);
+    TS_ASSERT(ElementsAre(map, {{3, 4}}));
+
+    {
+      d_context->push();
+      map.insert(5, 6);
+      map.insert(9, 8);
+      TS_ASSERT(ElementsAre(map, {{3, 4}, {5, 6}, {9, 8}}));
+
+      {
+        d_context->push();
+        map.insert(1, 2);
+        map.insert(3, 7);
+        TS_ASSERT(ElementsAre(map, {{1, 2}, {3, 7}, {5, 6}, {9, 8}}));
+
+        {
+          d_context->push();
+          map.insert(1, 45);
+          map.insert(3, 8);
+          map[5] = 60;
+          TS_ASSERT(ElementsAre(map, {{1, 45}, {3, 8}, {5, 60}, {9, 8}}));
+          d_context->pop();
+        }
+
+        TS_ASSERT(ElementsAre(map, {{1, 2}, {3, 7}, {5, 6}, {9, 8}}));
+        d_context->pop();
+      }
+
+      TS_ASSERT(ElementsAre(map, {{3, 4}, {5, 6}, {9, 8}}));
+      d_context->pop();
+    }
+
+    TS_ASSERT(ElementsAre(map, {{3, 4}}));
+    TS_ASSERT_EQUALS(map.size(), 1u);
+  }
+
+  void testFindAndCount()
+  {
+    CDTrailHashMap<int, int> map(d_context);
+    map.insert(1, 10);
+    d_context->push();
+    map[2] = 20;
+    TS_ASSERT_EQUALS(map.count(2), 1u);
+    TS_ASSERT(map.find(2) != map.end());
+    TS_ASSERT_EQUALS((*map.find(2)).second, 20);
+    TS_ASSERT_EQUALS(map[1].get(), 10);
+    d_context->pop();
+    TS_ASSERT_EQUALS(map.count(2), 0u);
+    TS_ASSERT(map.find(2) == map.end());
+    TS_ASSERT(map.find(1) != map.end());
+  }
+
+  void testManyLevels()
+  {
+    // Enough keys to grow the index several times, popped in between
+    CDTrailHashMap<int, int> map(d_context);
+    for (int level = 0; level < 50; ++level)
+    {
+      d_context->push();
+      for (int i = 0; i < 100; ++i)
+      {
+        map[level * 100 + i] = level;
+        map[i] = level;
+      }
+    }
+    TS_ASSERT_EQUALS(map.size(), 4900u + 100u);
+    d_context->popto(25);
+    TS_ASSERT_EQUALS(map.size(), 2400u + 100u);
+    TS_ASSERT_EQUALS(map[7].get(), 24);
+    TS_ASSERT_EQUALS(map[2407].get(), 24);
+    TS_ASSERT(map.find(2507) == map.end());
+    d_context->popto(0);
+    TS_ASSERT(map.empty());
+  }
+
+  void testCreatedAtDeeperLevel()
+  {
+    d_context->push();
+    d_context->push();
+    CDTrailHashMap<int, int> map(d_context);
+    map.insert(1, 2);
+    d_context->pop();
+    TS_ASSERT(map.empty());
+    map.insert(3, 4);
+    TS_ASSERT(ElementsAre(map, {{3, 4}}));
+    d_context->pop();
+    TS_ASSERT(map.empty());
+  }
+};
@@ -17,12 +17,14 @@
 #include <cxxtest/TestSuite.h>
 
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 #include "base/exception.h"
 #include "context/cdlist.h"
 #include "context/cdo.h"
 #include "context/context.h"
+#include "context/context_profiler.h"
 #include "test_utils.h"
 
 using namespace std;
@@ -246,4 +248,36 @@ private:
     TS_ASSERT_EQUALS(x.nSaves, 1);
     TS_ASSERT_EQUALS(y.nSaves, 2);
   }
+
+  void testProfiler()
+  {
+    ContextProfiler profiler;
+    std::stringstream trace;
+    profiler.setTraceStream(&trace);
+    d_context->setProfiler(&profiler);
+    {
+      CDO<int> untagged(d_context, 0);
+      CDList<int>* tagged;
+      {
+        ContextProfiler::Tag tag(d_context, "MyOwner");
+        tagged = new (true) CDList<int>(d_context);
+      }
+
+      d_context->push();
+      untagged = 1;
+      tagged->push_back(1);
+      d_context->push();
+      d_context->pop();
+      untagged = 2;
+      d_context->pop();
+      tagged->deleteSelf();
+    }
+    d_context->setProfiler(NULL);
+
+    TS_ASSERT_EQUALS(trace.str(), "push\npush\npop 0\npop 2\n");
+    std::stringstream out;
+    profiler.print(out);
+    TS_ASSERT_DIFFERS(out.str().find("(MyOwner : 1, "), std::string::npos);
+    TS_ASSERT_DIFFERS(out.str().find("CDO<int> : 1, "), std::string::npos);
+  }
 };
@@ -102,5 +102,58 @@ private:
 #endif /* __CVC4__CONTEXT__CONTEXT_MM_H */
   }
 
+  void testLargeAllocations()
+  {
+#ifndef CVC4_DEBUG_CONTEXT_MEMORY_MANAGER
+    ContextMemoryConfig config;
+    config.d_chunkSizeBytes = 1024;
+    config.d_maxFreeChunks = 2;
+    ContextMemoryManager cmm(config);
+    TS_ASSERT_EQUALS(cmm.getChunkSize(), 1024u);
+
+    char* small = static_cast<char*>(cmm.newData(100));
+    memset(small, 'a', 100);
+    cmm.push();
+    for (uint32_t i = 1; i <= 4; ++i)
+    {
+      char* large = static_cast<char*>(cmm.newData(i * 4096));
+      memset(large, 'b', i * 4096);
+    }
+    TS_ASSERT_EQUALS(cmm.getNumLargeAllocations(), 4u);
+    cmm.push();
+    cmm.newData(2000);
+    TS_ASSERT_EQUALS(cmm.getNumLargeAllocations(), 5u);
+    cmm.pop();
+    TS_ASSERT_EQUALS(cmm.getNumLargeAllocations(), 4u);
+    cmm.pop();
+    TS_ASSERT_EQUALS(cmm.getNumLargeAllocations(), 0u);
+    TS_ASSERT_EQUALS(small[99], 'a');
+#endif /* CVC4_DEBUG_CONTEXT_MEMORY_MANAGER */
+  }
+
+  void testAccounting()
+  {
+    d_cmm->newData(10);
+    d_cmm->push();
+    d_cmm->newData(100);
+    d_cmm->newData(200);
+    d_cmm->push();
+    d_cmm->newData(50);
+    TS_ASSERT_EQUALS(d_cmm->getBytesInUse(), 360u);
+    d_cmm->pop();
+    d_cmm->pop();
+    TS_ASSERT_EQUALS(d_cmm->getBytesInUse(), 10u);
+    d_cmm->push();
+    d_cmm->newData(20);
+    d_cmm->pop();
+
+    TS_ASSERT_EQUALS(d_cmm->getPeakBytes(), 360u);
+    const std::vector<uint64_t>& levels = d_cmm->getPeakLevelBytes();
+    TS_ASSERT_EQUALS(levels.size(), 3u);
+    TS_ASSERT_EQUALS(levels[0], 10u);
+    TS_ASSERT_EQUALS(levels[1], 300u);
+    TS_ASSERT_EQUALS(levels[2], 50u);
+  }
+
   void tearDown() override { delete d_cmm; }
 };
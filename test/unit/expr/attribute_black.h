@@ -135,4 +135,69 @@ private:
     delete node;
   }
 
+  struct DenseNodeAttributeId {};
+  typedef expr::Attribute<DenseNodeAttributeId,
+                          Node,
+                          false,
+                          expr::attr::AttrStorageDense>
+      DenseNodeAttribute;
+  void testDenseNodes(){
+    TypeNode booleanType = d_nodeManager->booleanType();
+    std::vector<Node> nodes;
+    for (unsigned i = 0; i < 3000; ++i)
+    {
+      nodes.push_back(d_nodeManager->mkSkolem("b", booleanType));
+    }
+
+    DenseNodeAttribute attr;
+    Node data;
+    for (unsigned i = 0; i < nodes.size(); i += 2)
+    {
+      nodes[i].setAttribute(attr, nodes[nodes.size() - 1 - i]);
+    }
+    for (unsigned i = 0; i < nodes.size(); ++i)
+    {
+      TS_ASSERT_EQUALS(nodes[i].hasAttribute(attr), i % 2 == 0);
+      if (i % 2 == 0)
+      {
+        TS_ASSERT(nodes[i].getAttribute(attr, data));
+        TS_ASSERT_EQUALS(data, nodes[nodes.size() - 1 - i]);
+      }
+      else
+      {
+        TS_ASSERT(!nodes[i].getAttribute(attr, data));
+      }
+    }
+
+    std::vector<const expr::attr::AttributeUniqueId*> ids;
+    expr::attr::AttributeUniqueId id =
+        expr::attr::AttributeManager::getAttributeId(attr);
+    TS_ASSERT_EQUALS(id.getTableId(), expr::attr::AttrTableDenseNode);
+    ids.push_back(&id);
+    d_nodeManager->deleteAttributes(ids);
+    TS_ASSERT(!nodes[0].hasAttribute(attr));
+  }
+
+  struct DenseBoolAttributeId {};
+  typedef expr::Attribute<DenseBoolAttributeId,
+                          bool,
+                          false,
+                          expr::attr::AttrStorageDense>
+      DenseBoolAttribute;
+  void testDenseBools(){
+    TypeNode booleanType = d_nodeManager->booleanType();
+    Node a = d_nodeManager->mkSkolem("a", booleanType);
+    Node b = d_nodeManager->mkSkolem("b", booleanType);
+
+    DenseBoolAttribute attr;
+    bool data = true;
+    TS_ASSERT(a.getAttribute(attr, data));
+    TS_ASSERT(!data);
+    a.setAttribute(attr, true);
+    TS_ASSERT(a.getAttribute(attr));
+    TS_ASSERT(!b.getAttribute(attr));
+    a.setAttribute(attr, false);
+    TS_ASSERT(!a.getAttribute(attr));
+  }
+
 };
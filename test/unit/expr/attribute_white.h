@@ -135,7 +135,8 @@ class AttributeWhite : public CxxTest::TestSuite {
 //    TS_ASSERT_DIFFERS(theory::PostRewriteCache::s_id, theory::PostRewriteCacheTop::s_id);
 //    TS_ASSERT_DIFFERS(theory::PreRewriteCacheTop::s_id, theory::PostRewriteCacheTop::s_id);
 
-    lastId = attr::LastAttributeId<TypeNode, false>::getId();
+    lastId =
+        attr::LastAttributeId<TypeNode, false, attr::AttrStorageDense>::getId();
     TS_ASSERT_LESS_THAN(TypeAttr::s_id, lastId);
   }
 
@@ -475,4 +476,27 @@ class AttributeWhite : public CxxTest::TestSuite {
 
     TS_ASSERT(! unnamed.hasAttribute(VarNameAttr()));
   }
+
+  void testDensePagesFreed() {
+    Node a = d_nm->mkVar(*d_booleanType);
+    Node b = d_nm->mkVar(*d_booleanType);
+
+    DenseAttrTable<uint64_t> ints;
+    ints.set(3, a.d_nv, 1);
+    ints.set(3, b.d_nv, 2);
+    TS_ASSERT(ints.bytesReserved() > 0);
+    ints.erase(a.d_nv);
+    uint64_t data = 0;
+    TS_ASSERT(ints.get(3, b.d_nv, data));
+    TS_ASSERT_EQUALS(data, 2u);
+    ints.erase(b.d_nv);
+    TS_ASSERT(!ints.get(3, b.d_nv, data));
+    TS_ASSERT_EQUALS(ints.bytesReserved(), 0u);
+
+    DenseAttrTable<bool> bools;
+    bools.set(0, a.d_nv, true);
+    TS_ASSERT(bools.bytesReserved() > 0);
+    bools.erase(a.d_nv);
+    TS_ASSERT_EQUALS(bools.bytesReserved(), 0u);
+  }
 };
@@ -0,0 +1,211 @@
+/*********************                                                        */
+/*! \file dag_serializer_black.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::expr::DagWriter and DagReader.
+ **
+ ** Black box testing of CVC4::expr::DagWriter and DagReader.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/exception.h"
+#include "expr/dag_serializer.h"
+#include "expr/node_manager.h"
+#include "util/bitvector.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::expr;
+using namespace CVC4::kind;
+
+class DagSerializerBlack : public CxxTest::TestSuite
+{
+  NodeManager* d_nodeManager;
+  NodeManagerScope* d_scope;
+
+ public:
+  void setUp() override
+  {
+    d_nodeManager = new NodeManager(NULL);
+    d_scope = new NodeManagerScope(d_nodeManager);
+  }
+
+  void tearDown() override
+  {
+    delete d_scope;
+    delete d_nodeManager;
+  }
+
+  /** Read all commands in data into a fresh NodeManager, as strings. */
+  std::vector<std::string> readAll(const std::string& data)
+  {
+    std::vector<std::string> cmds;
+    NodeManager nm(NULL);
+    NodeManagerScope nms(&nm);
+    DagReader reader(&nm, data.data(), data.size());
+    DagCommand cmd;
+    while (reader.next(cmd))
+    {
+      std::stringstream ss;
+      switch (cmd.d_kind)
+      {
+        case DagCommand::SET_LOGIC: ss << "logic " << cmd.d_symbol; break;
+        case DagCommand::DECLARE_SORT: ss << "sort " << cmd.d_symbol; break;
+        case DagCommand::DECLARE_FUN:
+          ss << "fun " << cmd.d_symbol << " " << cmd.d_type;
+          break;
+        case DagCommand::ASSERT: ss << "assert " << cmd.d_node; break;
+        case DagCommand::PUSH: ss << "push"; break;
+        case DagCommand::POP: ss << "pop"; break;
+        case DagCommand::CHECK_SAT: ss << "check-sat"; break;
+      }
+      cmds.push_back(ss.str());
+    }
+    return cmds;
+  }
+
+  void testRoundTrip()
+  {
+    TypeNode bv8 = d_nodeManager->mkBitVectorType(8);
+    TypeNode u = d_nodeManager->mkSort("U");
+    Node a = d_nodeManager->mkSkolem(
+        "a", bv8, "", NodeManager::SKOLEM_EXACT_NAME);
+    Node x = d_nodeManager->mkSkolem(
+        "x", u, "", NodeManager::SKOLEM_EXACT_NAME);
+    Node n = d_nodeManager->mkSkolem("n",
+                                     d_nodeManager->integerType(),
+                                     "",
+                                     NodeManager::SKOLEM_EXACT_NAME);
+    Node sum = d_nodeManager->mkNode(
+        BITVECTOR_PLUS, a, d_nodeManager->mkConst(BitVector(8, 3u)));
+    Node ext = d_nodeManager->mkNode(
+        d_nodeManager->mkConst(BitVectorExtract(3, 0)), sum);
+    Node f1 = d_nodeManager->mkNode(
+        EQUAL, ext, d_nodeManager->mkConst(BitVector(4, 1u)));
+    Node f2 = d_nodeManager->mkNode(
+        AND,
+        d_nodeManager->mkNode(EQUAL, x, x),
+        d_nodeManager->mkNode(
+            LT, n, d_nodeManager->mkConst(Rational(-7, 2))));
+
+    std::stringstream out;
+    {
+      DagWriter writer(out);
+      writer.setLogic("ALL");
+      writer.assertFormula(f1);
+      writer.push();
+      writer.assertFormula(f2);
+      writer.checkSat();
+      writer.pop();
+    }
+
+    std::vector<std::string> cmds = readAll(out.str());
+    std::vector<std::string> expected;
+    expected.push_back("logic ALL");
+    expected.push_back("fun a " + bv8.toString());
+    expected.push_back("assert " + f1.toString());
+    expected.push_back("push");
+    // the symbols are declared as the writer first reaches them, last child
+    // first
+    expected.push_back("fun n " + d_nodeManager->integerType().toString());
+    expected.push_back("sort U");
+    expected.push_back("fun x U");
+    expected.push_back("assert " + f2.toString());
+    expected.push_back("check-sat");
+    expected.push_back("pop");
+    TS_ASSERT_EQUALS(cmds, expected);
+  }
+
+  void testSharing()
+  {
+    Node p = d_nodeManager->mkSkolem("p",
+                                     d_nodeManager->booleanType(),
+                                     "",
+                                     NodeManager::SKOLEM_EXACT_NAME);
+    // A chain of n nodes with 2^n paths: the file must stay linear.
+    Node f = p;
+    for (unsigned i = 0; i < 64; ++i)
+    {
+      f = d_nodeManager->mkNode(AND, f, d_nodeManager->mkNode(NOT, f));
+    }
+    std::stringstream out;
+    uint64_t records;
+    {
+      DagWriter writer(out);
+      writer.assertFormula(f);
+      records = writer.getNumRecords();
+    }
+    TS_ASSERT_EQUALS(records, 2u + 2 * 64);
+    TS_ASSERT_LESS_THAN(out.str().size(), 2048u);
+
+    std::vector<std::string> cmds = readAll(out.str());
+    TS_ASSERT_EQUALS(cmds.size(), 2u);
+  }
+
+  void testMalformed()
+  {
+    std::string data = "CVC4DAG";
+    TS_ASSERT_THROWS(readAll(data), Exception&);
+
+    std::stringstream out;
+    {
+      DagWriter writer(out);
+      writer.setLogic("QF_BV");
+    }
+    std::string truncated = out.str();
+    truncated.resize(truncated.size() - 2);
+    TS_ASSERT_THROWS(readAll(truncated), Exception&);
+
+    // A type application (tag 7) claiming 2^63 - 1 children must not be
+    // allocated
+    std::stringstream empty;
+    {
+      DagWriter writer(empty);
+    }
+    std::string huge = empty.str();
+    huge.resize(huge.size() - 1);
+    huge.push_back(char(7));
+    huge.push_back(char(FUNCTION_TYPE));
+    huge.append(9, char(0xff));
+    huge.push_back(char(0));
+    TS_ASSERT_THROWS(readAll(huge), Exception&);
+
+    // Records whose kind, metakind or arity do not fit their tag, each
+    // followed by the end tag
+    std::string header = empty.str();
+    header.resize(header.size() - 1);
+    std::vector<std::vector<uint64_t>> records = {
+        {4, AND, 0},
+        {4, CONST_BOOLEAN, 0},
+        {4, LAST_KIND + 1, 0},
+        {3, AND, 0},
+        {5, TYPE_CONSTANT, LAST_TYPE},
+        {5, BITVECTOR_TYPE, 0},
+        {7, AND, 0},
+        {7, ARRAY_TYPE, 0}};
+    for (const std::vector<uint64_t>& record : records)
+    {
+      std::string bad = header;
+      for (uint64_t v : record)
+      {
+        for (; v >= 0x80; v >>= 7)
+        {
+          bad.push_back(char((v & 0x7f) | 0x80));
+        }
+        bad.push_back(char(v));
+      }
+      bad.push_back(char(0));
+      TS_ASSERT_THROWS(readAll(bad), Exception&);
+    }
+  }
+};
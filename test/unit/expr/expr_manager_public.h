@@ -16,12 +16,16 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include <new>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include "expr/expr_manager.h"
 #include "expr/expr.h"
+#include "expr/variable_type_map.h"
 #include "base/exception.h"
+#include "util/rational.h"
 
 using namespace CVC4;
 using namespace CVC4::kind;
@@ -128,4 +132,77 @@ private:
                      IllegalArgumentException&);
   }
 
+  void testExportBulk()
+  {
+    Expr x = d_exprManager->mkVar("x", d_exprManager->integerType());
+    Expr y = d_exprManager->mkVar("y", d_exprManager->integerType());
+    Expr zero = d_exprManager->mkConst(Rational(0));
+    Expr sum = d_exprManager->mkExpr(PLUS, x, y);
+    std::vector<Expr> es;
+    es.push_back(d_exprManager->mkExpr(GT, sum, zero));
+    es.push_back(d_exprManager->mkExpr(LT, sum, x));
+
+    ExprManager em;
+    {
+      ExprManagerMapCollection vmap;
+      std::vector<Expr> out = Expr::exportTo(es, &em, vmap);
+      TS_ASSERT_EQUALS(out.size(), 2u);
+      TS_ASSERT_EQUALS(out[0].getExprManager(), &em);
+      TS_ASSERT_EQUALS(out[0].getKind(), GT);
+      TS_ASSERT_EQUALS(out[1].getKind(), LT);
+      // shared subterms are translated once
+      TS_ASSERT_EQUALS(out[0][0], out[1][0]);
+      TS_ASSERT_EQUALS(out[0][0][0], out[1][1]);
+      // later exports reuse the translations
+      TS_ASSERT_EQUALS(sum.exportTo(&em, vmap), out[0][0]);
+      TS_ASSERT_EQUALS(x.exportTo(&em, vmap), out[1][1]);
+      // and the variables map back
+      TS_ASSERT_EQUALS(out[1][1].exportTo(d_exprManager, vmap), x);
+      // null expressions, such as the assumption of a check-sat without
+      // one, stay null
+      TS_ASSERT(Expr().exportTo(&em, vmap).isNull());
+      std::vector<Expr> withNull(1, Expr());
+      withNull.push_back(x);
+      std::vector<Expr> out2 = Expr::exportTo(withNull, &em, vmap);
+      TS_ASSERT(out2[0].isNull());
+      TS_ASSERT_EQUALS(out2[1], out[1][1]);
+    }
+  }
+
+  void testExportDeep()
+  {
+    Expr x = d_exprManager->mkVar("x", d_exprManager->integerType());
+    Expr e = x;
+    for (unsigned i = 0; i < 100000; ++i)
+    {
+      e = d_exprManager->mkExpr(UMINUS, e);
+    }
+    ExprManager em;
+    {
+      ExprManagerMapCollection vmap;
+      Expr f = e.exportTo(&em, vmap);
+      TS_ASSERT_EQUALS(f.getKind(), UMINUS);
+    }
+  }
+
+  void testExportFromSuccessiveManagers()
+  {
+    // The sources are made at the same address and give their constants the
+    // same ids: the translations of the first one must not be found for the
+    // second one.
+    std::aligned_storage<sizeof(ExprManager), alignof(ExprManager)>::type
+        storage;
+    ExprManagerMapCollection vmap;
+    for (int i = 1; i <= 2; ++i)
+    {
+      ExprManager* em = new (&storage) ExprManager;
+      {
+        Expr c = em->mkConst(Rational(i));
+        TS_ASSERT_EQUALS(c.exportTo(d_exprManager, vmap),
+                         d_exprManager->mkConst(Rational(i)));
+      }
+      em->~ExprManager();
+    }
+  }
+
 };
@@ -294,6 +294,30 @@ private:
     TS_ASSERT(r1->getType().isReal());
     TS_ASSERT(r2->getType().isReal());
   }
+  void testGetTypeFast()
+  {
+    // types computed from already checked children, and the fallback to
+    // the full type rules when those do not apply
+    Type bv8 = d_em->mkBitVectorType(8);
+    Type bv4 = d_em->mkBitVectorType(4);
+    Expr a = d_em->mkVar("a", bv8);
+    Expr b = d_em->mkVar("b", bv8);
+    Expr c = d_em->mkVar("c", bv4);
+    Expr sum = d_em->mkExpr(BITVECTOR_PLUS, a, b);
+    TS_ASSERT(sum.getType(true) == bv8);
+    TS_ASSERT(d_em->mkExpr(BITVECTOR_ULT, sum, a).getType(true).isBoolean());
+    TS_ASSERT_THROWS(d_em->mkExpr(BITVECTOR_PLUS, sum, c).getType(true),
+                     TypeCheckingException&);
+    TS_ASSERT(d_em->mkExpr(PLUS, *i1, *i2).getType(true).isInteger());
+    TS_ASSERT(d_em->mkExpr(PLUS, *i1, *r1).getType(true).isReal());
+    TS_ASSERT(d_em->mkExpr(DIVISION, *i1, *i2).getType(true).isReal());
+    TS_ASSERT(d_em->mkExpr(EQUAL, *i1, *r1).getType(true).isBoolean());
+    TS_ASSERT(d_em->mkExpr(ITE, *a_bool, sum, a).getType(true) == bv8);
+    TS_ASSERT_THROWS(d_em->mkExpr(ITE, *a_bool, *i1, sum).getType(true),
+                     TypeCheckingException&);
+    TS_ASSERT_THROWS(d_em->mkExpr(AND, *a_bool, *i1).getType(true),
+                     TypeCheckingException&);
+  }
 
   void testToString() {
     /* std::string toString() const; */
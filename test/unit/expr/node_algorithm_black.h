@@ -130,4 +130,44 @@ class NodeAlgorithmBlack : public CxxTest::TestSuite
     TS_ASSERT(result[*d_boolTypeNode].find(d_nodeManager->operatorOf(EQUAL))
               != result[*d_boolTypeNode].end());
   }
+
+  // the symbols of several nodes with shared subterms are collected in one
+  // call, and consecutive calls do not see each other's visited nodes
+  void testGetSymbolsBatch()
+  {
+    Node x = d_nodeManager->mkSkolem("x", d_nodeManager->integerType());
+    Node y = d_nodeManager->mkSkolem("y", d_nodeManager->integerType());
+    Node z = d_nodeManager->mkSkolem("z", d_nodeManager->integerType());
+    Node xy = d_nodeManager->mkNode(PLUS, x, y);
+    std::vector<Node> ns;
+    ns.push_back(d_nodeManager->mkNode(EQUAL, xy, z));
+    ns.push_back(d_nodeManager->mkNode(LT, xy, x));
+    std::unordered_set<Node, NodeHashFunction> syms;
+    getSymbols(ns, syms);
+    TS_ASSERT_EQUALS(syms.size(), 3);
+
+    std::unordered_set<Node, NodeHashFunction> syms2;
+    getSymbols(ns[1], syms2);
+    TS_ASSERT_EQUALS(syms2.size(), 2);
+    TS_ASSERT(syms2.find(x) != syms2.end());
+    TS_ASSERT(syms2.find(y) != syms2.end());
+  }
+
+  // a variable bound by one quantifier is free next to it
+  void testGetFreeVariables()
+  {
+    Node v = d_nodeManager->mkBoundVar(*d_intTypeNode);
+    Node w = d_nodeManager->mkBoundVar(*d_intTypeNode);
+    Node bvl = d_nodeManager->mkNode(BOUND_VAR_LIST, v);
+    Node body = d_nodeManager->mkNode(
+        EQUAL, v, d_nodeManager->mkNode(PLUS, v, w));
+    Node q = d_nodeManager->mkNode(FORALL, bvl, body);
+    std::unordered_set<Node, NodeHashFunction> fvs;
+    TS_ASSERT(getFreeVariables(q, fvs));
+    TS_ASSERT_EQUALS(fvs.size(), 1);
+    TS_ASSERT(fvs.find(w) != fvs.end());
+    TS_ASSERT(!hasFreeVar(d_nodeManager->mkNode(
+        FORALL, d_nodeManager->mkNode(BOUND_VAR_LIST, v, w), body)));
+    TS_ASSERT(hasFreeVar(d_nodeManager->mkNode(AND, q, body.eqNode(body))));
+  }
 };
@@ -323,4 +323,58 @@ class NodeManagerBlack : public CxxTest::TestSuite {
     TS_UTILS_EXPECT_ABORT(d_nodeManager->mkNode(AND, vars));
 #endif
   }
+
+  /** Build (= (f x (+ n 3)) x) in nm, with x : U, n : Int, f : U x Int -> U */
+  static Node mkHashTerm(NodeManager* nm)
+  {
+    TypeNode u = nm->mkSort("U");
+    TypeNode intType = nm->integerType();
+    Node x = nm->mkSkolem("x", u, "", NodeManager::SKOLEM_EXACT_NAME);
+    Node n = nm->mkSkolem("n", intType, "", NodeManager::SKOLEM_EXACT_NAME);
+    std::vector<TypeNode> argTypes = {u, intType};
+    Node f = nm->mkSkolem("f",
+                          nm->mkFunctionType(argTypes, u),
+                          "",
+                          NodeManager::SKOLEM_EXACT_NAME);
+    Node sum = nm->mkNode(PLUS, n, nm->mkConst(Rational(3)));
+    return nm->mkNode(EQUAL, nm->mkNode(APPLY_UF, f, x, sum), x);
+  }
+
+  void testStructuralHash()
+  {
+    Node t = mkHashTerm(d_nodeManager);
+    uint64_t hash = t.getStructuralHash();
+    // fresh symbols with the same names give a different term, which does
+    // not collide with the first one
+    Node t1 = mkHashTerm(d_nodeManager);
+    TS_ASSERT_DIFFERS(t1, t);
+    TS_ASSERT_DIFFERS(t1.getStructuralHash(), hash);
+    TS_ASSERT_DIFFERS(t[0].getStructuralHash(), t[1].getStructuralHash());
+    Node b1 = d_nodeManager->mkBoundVar("b", d_nodeManager->integerType());
+    Node b2 = d_nodeManager->mkBoundVar("b", d_nodeManager->integerType());
+    TS_ASSERT_DIFFERS(b1.getStructuralHash(), b2.getStructuralHash());
+
+    Node x = d_nodeManager->mkSkolem(
+        "x", d_nodeManager->integerType(), "", NodeManager::SKOLEM_EXACT_NAME);
+    Node y = d_nodeManager->mkSkolem(
+        "y", d_nodeManager->integerType(), "", NodeManager::SKOLEM_EXACT_NAME);
+    TS_ASSERT_DIFFERS(x.getStructuralHash(), y.getStructuralHash());
+    TS_ASSERT_DIFFERS(d_nodeManager->mkNode(MINUS, x, y).getStructuralHash(),
+                      d_nodeManager->mkNode(MINUS, y, x).getStructuralHash());
+
+    // the same term in another NodeManager, created after unrelated nodes,
+    // has the same hash
+    uint64_t typeHash = t[0][0].getType().getStructuralHash();
+    NodeManager nm(NULL);
+    {
+      NodeManagerScope nms(&nm);
+      nm.mkSkolem("z", nm.realType(), "", NodeManager::SKOLEM_EXACT_NAME);
+      nm.mkConst(Rational(17));
+      Node t2 = mkHashTerm(&nm);
+      TS_ASSERT_EQUALS(t2.getStructuralHash(), hash);
+      TS_ASSERT_EQUALS(t2[0][1].getStructuralHash(),
+                       t[0][1].getStructuralHash());
+      TS_ASSERT_EQUALS(t2[0][0].getType().getStructuralHash(), typeHash);
+    }
+  }
 };
@@ -91,4 +91,118 @@ class NodeManagerWhite : public CxxTest::TestSuite {
       TS_ASSERT_EQUALS(NodeManager::TopologicalSort(roots), result);
     }
   }
+
+  void testNodeValueAllocatorReuse()
+  {
+    TypeNode boolType = d_nm->booleanType();
+    Node a = d_nm->mkSkolem("a", boolType);
+    Node b = d_nm->mkSkolem("b", boolType);
+    NodeValue* nv;
+    {
+      Node n = d_nm->mkNode(kind::AND, a, b);
+      nv = n.d_nv;
+    }
+    d_nm->reclaimZombies();
+    // the storage of the reclaimed node is reused for the next node with
+    // the same number of children
+    Node m = d_nm->mkNode(kind::OR, a, b);
+    TS_ASSERT_EQUALS(m.d_nv, nv);
+  }
+
+  void testPoolGrowth()
+  {
+    // enough nodes to make the pool grow (and migrate) several times
+    TypeNode intType = d_nm->integerType();
+    Node x = d_nm->mkSkolem("x", intType);
+    std::vector<Node> nodes;
+    for (unsigned i = 0; i < 20000; ++i)
+    {
+      nodes.push_back(
+          d_nm->mkNode(kind::PLUS, x, d_nm->mkConst(Rational(i))));
+    }
+    size_t size = d_nm->poolSize();
+    for (unsigned i = 0; i < 20000; ++i)
+    {
+      Node n = d_nm->mkNode(kind::PLUS, x, d_nm->mkConst(Rational(i)));
+      TS_ASSERT_EQUALS(n.getId(), nodes[i].getId());
+    }
+    TS_ASSERT_EQUALS(d_nm->poolSize(), size);
+    for (unsigned i = 0; i < 20000; i += 2)
+    {
+      nodes[i] = Node::null();
+    }
+    d_nm->reclaimZombies();
+    for (unsigned i = 1; i < 20000; i += 2)
+    {
+      Node n = d_nm->mkNode(kind::PLUS, x, d_nm->mkConst(Rational(i)));
+      TS_ASSERT_EQUALS(n.getId(), nodes[i].getId());
+    }
+    TS_ASSERT_LESS_THAN(d_nm->poolSize(), size);
+  }
+
+  void testIncrementalZombieReclamation()
+  {
+    Options opts;
+    {
+      // setOption() sets the options in scope
+      Options::OptionsScope scope(&opts);
+      opts.setOption("zombie-reclaim", "lru");
+      opts.setOption("zombie-threshold", "10");
+      opts.setOption("zombie-reclaim-budget", "4");
+    }
+    NodeManager nm(NULL, opts);
+    NodeManagerScope nms(&nm);
+    Node x = nm.mkSkolem("x", nm.integerType());
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      Node n = nm.mkNode(kind::PLUS, x, nm.mkConst(Rational(i)));
+    }
+    // each pass reclaims at most 4 zombies, the others are kept for later
+    // passes in the order in which they were zombified
+    TS_ASSERT_LESS_THAN_EQUALS(nm.d_zombies.size(), 15u);
+    TS_ASSERT_EQUALS(nm.d_zombies.size(), nm.d_zombieQueue.size());
+    // reclaiming the sums zombifies their constants, which a second pass
+    // reclaims
+    nm.reclaimZombies();
+    TS_ASSERT_EQUALS(nm.d_zombies.size(), nm.d_zombieQueue.size());
+    nm.reclaimZombies();
+    TS_ASSERT(nm.d_zombieQueue.empty());
+  }
+
+  void testResurrectedZombiesNotCounted()
+  {
+    Options opts;
+    {
+      // setOption() sets the options in scope
+      Options::OptionsScope scope(&opts);
+      opts.setOption("zombie-reclaim", "lru");
+      opts.setOption("zombie-threshold", "10");
+      opts.setOption("zombie-reclaim-budget", "4");
+    }
+    NodeManager nm(NULL, opts);
+    NodeManagerScope nms(&nm);
+    Node x = nm.mkSkolem("x", nm.integerType());
+    std::vector<Node> consts;
+    for (unsigned i = 0; i <= 10; ++i)
+    {
+      consts.push_back(nm.mkConst(Rational(i)));
+    }
+    for (unsigned i = 0; i < 10; ++i)
+    {
+      Node n = nm.mkNode(kind::PLUS, x, consts[i]);
+    }
+    TS_ASSERT_EQUALS(nm.d_zombies.size(), 10u);
+    // resurrect the five oldest zombies
+    std::vector<Node> live;
+    for (unsigned i = 0; i < 5; ++i)
+    {
+      live.push_back(nm.mkNode(kind::PLUS, x, consts[i]));
+    }
+    {
+      Node n = nm.mkNode(kind::PLUS, x, consts[10]);
+    }
+    // the pass drops the five resurrected nodes and reclaims four zombies
+    TS_ASSERT_EQUALS(nm.d_zombies.size(), 2u);
+    TS_ASSERT_EQUALS(nm.d_zombieQueue.size(), 2u);
+  }
 };
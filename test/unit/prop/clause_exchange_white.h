@@ -0,0 +1,116 @@
+/*********************                                                        */
+/*! \file clause_exchange_white.h
+ ** \verbatim
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of CVC4::prop::ClauseExchange.
+ **
+ ** White box testing of CVC4::prop::ClauseExchange.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <thread>
+#include <vector>
+
+#include "prop/clause_exchange.h"
+
+using namespace CVC4::prop;
+
+class ClauseExchangeWhite : public CxxTest::TestSuite
+{
+ public:
+  void testAtomIds()
+  {
+    ClauseExchange exchange(2);
+    uint32_t a = exchange.getAtomId("(1 s0 s1)");
+    uint32_t b = exchange.getAtomId("(1 s1 s0)");
+    TS_ASSERT_DIFFERS(a, b);
+    TS_ASSERT_EQUALS(exchange.getAtomId("(1 s0 s1)"), a);
+    TS_ASSERT_EQUALS(exchange.getAtomId("(1 s1 s0)"), b);
+  }
+
+  void testPublishCollect()
+  {
+    ClauseExchange exchange(3);
+    exchange.publish(0, ClauseExchange::Clause{0, 3});
+    exchange.publish(1, ClauseExchange::Clause{5});
+
+    // an instance does not collect its own clauses
+    std::vector<ClauseExchange::Clause> clauses;
+    exchange.collect(0, clauses);
+    TS_ASSERT_EQUALS(clauses.size(), 1u);
+    TS_ASSERT(clauses[0] == ClauseExchange::Clause{5});
+
+    clauses.clear();
+    exchange.collect(2, clauses);
+    TS_ASSERT_EQUALS(clauses.size(), 2u);
+
+    // nor the clauses it collected already
+    clauses.clear();
+    exchange.collect(2, clauses);
+    TS_ASSERT(clauses.empty());
+    exchange.publish(0, ClauseExchange::Clause{2});
+    exchange.collect(2, clauses);
+    TS_ASSERT_EQUALS(clauses.size(), 1u);
+    TS_ASSERT(clauses[0] == ClauseExchange::Clause{2});
+    TS_ASSERT_EQUALS(exchange.getExported(), 3u);
+  }
+
+  void testOverflow()
+  {
+    // a reader that falls behind loses the oldest clauses
+    ClauseExchange exchange(2);
+    const uint32_t n = 10000;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      exchange.publish(0, ClauseExchange::Clause{i});
+    }
+    std::vector<ClauseExchange::Clause> clauses;
+    exchange.collect(1, clauses);
+    TS_ASSERT(!clauses.empty());
+    TS_ASSERT(clauses.size() < n);
+    TS_ASSERT(clauses.back() == ClauseExchange::Clause{n - 1});
+    for (size_t i = 1; i < clauses.size(); ++i)
+    {
+      TS_ASSERT_EQUALS(clauses[i][0], clauses[i - 1][0] + 1);
+    }
+  }
+
+  void testConcurrent()
+  {
+    // the clauses read while they are published are never torn: each
+    // clause is {i, i, ..., i} of size i % kMaxSize + 1
+    ClauseExchange exchange(2);
+    const uint32_t n = 100000;
+    std::thread producer([&]() {
+      for (uint32_t i = 0; i < n; ++i)
+      {
+        exchange.publish(
+            0, ClauseExchange::Clause(i % ClauseExchange::kMaxSize + 1, i));
+      }
+    });
+    bool torn = false;
+    std::vector<ClauseExchange::Clause> clauses;
+    while (exchange.getExported() < n)
+    {
+      exchange.collect(1, clauses);
+    }
+    producer.join();
+    exchange.collect(1, clauses);
+    for (const ClauseExchange::Clause& c : clauses)
+    {
+      torn = torn || c.size() != c[0] % ClauseExchange::kMaxSize + 1;
+      for (uint32_t lit : c)
+      {
+        torn = torn || lit != c[0];
+      }
+    }
+    TS_ASSERT(!torn);
+    TS_ASSERT(!clauses.empty());
+  }
+};
@@ -45,9 +45,10 @@ using namespace std;
 class FakeSatSolver : public SatSolver {
   SatVariable d_nextVar;
   bool d_addClauseCalled;
+  unsigned d_numClauses;
 
  public:
-  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false) {}
+  FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false), d_numClauses(0) {}
 
   SatVariable newVar(bool theoryAtom, bool preRegister, bool canErase) override
   {
@@ -61,6 +62,7 @@ class FakeSatSolver : public SatSolver {
   ClauseId addClause(SatClause& c, bool lemma) override
   {
     d_addClauseCalled = true;
+    ++d_numClauses;
     return ClauseIdUndef;
   }
 
@@ -76,6 +78,8 @@ class FakeSatSolver : public SatSolver {
 
   unsigned int addClauseCalled() { return d_addClauseCalled; }
 
+  unsigned numClauses() const { return d_numClauses; }
+
   unsigned getAssertionLevel() const override { return 0; }
 
   bool isDecision(Node) const { return false; }
@@ -294,4 +298,105 @@ class CnfStreamWhite : public CxxTest::TestSuite {
     TS_ASSERT(d_satSolver->addClauseCalled());
     TS_ASSERT(d_cnfStream->hasLiteral(a_and_b));
   }
+
+  void testPolarityEncoding()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node d = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node n = d_nodeManager->mkNode(kind::OR,
+                                   d_nodeManager->mkNode(kind::AND, a, b),
+                                   d_nodeManager->mkNode(kind::AND, c, d));
+    // 3 clauses for each AND gate, and the clause of the OR
+    d_cnfStream->convertAndAssert(n, false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(d_satSolver->numClauses(), 7u);
+
+    // only lit -> (and x y) is needed for the positive occurrences
+    FakeSatSolver satSolver;
+    Context context;
+    TseitinCnfStream cnfStream(
+        &satSolver, d_cnfRegistrar, &context, false, "", nullptr, true);
+    cnfStream.convertAndAssert(n, false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 5u);
+  }
+
+  void testPolarityEncodingIncremental()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node x = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node y = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node a_and_b = d_nodeManager->mkNode(kind::AND, a, b);
+    Node pos = d_nodeManager->mkNode(kind::OR, a_and_b, x);
+    Node neg = d_nodeManager->mkNode(kind::OR, a_and_b.notNode(), y);
+
+    FakeSatSolver satSolver;
+    Context context;
+    TseitinCnfStream cnfStream(
+        &satSolver, d_cnfRegistrar, &context, false, "", nullptr, true);
+    cnfStream.convertAndAssert(pos, false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 3u);
+
+    // the negative occurrence adds (and a b) -> lit
+    context.push();
+    cnfStream.convertAndAssert(neg, false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 5u);
+    context.pop();
+
+    // which is added again once popped
+    cnfStream.convertAndAssert(neg, false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 7u);
+
+    // ensureLiteral() needs both polarities
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node a_or_c = d_nodeManager->mkNode(kind::OR, a, c);
+    cnfStream.convertAndAssert(
+        d_nodeManager->mkNode(kind::OR, a_or_c, x),
+        false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 9u);
+    cnfStream.ensureLiteral(a_or_c);
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 11u);
+  }
+
+  void testGateHashing()
+  {
+    NodeManagerScope nms(d_nodeManager);
+    Node a = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node b = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node c = d_nodeManager->mkVar(d_nodeManager->booleanType());
+    Node x = d_nodeManager->mkVar(d_nodeManager->booleanType());
+
+    FakeSatSolver satSolver;
+    Context context;
+    TseitinCnfStream cnfStream(
+        &satSolver, d_cnfRegistrar, &context, false, "", nullptr, true, true);
+
+    // (and a b) and (and b a) share their literal
+    Node a_and_b = d_nodeManager->mkNode(kind::AND, a, b);
+    Node b_and_a = d_nodeManager->mkNode(kind::AND, b, a);
+    cnfStream.convertAndAssert(d_nodeManager->mkNode(kind::OR, a_and_b, b_and_a),
+                               false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 3u);
+    TS_ASSERT_EQUALS(cnfStream.getLiteral(a_and_b),
+                     cnfStream.getLiteral(b_and_a));
+
+    // (and c (not (or a x))) is flattened into (and c (not a) (not x))
+    Node n = d_nodeManager->mkNode(
+        kind::AND,
+        c,
+        d_nodeManager->mkNode(kind::OR, a, x).notNode());
+    cnfStream.convertAndAssert(d_nodeManager->mkNode(kind::OR, n, x),
+                               false, false, RULE_INVALID, Node::null());
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 7u);
+    TS_ASSERT(!cnfStream.hasLiteral(d_nodeManager->mkNode(kind::OR, a, x)));
+
+    // (or a a) is a
+    Node a_or_a = d_nodeManager->mkNode(kind::OR, a, a);
+    cnfStream.ensureLiteral(a_or_a);
+    TS_ASSERT_EQUALS(satSolver.numClauses(), 7u);
+    TS_ASSERT_EQUALS(cnfStream.getLiteral(a_or_a), cnfStream.getLiteral(a));
+  }
 };